@@ -6,6 +6,7 @@
 
 #include "nvapi/fakenvapi.h"
 #include <hooks/Streamline_Hooks.h>
+#include <misc/SamplerOverrides.h>
 
 #include <SimpleIni.h>
 
@@ -118,6 +119,7 @@ bool Config::Reload(std::filesystem::path iniPath)
             FGVelocityValidNow.set_from_config(readBool("FrameGen", "VelocityValidNow"));
             FGHudlessValidNow.set_from_config(readBool("FrameGen", "HudlessValidNow"));
             FGOnlyAcceptFirstHudless.set_from_config(readBool("FrameGen", "OnlyAcceptFirstHudless"));
+            FGSnapshotQueue.set_from_config(readBool("FrameGen", "SnapshotQueue"));
         }
 
         // FSR FG
@@ -142,9 +144,9 @@ bool Config::Reload(std::filesystem::path iniPath)
             FGHUDLimit.set_from_config(readInt("OptiFG", "HUDLimit"));
             FGHUDFixExtended.set_from_config(readBool("OptiFG", "HUDFixExtended"));
             FGImmediateCapture.set_from_config(readBool("OptiFG", "HUDFixImmediate"));
-            FGUseShards.set_from_config(readBool("OptiFG", "UseShards"));
             FGAlwaysTrackHeaps.set_from_config(readBool("OptiFG", "AlwaysTrackHeaps"));
             FGResourceBlocking.set_from_config(readBool("OptiFG", "ResourceBlocking"));
+            FGResourceTrackingCapture.set_from_config(readBool("OptiFG", "ResourceTrackingCapture"));
             FGMakeDepthCopy.set_from_config(readBool("OptiFG", "MakeDepthCopy"));
             FGMakeMVCopy.set_from_config(readBool("OptiFG", "MakeMVCopy"));
             FGHudfixDisableRTV.set_from_config(readBool("OptiFG", "HudfixDisableRTV"));
@@ -156,6 +158,13 @@ bool Config::Reload(std::filesystem::path iniPath)
             FGHudfixDisableDII.set_from_config(readBool("OptiFG", "HudfixDisableDII"));
             FGHudfixDisableSCR.set_from_config(readBool("OptiFG", "HudfixDisableSCR"));
             FGHudfixDisableSGR.set_from_config(readBool("OptiFG", "HudfixDisableSGR"));
+            FGHudfixSampling.set_from_config(readBool("OptiFG", "HudfixSampling"));
+
+            if (auto setting = readInt("OptiFG", "HudfixSamplingStableFrames"); setting.has_value())
+                FGHudfixSamplingStableFrames.set_from_config(std::max(setting.value(), 1));
+
+            if (auto setting = readInt("OptiFG", "HudfixSamplingFullScanInterval"); setting.has_value())
+                FGHudfixSamplingFullScanInterval.set_from_config(std::max(setting.value(), 0));
 
             FGEnableDepthScale.set_from_config(readBool("OptiFG", "EnableDepthScale"));
             FGDepthScaleMax.set_from_config(readFloat("OptiFG", "DepthScaleMax"));
@@ -345,6 +354,7 @@ bool Config::Reload(std::filesystem::path iniPath)
             LogSingleFile.set_from_config(readBool("Log", "SingleFile"));
             LogAsync.set_from_config(readBool("Log", "LogAsync"));
             LogAsyncThreads.set_from_config(readInt("Log", "LogAsyncThreads"));
+            NGXParameterCapture.set_from_config(readBool("Log", "NGXParameterCapture"));
 
             {
                 auto setting = readString("Log", "LogFile", false);
@@ -522,6 +532,7 @@ bool Config::Reload(std::filesystem::path iniPath)
             MipmapBiasFixedOverride.set_from_config(readBool("Mipmap", "MipmapBiasFixedOverride"));
             MipmapBiasScaleOverride.set_from_config(readBool("Mipmap", "MipmapBiasScaleOverride"));
             MipmapBiasOverrideAll.set_from_config(readBool("Mipmap", "MipmapBiasOverrideAll"));
+            RootSignatureDiskCache.set_from_config(readBool("Mipmap", "RootSignatureDiskCache"));
         }
 
         // Process Filter
@@ -599,6 +610,7 @@ bool Config::Reload(std::filesystem::path iniPath)
             EnableFsr3Inputs.set_from_config(readBool("Inputs", "EnableFsr3Inputs"));
             UseFsr3Inputs.set_from_config(readBool("Inputs", "UseFsr3Inputs"));
             Fsr3Pattern.set_from_config(readBool("Inputs", "Fsr3Pattern"));
+            PatternCache.set_from_config(readBool("Inputs", "PatternCache"));
 
             EnableFfxInputs.set_from_config(readBool("Inputs", "EnableFfxInputs"));
             UseFfxInputs.set_from_config(readBool("Inputs", "UseFfxInputs"));
@@ -666,6 +678,7 @@ bool Config::LoadFromPath(const wchar_t* InPath)
     if (Reload(newPath))
     {
         absoluteFileName = newPath;
+        SamplerOverrides::Refresh();
         return true;
     }
 
@@ -763,6 +776,7 @@ bool Config::SaveIni()
                      GetBoolValue(Instance()->FGHudlessValidNow.value_for_config()).c_str());
         ini.SetValue("FrameGen", "OnlyAcceptFirstHudless",
                      GetBoolValue(Instance()->FGOnlyAcceptFirstHudless.value_for_config()).c_str());
+        ini.SetValue("FrameGen", "SnapshotQueue", GetBoolValue(Instance()->FGSnapshotQueue.value_for_config()).c_str());
     }
 
     // FSR FG output
@@ -817,11 +831,12 @@ bool Config::SaveIni()
         ini.SetValue("OptiFG", "HUDFixExtended", GetBoolValue(Instance()->FGHUDFixExtended.value_for_config()).c_str());
         ini.SetValue("OptiFG", "HUDFixImmediate",
                      GetBoolValue(Instance()->FGImmediateCapture.value_for_config()).c_str());
-        ini.SetValue("OptiFG", "UseShards", GetBoolValue(Instance()->FGUseShards.value_for_config()).c_str());
         ini.SetValue("OptiFG", "AlwaysTrackHeaps",
                      GetBoolValue(Instance()->FGAlwaysTrackHeaps.value_for_config()).c_str());
         ini.SetValue("OptiFG", "ResourceBlocking",
                      GetBoolValue(Instance()->FGResourceBlocking.value_for_config()).c_str());
+        ini.SetValue("OptiFG", "ResourceTrackingCapture",
+                     GetBoolValue(Instance()->FGResourceTrackingCapture.value_for_config()).c_str());
         ini.SetValue("OptiFG", "MakeDepthCopy", GetBoolValue(Instance()->FGMakeDepthCopy.value_for_config()).c_str());
         ini.SetValue("OptiFG", "MakeMVCopy", GetBoolValue(Instance()->FGMakeMVCopy.value_for_config()).c_str());
 
@@ -843,6 +858,11 @@ bool Config::SaveIni()
                      GetBoolValue(Instance()->FGHudfixDisableSCR.value_for_config()).c_str());
         ini.SetValue("OptiFG", "HudfixDisableSGR",
                      GetBoolValue(Instance()->FGHudfixDisableSGR.value_for_config()).c_str());
+        ini.SetValue("OptiFG", "HudfixSampling", GetBoolValue(Instance()->FGHudfixSampling.value_for_config()).c_str());
+        ini.SetValue("OptiFG", "HudfixSamplingStableFrames",
+                     GetIntValue(Instance()->FGHudfixSamplingStableFrames.value_for_config()).c_str());
+        ini.SetValue("OptiFG", "HudfixSamplingFullScanInterval",
+                     GetIntValue(Instance()->FGHudfixSamplingFullScanInterval.value_for_config()).c_str());
 
         ini.SetValue("OptiFG", "EnableDepthScale",
                      GetBoolValue(Instance()->FGEnableDepthScale.value_for_config()).c_str());
@@ -1120,6 +1140,8 @@ bool Config::SaveIni()
                      GetBoolValue(Instance()->MipmapBiasFixedOverride.value_for_config()).c_str());
         ini.SetValue("Mipmap", "MipmapBiasScaleOverride",
                      GetBoolValue(Instance()->MipmapBiasScaleOverride.value_for_config()).c_str());
+        ini.SetValue("Mipmap", "RootSignatureDiskCache",
+                     GetBoolValue(Instance()->RootSignatureDiskCache.value_for_config()).c_str());
     }
 
     // Process Filter
@@ -1185,6 +1207,8 @@ bool Config::SaveIni()
         ini.SetValue("Log", "SingleFile", GetBoolValue(Instance()->LogSingleFile.value_for_config()).c_str());
         ini.SetValue("Log", "LogAsync", GetBoolValue(Instance()->LogAsync.value_for_config()).c_str());
         ini.SetValue("Log", "LogAsyncThreads", GetIntValue(Instance()->LogAsyncThreads.value_for_config()).c_str());
+        ini.SetValue("Log", "NGXParameterCapture",
+                     GetBoolValue(Instance()->NGXParameterCapture.value_for_config()).c_str());
     }
 
     // NvApi
@@ -1264,6 +1288,7 @@ bool Config::SaveIni()
         ini.SetValue("Inputs", "Fsr2Pattern", GetBoolValue(Instance()->Fsr2Pattern.value_for_config()).c_str());
         ini.SetValue("Inputs", "UseFsr3Inputs", GetBoolValue(Instance()->UseFsr3Inputs.value_for_config()).c_str());
         ini.SetValue("Inputs", "Fsr3Pattern", GetBoolValue(Instance()->Fsr3Pattern.value_for_config()).c_str());
+        ini.SetValue("Inputs", "PatternCache", GetBoolValue(Instance()->PatternCache.value_for_config()).c_str());
         ini.SetValue("Inputs", "UseFfxInputs", GetBoolValue(Instance()->UseFfxInputs.value_for_config()).c_str());
         ini.SetValue("Inputs", "EnableHotSwapping",
                      GetBoolValue(Instance()->EnableHotSwapping.value_for_config()).c_str());
@@ -198,6 +198,7 @@ class Config
     CustomOptional<bool> LogSingleFile { true };
     CustomOptional<bool> LogAsync { false };
     CustomOptional<int> LogAsyncThreads { 4 };
+    CustomOptional<bool> NGXParameterCapture { false };
 
     // XeSS
     CustomOptional<bool> BuildPipelines { true };
@@ -307,6 +308,7 @@ class Config
     CustomOptional<bool> MipmapBiasFixedOverride { false };
     CustomOptional<bool> MipmapBiasScaleOverride { false };
     CustomOptional<bool> MipmapBiasOverrideAll { false };
+    CustomOptional<bool> RootSignatureDiskCache { true };
 
     CustomOptional<int, NoDefault> AnisotropyOverride; // disabled by default
     CustomOptional<bool> OverrideShaderSampler { true };
@@ -421,6 +423,7 @@ class Config
     CustomOptional<bool> FGVelocityValidNow { false };
     CustomOptional<bool> FGHudlessValidNow { false };
     CustomOptional<bool> FGOnlyAcceptFirstHudless { false };
+    CustomOptional<bool> FGSnapshotQueue { false };
 
     // OptiFG
     CustomOptional<bool> FGEnabled { false };
@@ -452,11 +455,14 @@ class Config
     CustomOptional<bool> FGHudfixDisableDII { false };
     CustomOptional<bool> FGHudfixDisableSCR { true };
     CustomOptional<bool> FGHudfixDisableSGR { true };
+    CustomOptional<bool> FGHudfixSampling { false };
+    CustomOptional<int> FGHudfixSamplingStableFrames { 30 };
+    CustomOptional<int> FGHudfixSamplingFullScanInterval { 60 };
 
     // OptiFG - Resource Tracking
     CustomOptional<bool> FGAlwaysTrackHeaps { false };
     CustomOptional<bool> FGResourceBlocking { false };
-    CustomOptional<bool> FGUseShards { false };
+    CustomOptional<bool> FGResourceTrackingCapture { false };
 
     // OptiFG - DLSS-D Depth scale
     CustomOptional<bool> FGEnableDepthScale { false };
@@ -507,6 +513,7 @@ class Config
     CustomOptional<bool> Fsr2Pattern { false };
     CustomOptional<bool> UseFsr3Inputs { true };
     CustomOptional<bool> Fsr3Pattern { false };
+    CustomOptional<bool> PatternCache { true };
     CustomOptional<bool> UseFfxInputs { true };
     CustomOptional<bool> EnableHotSwapping { false };
     CustomOptional<bool> EnableFsr2Inputs { true };
@@ -0,0 +1,186 @@
+#include "DllNameMatcher.h"
+
+#include <DllNames.h>
+
+#include <atomic>
+#include <memory>
+
+struct SuffixTrieEdge
+{
+    wchar_t character;
+    uint32_t node;
+};
+
+struct SuffixTrieNode
+{
+    // Lists which have a name ending at this node
+    uint32_t lists = 0;
+    uint32_t firstEdge = 0;
+    uint32_t edgeCount = 0;
+};
+
+// Names are inserted reversed, root is node 0
+struct SuffixTrie
+{
+    std::vector<SuffixTrieNode> nodes;
+    std::vector<SuffixTrieEdge> edges;
+
+    uint32_t Child(uint32_t node, wchar_t character) const
+    {
+        auto& current = nodes[node];
+
+        for (uint32_t i = current.firstEdge; i < current.firstEdge + current.edgeCount; i++)
+        {
+            if (edges[i].character == character)
+                return edges[i].node;
+        }
+
+        return 0;
+    }
+};
+
+static inline wchar_t FoldCase(wchar_t c)
+{
+    if (c >= L'A' && c <= L'Z')
+        return c + (L'a' - L'A');
+
+    return c;
+}
+
+static SuffixTrie BuildTrie()
+{
+    struct BuildNode
+    {
+        uint32_t lists = 0;
+        std::vector<std::pair<wchar_t, uint32_t>> children;
+    };
+
+    const std::pair<DllNameList, const std::vector<std::wstring>*> lists[] = {
+        { DllNameList::Opti, &dllNamesW },
+        { DllNameList::Nvngx, &nvngxNamesW },
+        { DllNameList::NvngxDlss, &nvngxDlssNamesW },
+        { DllNameList::Nvapi, &nvapiNamesW },
+        { DllNameList::SlInterposer, &slInterposerNamesW },
+        { DllNameList::SlDlss, &slDlssNamesW },
+        { DllNameList::SlDlssg, &slDlssgNamesW },
+        { DllNameList::SlReflex, &slReflexNamesW },
+        { DllNameList::SlPcl, &slPclNamesW },
+        { DllNameList::SlCommon, &slCommonNamesW },
+        { DllNameList::BlockOverlay, &blockOverlayNamesW },
+        { DllNameList::Overlay, &overlayNamesW },
+        { DllNameList::Dx11, &dx11NamesW },
+        { DllNameList::Dx12, &dx12NamesW },
+        { DllNameList::Dx12Agility, &dx12agilityNamesW },
+        { DllNameList::Vulkan, &vkNamesW },
+        { DllNameList::Dxgi, &dxgiNamesW },
+        { DllNameList::Fsr2, &fsr2NamesW },
+        { DllNameList::Fsr2BE, &fsr2BENamesW },
+        { DllNameList::Fsr3, &fsr3NamesW },
+        { DllNameList::Fsr3BE, &fsr3BENamesW },
+        { DllNameList::Xess, &xessNamesW },
+        { DllNameList::XessDx11, &xessDx11NamesW },
+        { DllNameList::FfxDx12, &ffxDx12NamesW },
+        { DllNameList::FfxDx12Upscaler, &ffxDx12UpscalerNamesW },
+        { DllNameList::FfxDx12FG, &ffxDx12FGNamesW },
+        { DllNameList::FfxVk, &ffxVkNamesW },
+    };
+
+    static_assert(std::size(lists) == (size_t) DllNameList::Count, "Every DllNameList needs a names list");
+
+    std::vector<BuildNode> buildNodes(1);
+    size_t nameCount = 0;
+
+    for (const auto& [list, names] : lists)
+    {
+        for (const auto& name : *names)
+        {
+            if (name.empty())
+                continue;
+
+            uint32_t node = 0;
+
+            for (auto it = name.rbegin(); it != name.rend(); it++)
+            {
+                auto c = FoldCase(*it);
+                uint32_t next = 0;
+
+                for (auto& [character, child] : buildNodes[node].children)
+                {
+                    if (character == c)
+                    {
+                        next = child;
+                        break;
+                    }
+                }
+
+                if (next == 0)
+                {
+                    next = (uint32_t) buildNodes.size();
+                    buildNodes[node].children.push_back({ c, next });
+                    buildNodes.emplace_back();
+                }
+
+                node = next;
+            }
+
+            buildNodes[node].lists |= 1u << (uint32_t) list;
+            nameCount++;
+        }
+    }
+
+    SuffixTrie trie;
+    trie.nodes.resize(buildNodes.size());
+
+    for (size_t i = 0; i < buildNodes.size(); i++)
+    {
+        auto& node = trie.nodes[i];
+        node.lists = buildNodes[i].lists;
+        node.firstEdge = (uint32_t) trie.edges.size();
+        node.edgeCount = (uint32_t) buildNodes[i].children.size();
+
+        for (auto& [character, child] : buildNodes[i].children)
+            trie.edges.push_back({ character, child });
+    }
+
+    LOG_DEBUG("Compiled {} dll names into {} nodes", nameCount, trie.nodes.size());
+
+    return trie;
+}
+
+// Replaced as a whole by Build, so a Match running on another thread keeps the trie it loaded
+static std::atomic<std::shared_ptr<const SuffixTrie>> _trie;
+
+void DllNameMatcher::Build() { _trie.store(std::make_shared<const SuffixTrie>(BuildTrie())); }
+
+DllNameMatch DllNameMatcher::Match(std::wstring_view libName)
+{
+    auto trie = _trie.load();
+
+    if (trie == nullptr)
+    {
+        // Library loads hooked with EarlyHooking are checked before the names are final
+        Build();
+        trie = _trie.load();
+    }
+
+    DllNameMatch result {};
+    uint32_t node = 0;
+
+    for (size_t i = libName.size(); i > 0; i--)
+    {
+        auto c = libName[i - 1];
+
+        // None of the names have a path, so only file name part can match
+        if (c == L'\\' || c == L'/')
+            break;
+
+        node = trie->Child(node, FoldCase(c));
+
+        if (node == 0)
+            break;
+
+        result.lists |= trie->nodes[node].lists;
+    }
+
+    return result;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <pch.h>
+
+// Name lists of DllNames.h which are checked on library loads
+enum class DllNameList : uint32_t
+{
+    Opti,
+    Nvngx,
+    NvngxDlss,
+    Nvapi,
+    SlInterposer,
+    SlDlss,
+    SlDlssg,
+    SlReflex,
+    SlPcl,
+    SlCommon,
+    BlockOverlay,
+    Overlay,
+    Dx11,
+    Dx12,
+    Dx12Agility,
+    Vulkan,
+    Dxgi,
+    Fsr2,
+    Fsr2BE,
+    Fsr3,
+    Fsr3BE,
+    Xess,
+    XessDx11,
+    FfxDx12,
+    FfxDx12Upscaler,
+    FfxDx12FG,
+    FfxVk,
+
+    Count
+};
+
+static_assert((uint32_t) DllNameList::Count <= 32, "DllNameMatch mask is 32 bits");
+
+struct DllNameMatch
+{
+    uint32_t lists = 0;
+
+    bool Has(DllNameList list) const { return (lists & (1u << (uint32_t) list)) != 0; }
+    bool Any() const { return lists != 0; }
+};
+
+// All name lists compiled into one case folded suffix trie, a name matches a list when it ends with one of its names.
+// Built on first use, Build has to be called again after the lists change, like when Opti's own names are added.
+class DllNameMatcher
+{
+  public:
+    static void Build();
+    static DllNameMatch Match(std::wstring_view libName);
+};
@@ -1,10 +1,14 @@
 #pragma once
-#include "pch.h"
+#include <pch.h>
 
-#include "Config.h"
+#include <Config.h>
+#include "NVNGX_ParameterKeys.h"
+#include "NVNGX_ParameterCapture.h"
 
 #include <ankerl/unordered_dense.h>
 
+#include <atomic>
+
 // Use real NVNGX params encapsulated in custom one
 // Which is not working correctly
 // #define ENABLE_ENCAPSULATED_PARAMS
@@ -648,6 +652,110 @@ struct Parameter
     size_t key = 0;
 };
 
+template <typename T> constexpr NGXCaptureValueType CaptureValueType()
+{
+    if constexpr (std::is_same<T, float>::value)
+        return NGXCaptureValueType::Float;
+    else if constexpr (std::is_same<T, double>::value)
+        return NGXCaptureValueType::Double;
+    else if constexpr (std::is_same<T, int>::value)
+        return NGXCaptureValueType::Int;
+    else if constexpr (std::is_same<T, unsigned int>::value)
+        return NGXCaptureValueType::UInt;
+    else if constexpr (std::is_same<T, unsigned long long>::value)
+        return NGXCaptureValueType::ULongLong;
+    else if constexpr (std::is_same<T, void*>::value)
+        return NGXCaptureValueType::VoidPtr;
+    else if constexpr (std::is_same<T, ID3D11Resource*>::value)
+        return NGXCaptureValueType::D3D11Resource;
+    else if constexpr (std::is_same<T, ID3D12Resource*>::value)
+        return NGXCaptureValueType::D3D12Resource;
+    else
+        return NGXCaptureValueType::None;
+}
+
+template <typename T> uint64_t CaptureValueBits(const T& value)
+{
+    static_assert(sizeof(T) <= sizeof(uint64_t));
+
+    uint64_t bits = 0;
+    memcpy(&bits, &value, sizeof(T));
+    return bits;
+}
+
+// Value of a known key, readers don't lock and retry if a write happened meanwhile
+struct ParameterSlot
+{
+    void Store(const Parameter& parameter)
+    {
+        uint64_t bits = 0;
+        memcpy(&bits, &parameter.values, sizeof(parameter.values));
+
+        // Odd sequence marks a write in progress, also keeps other writers out
+        auto sequence = _sequence.load(std::memory_order_relaxed);
+
+        while ((sequence & 1) != 0 ||
+               !_sequence.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire,
+                                                std::memory_order_relaxed))
+        {
+            YieldProcessor();
+            sequence = _sequence.load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_release);
+
+        _value.store(bits, std::memory_order_relaxed);
+        _type.store(parameter.key, std::memory_order_relaxed);
+
+        _sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    void Clear()
+    {
+        Parameter empty;
+        empty.values.ull = 0;
+        Store(empty);
+    }
+
+    bool Load(Parameter& parameter) const
+    {
+        while (true)
+        {
+            auto sequence = _sequence.load(std::memory_order_acquire);
+
+            if ((sequence & 1) != 0)
+            {
+                YieldProcessor();
+                continue;
+            }
+
+            auto bits = _value.load(std::memory_order_relaxed);
+            auto type = _type.load(std::memory_order_relaxed);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (_sequence.load(std::memory_order_relaxed) != sequence)
+                continue;
+
+            // Type 0 is a key which is not set
+            if (type == 0)
+                return false;
+
+            memcpy(&parameter.values, &bits, sizeof(parameter.values));
+            parameter.key = type;
+
+            return true;
+        }
+    }
+
+    bool IsSet() const { return _type.load(std::memory_order_relaxed) != 0; }
+
+  private:
+    std::atomic<uint32_t> _sequence = 0;
+    std::atomic<uint64_t> _value = 0;
+    std::atomic<size_t> _type = 0;
+};
+
 struct NVNGX_Parameters : public NVSDK_NGX_Parameter
 {
     std::string Name;
@@ -915,8 +1023,15 @@ struct NVNGX_Parameters : public NVSDK_NGX_Parameter
 
     void Reset() override
     {
-        if (!m_values.empty())
-            m_values.clear();
+        for (auto& slot : m_slots)
+            slot.Clear();
+
+        {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (!m_values.empty())
+                m_values.clear();
+        }
 
         LOG_DEBUG("Start");
 
@@ -928,6 +1043,15 @@ struct NVNGX_Parameters : public NVSDK_NGX_Parameter
     std::vector<std::string> enumerate() const
     {
         std::vector<std::string> keys;
+
+        for (size_t i = 0; i < NGXParameterKeys::Count; i++)
+        {
+            if (m_slots[i].IsSet())
+                keys.push_back(NGXParameterKeys::Name(i));
+        }
+
+        const std::lock_guard<std::mutex> lock(m_mutex);
+
         for (auto& value : m_values)
         {
             keys.push_back(value.first);
@@ -936,27 +1060,78 @@ struct NVNGX_Parameters : public NVSDK_NGX_Parameter
     }
 
   private:
+    // Known keys, no string building or locking for these
+    ParameterSlot m_slots[NGXParameterKeys::Count];
+
+    // Keys which are not in NGXParameterKeyNames
     ankerl::unordered_dense::map<std::string, Parameter> m_values;
     mutable std::mutex m_mutex;
 
     template <typename T> void setT(const char* key, T& value)
     {
+        Parameter p;
+        p.values.ull = 0;
+        p = value;
+
+        auto slot = NGXParameterKeys::Find(key);
+
+        if (NGXParameterCapture::IsActive())
+        {
+            NGXParameterCapture::RecordParameter(NGXCaptureOp::Set, this, key, slot, CaptureValueType<T>(),
+                                                 CaptureValueBits(value));
+        }
+
+        if (slot >= 0)
+        {
+            m_slots[slot].Store(p);
+            return;
+        }
+
         const std::lock_guard<std::mutex> lock(m_mutex);
-        m_values[key] = value;
+        m_values[key] = p;
     }
 
     template <typename T> NVSDK_NGX_Result getT(const char* key, T* value) const
     {
-        const std::lock_guard<std::mutex> lock(m_mutex);
-        auto k = m_values.find(key);
+        auto slot = NGXParameterKeys::Find(key);
+        auto result = getValue(key, slot, value);
+
+        if (NGXParameterCapture::IsActive())
+        {
+            auto success = result == NVSDK_NGX_Result_Success;
+            NGXParameterCapture::RecordParameter(NGXCaptureOp::Get, this, key, slot, CaptureValueType<T>(),
+                                                 success ? CaptureValueBits(*value) : 0, success);
+        }
+
+        return result;
+    }
+
+    template <typename T> NVSDK_NGX_Result getValue(const char* key, int32_t slot, T* value) const
+    {
+        Parameter p;
 
-        if (k == m_values.end())
+        if (slot >= 0)
         {
-            LOG_TRACE("('{0}', FAIL)", key);
-            return NVSDK_NGX_Result_Fail;
-        };
+            if (!m_slots[slot].Load(p))
+            {
+                LOG_TRACE("('{0}', FAIL)", key);
+                return NVSDK_NGX_Result_Fail;
+            }
+        }
+        else
+        {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            auto k = m_values.find(key);
+
+            if (k == m_values.end())
+            {
+                LOG_TRACE("('{0}', FAIL)", key);
+                return NVSDK_NGX_Result_Fail;
+            };
+
+            p = (*k).second;
+        }
 
-        const Parameter& p = (*k).second;
         *value = p;
 
         return NVSDK_NGX_Result_Success;
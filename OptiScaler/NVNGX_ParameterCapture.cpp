@@ -0,0 +1,179 @@
+#include <pch.h>
+
+#include "NVNGX_ParameterCapture.h"
+#include "NVNGX_ParameterKeys.h"
+
+#include <State.h>
+
+#include <ankerl/unordered_dense.h>
+
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+// Calls are recorded in order under one lock, NGX parameter traffic is dozens of calls per frame
+static std::mutex _captureMutex;
+static std::ofstream _captureFile;
+static bool _captureStarted = false;
+static uint64_t _capturedRecords = 0;
+static uint64_t _lastFrame = UINT64_MAX;
+
+// Known keys use their slot as id, unknown keys get ids after them
+static std::vector<bool> _namedKeys;
+static ankerl::unordered_dense::map<std::string, uint32_t> _unknownKeys;
+
+// Caller holds capture mutex
+static void WriteRecord(const NGXCaptureRecord& record)
+{
+    _captureFile.write((const char*) &record, sizeof(record));
+    _capturedRecords++;
+}
+
+// Caller holds capture mutex
+static void CheckFrame()
+{
+    auto frame = State::Instance().frameCount;
+
+    if (frame == _lastFrame)
+        return;
+
+    _lastFrame = frame;
+
+    NGXCaptureRecord record {};
+    record.op = NGXCaptureOp::Frame;
+    record.value = frame;
+    WriteRecord(record);
+
+    // Keeps the capture usable if the game is killed
+    _captureFile.flush();
+}
+
+// Caller holds capture mutex
+static uint32_t GetKeyId(const char* key, int32_t slot)
+{
+    uint32_t id = 0;
+
+    if (slot >= 0)
+    {
+        id = (uint32_t) slot;
+    }
+    else
+    {
+        auto [it, inserted] =
+            _unknownKeys.try_emplace(key, (uint32_t) (NGXParameterKeys::Count + _unknownKeys.size()));
+        id = it->second;
+    }
+
+    if (_namedKeys.size() <= id)
+        _namedKeys.resize(id + 1, false);
+
+    if (!_namedKeys[id])
+    {
+        _namedKeys[id] = true;
+
+        auto length = strlen(key);
+
+        NGXCaptureRecord record {};
+        record.op = NGXCaptureOp::KeyName;
+        record.keyId = id;
+        record.value = length;
+        WriteRecord(record);
+
+        _captureFile.write(key, length);
+    }
+
+    return id;
+}
+
+bool NGXParameterCapture::Start(const std::filesystem::path& fileName)
+{
+    if (IsActive())
+        return true;
+
+    std::lock_guard<std::mutex> lock(_captureMutex);
+
+    if (_captureFile.is_open())
+        return true;
+
+    // Key names written before Stop are still in the file, keep appending after them
+    _captureFile.open(fileName, std::ios::binary | (_captureStarted ? std::ios::app : std::ios::trunc));
+
+    if (!_captureFile.is_open())
+    {
+        LOG_ERROR("Can't open capture file: {}", wstring_to_string(fileName.wstring()));
+        return false;
+    }
+
+    if (!_captureStarted)
+    {
+        NGXCaptureHeader header {};
+        _captureFile.write((const char*) &header, sizeof(header));
+        _captureStarted = true;
+    }
+
+    _active.store(true, std::memory_order_release);
+    LOG_INFO("NGX parameter capture started: {}", wstring_to_string(fileName.wstring()));
+
+    return true;
+}
+
+void NGXParameterCapture::Stop()
+{
+    std::lock_guard<std::mutex> lock(_captureMutex);
+
+    if (!_captureFile.is_open())
+        return;
+
+    _active.store(false, std::memory_order_release);
+    _captureFile.close();
+
+    LOG_INFO("NGX parameter capture stopped, {} records", _capturedRecords);
+}
+
+void NGXParameterCapture::RecordParameter(NGXCaptureOp op, const void* parameters, const char* key, int32_t slot,
+                                          NGXCaptureValueType type, uint64_t value, bool success)
+{
+    if (!IsActive() || key == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> lock(_captureMutex);
+
+    if (!_captureFile.is_open())
+        return;
+
+    CheckFrame();
+
+    NGXCaptureRecord record {};
+    record.op = op;
+    record.type = (uint8_t) type;
+    record.result = success ? 0 : 1;
+    record.keyId = GetKeyId(key, slot);
+    record.parameters = (uint64_t) parameters;
+    record.value = value;
+    WriteRecord(record);
+}
+
+void NGXParameterCapture::RecordFeature(NGXCaptureOp op, NGXCaptureApi api, const void* parameters,
+                                        uint32_t handleId, uint32_t featureId)
+{
+    if (!IsActive())
+        return;
+
+    std::lock_guard<std::mutex> lock(_captureMutex);
+
+    if (!_captureFile.is_open())
+        return;
+
+    CheckFrame();
+
+    NGXCaptureRecord record {};
+    record.op = op;
+    record.type = (uint8_t) api;
+    record.keyId = featureId;
+    record.parameters = (uint64_t) parameters;
+    record.value = handleId;
+    WriteRecord(record);
+
+    if (op != NGXCaptureOp::EvaluateFeature)
+        _captureFile.flush();
+}
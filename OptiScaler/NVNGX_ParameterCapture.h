@@ -0,0 +1,96 @@
+#pragma once
+
+// Binary capture of NGX parameter and feature calls, for checking parameter handling of a game offline.
+//
+// File layout: NGXCaptureHeader followed by NGXCaptureRecord entries in call order. KeyName records carry
+// keyLength bytes of key text after them (no terminator), every key id is named once before its first use.
+// A Frame record is written when the swapchain frame counter changes between two recorded calls.
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+
+enum class NGXCaptureOp : uint8_t
+{
+    None = 0,
+    KeyName,
+    Frame,
+    Set,
+    Get,
+    CreateFeature,
+    EvaluateFeature,
+    ReleaseFeature,
+    Count
+};
+
+enum class NGXCaptureValueType : uint8_t
+{
+    None = 0,
+    Float,
+    Double,
+    Int,
+    UInt,
+    ULongLong,
+    VoidPtr,
+    D3D11Resource,
+    D3D12Resource,
+};
+
+enum class NGXCaptureApi : uint8_t
+{
+    None = 0,
+    Dx11,
+    Dx12,
+    Vulkan,
+};
+
+// Field usage of each op
+//   KeyName               keyId, value = keyLength
+//   Frame                 value = frame number
+//   Set/Get               parameters, keyId, value bits, valueType, result (Get only, 0 is success)
+//   CreateFeature         parameters, keyId = feature id, value = handle id, api
+//   EvaluateFeature       parameters, value = handle id, api
+//   ReleaseFeature        value = handle id, api
+struct NGXCaptureRecord
+{
+    NGXCaptureOp op = NGXCaptureOp::None;
+    uint8_t type = 0; // NGXCaptureValueType for Set/Get, NGXCaptureApi for feature ops
+    uint16_t result = 0;
+    uint32_t keyId = 0;
+    uint64_t parameters = 0;
+    uint64_t value = 0;
+};
+
+static_assert(sizeof(NGXCaptureRecord) == 24, "NGXCaptureRecord layout is part of the capture format");
+
+struct NGXCaptureHeader
+{
+    static constexpr uint32_t Magic = 0x4350474E; // "NGPC"
+    static constexpr uint32_t CurrentVersion = 1;
+
+    uint32_t magic = Magic;
+    uint32_t version = CurrentVersion;
+    uint32_t recordSize = sizeof(NGXCaptureRecord);
+    uint32_t reserved = 0;
+};
+
+class NGXParameterCapture
+{
+    inline static std::atomic<bool> _active { false };
+
+  public:
+    static bool IsActive() { return _active.load(std::memory_order_relaxed); }
+
+    // File is created by the first start, starting again after Stop appends to it
+    static bool Start(const std::filesystem::path& fileName);
+
+    // Called on NGX shutdown
+    static void Stop();
+
+    // slot is the NGXParameterKeys slot of the key or -1
+    static void RecordParameter(NGXCaptureOp op, const void* parameters, const char* key, int32_t slot,
+                                NGXCaptureValueType type, uint64_t value, bool success = true);
+
+    static void RecordFeature(NGXCaptureOp op, NGXCaptureApi api, const void* parameters, uint32_t handleId,
+                              uint32_t featureId = 0);
+};
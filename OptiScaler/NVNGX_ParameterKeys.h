@@ -0,0 +1,360 @@
+#pragma once
+#include <pch.h>
+
+#include <cstring>
+
+// Every NVSDK_NGX_Parameter_* and NVSDK_NGX_EParameter_* key of the NGX SDK, each one gets a fixed value slot in
+// NVNGX_Parameters. Keys which are not in this list are kept in a map.
+inline constexpr const char* NGXParameterKeyNames[] = {
+    NVSDK_NGX_EParameter_Reserved00,
+    NVSDK_NGX_EParameter_SuperSampling_Available,
+    NVSDK_NGX_EParameter_InPainting_Available,
+    NVSDK_NGX_EParameter_ImageSuperResolution_Available,
+    NVSDK_NGX_EParameter_SlowMotion_Available,
+    NVSDK_NGX_EParameter_VideoSuperResolution_Available,
+    NVSDK_NGX_EParameter_Reserved06,
+    NVSDK_NGX_EParameter_Reserved07,
+    NVSDK_NGX_EParameter_Reserved08,
+    NVSDK_NGX_EParameter_ImageSignalProcessing_Available,
+    NVSDK_NGX_EParameter_ImageSuperResolution_ScaleFactor_2_1,
+    NVSDK_NGX_EParameter_ImageSuperResolution_ScaleFactor_3_1,
+    NVSDK_NGX_EParameter_ImageSuperResolution_ScaleFactor_3_2,
+    NVSDK_NGX_EParameter_ImageSuperResolution_ScaleFactor_4_3,
+    NVSDK_NGX_EParameter_NumFrames,
+    NVSDK_NGX_EParameter_Scale,
+    NVSDK_NGX_EParameter_Width,
+    NVSDK_NGX_EParameter_Height,
+    NVSDK_NGX_EParameter_OutWidth,
+    NVSDK_NGX_EParameter_OutHeight,
+    NVSDK_NGX_EParameter_Sharpness,
+    NVSDK_NGX_EParameter_Scratch,
+    NVSDK_NGX_EParameter_Scratch_SizeInBytes,
+    NVSDK_NGX_EParameter_EvaluationNode,
+    NVSDK_NGX_EParameter_Input1,
+    NVSDK_NGX_EParameter_Input1_Format,
+    NVSDK_NGX_EParameter_Input1_SizeInBytes,
+    NVSDK_NGX_EParameter_Input2,
+    NVSDK_NGX_EParameter_Input2_Format,
+    NVSDK_NGX_EParameter_Input2_SizeInBytes,
+    NVSDK_NGX_EParameter_Color,
+    NVSDK_NGX_EParameter_Color_Format,
+    NVSDK_NGX_EParameter_Color_SizeInBytes,
+    NVSDK_NGX_EParameter_Albedo,
+    NVSDK_NGX_EParameter_Output,
+    NVSDK_NGX_EParameter_Output_Format,
+    NVSDK_NGX_EParameter_Output_SizeInBytes,
+    NVSDK_NGX_EParameter_Reset,
+    NVSDK_NGX_EParameter_BlendFactor,
+    NVSDK_NGX_EParameter_MotionVectors,
+    NVSDK_NGX_EParameter_Rect_X,
+    NVSDK_NGX_EParameter_Rect_Y,
+    NVSDK_NGX_EParameter_Rect_W,
+    NVSDK_NGX_EParameter_Rect_H,
+    NVSDK_NGX_EParameter_MV_Scale_X,
+    NVSDK_NGX_EParameter_MV_Scale_Y,
+    NVSDK_NGX_EParameter_Model,
+    NVSDK_NGX_EParameter_Format,
+    NVSDK_NGX_EParameter_SizeInBytes,
+    NVSDK_NGX_EParameter_ResourceAllocCallback,
+    NVSDK_NGX_EParameter_BufferAllocCallback,
+    NVSDK_NGX_EParameter_Tex2DAllocCallback,
+    NVSDK_NGX_EParameter_ResourceReleaseCallback,
+    NVSDK_NGX_EParameter_CreationNodeMask,
+    NVSDK_NGX_EParameter_VisibilityNodeMask,
+    NVSDK_NGX_EParameter_PreviousOutput,
+    NVSDK_NGX_EParameter_MV_Offset_X,
+    NVSDK_NGX_EParameter_MV_Offset_Y,
+    NVSDK_NGX_EParameter_Hint_UseFireflySwatter,
+    NVSDK_NGX_EParameter_Resource_Width,
+    NVSDK_NGX_EParameter_Resource_Height,
+    NVSDK_NGX_EParameter_Depth,
+    NVSDK_NGX_EParameter_DLSSOptimalSettingsCallback,
+    NVSDK_NGX_EParameter_PerfQualityValue,
+    NVSDK_NGX_EParameter_RTXValue,
+    NVSDK_NGX_EParameter_DLSSMode,
+    NVSDK_NGX_EParameter_DeepResolve_Available,
+    NVSDK_NGX_EParameter_Deprecated_43,
+    NVSDK_NGX_EParameter_OptLevel,
+    NVSDK_NGX_EParameter_IsDevSnippetBranch,
+    NVSDK_NGX_EParameter_DeepDVC_Available,
+    NVSDK_NGX_EParameter_Graphics_API,
+    NVSDK_NGX_EParameter_Reserved_48,
+    NVSDK_NGX_EParameter_Reserved_49,
+    NVSDK_NGX_Parameter_OptLevel,
+    NVSDK_NGX_Parameter_IsDevSnippetBranch,
+    NVSDK_NGX_Parameter_SuperSampling_ScaleFactor,
+    NVSDK_NGX_Parameter_ImageSignalProcessing_ScaleFactor,
+    NVSDK_NGX_Parameter_SuperSampling_Available,
+    NVSDK_NGX_Parameter_InPainting_Available,
+    NVSDK_NGX_Parameter_ImageSuperResolution_Available,
+    NVSDK_NGX_Parameter_SlowMotion_Available,
+    NVSDK_NGX_Parameter_VideoSuperResolution_Available,
+    NVSDK_NGX_Parameter_ImageSignalProcessing_Available,
+    NVSDK_NGX_Parameter_DeepResolve_Available,
+    NVSDK_NGX_Parameter_SuperSampling_NeedsUpdatedDriver,
+    NVSDK_NGX_Parameter_InPainting_NeedsUpdatedDriver,
+    NVSDK_NGX_Parameter_ImageSuperResolution_NeedsUpdatedDriver,
+    NVSDK_NGX_Parameter_SlowMotion_NeedsUpdatedDriver,
+    NVSDK_NGX_Parameter_VideoSuperResolution_NeedsUpdatedDriver,
+    NVSDK_NGX_Parameter_ImageSignalProcessing_NeedsUpdatedDriver,
+    NVSDK_NGX_Parameter_DeepResolve_NeedsUpdatedDriver,
+    NVSDK_NGX_Parameter_FrameInterpolation_NeedsUpdatedDriver,
+    NVSDK_NGX_Parameter_SuperSampling_MinDriverVersionMajor,
+    NVSDK_NGX_Parameter_InPainting_MinDriverVersionMajor,
+    NVSDK_NGX_Parameter_ImageSuperResolution_MinDriverVersionMajor,
+    NVSDK_NGX_Parameter_SlowMotion_MinDriverVersionMajor,
+    NVSDK_NGX_Parameter_VideoSuperResolution_MinDriverVersionMajor,
+    NVSDK_NGX_Parameter_ImageSignalProcessing_MinDriverVersionMajor,
+    NVSDK_NGX_Parameter_DeepResolve_MinDriverVersionMajor,
+    NVSDK_NGX_Parameter_FrameInterpolation_MinDriverVersionMajor,
+    NVSDK_NGX_Parameter_SuperSampling_MinDriverVersionMinor,
+    NVSDK_NGX_Parameter_InPainting_MinDriverVersionMinor,
+    NVSDK_NGX_Parameter_ImageSuperResolution_MinDriverVersionMinor,
+    NVSDK_NGX_Parameter_SlowMotion_MinDriverVersionMinor,
+    NVSDK_NGX_Parameter_VideoSuperResolution_MinDriverVersionMinor,
+    NVSDK_NGX_Parameter_ImageSignalProcessing_MinDriverVersionMinor,
+    NVSDK_NGX_Parameter_DeepResolve_MinDriverVersionMinor,
+    NVSDK_NGX_Parameter_SuperSampling_FeatureInitResult,
+    NVSDK_NGX_Parameter_InPainting_FeatureInitResult,
+    NVSDK_NGX_Parameter_ImageSuperResolution_FeatureInitResult,
+    NVSDK_NGX_Parameter_SlowMotion_FeatureInitResult,
+    NVSDK_NGX_Parameter_VideoSuperResolution_FeatureInitResult,
+    NVSDK_NGX_Parameter_ImageSignalProcessing_FeatureInitResult,
+    NVSDK_NGX_Parameter_DeepResolve_FeatureInitResult,
+    NVSDK_NGX_Parameter_FrameInterpolation_FeatureInitResult,
+    NVSDK_NGX_Parameter_ImageSuperResolution_ScaleFactor_2_1,
+    NVSDK_NGX_Parameter_ImageSuperResolution_ScaleFactor_3_1,
+    NVSDK_NGX_Parameter_ImageSuperResolution_ScaleFactor_3_2,
+    NVSDK_NGX_Parameter_ImageSuperResolution_ScaleFactor_4_3,
+    NVSDK_NGX_Parameter_NumFrames,
+    NVSDK_NGX_Parameter_Scale,
+    NVSDK_NGX_Parameter_Width,
+    NVSDK_NGX_Parameter_Height,
+    NVSDK_NGX_Parameter_OutWidth,
+    NVSDK_NGX_Parameter_OutHeight,
+    NVSDK_NGX_Parameter_Sharpness,
+    NVSDK_NGX_Parameter_Scratch,
+    NVSDK_NGX_Parameter_Scratch_SizeInBytes,
+    NVSDK_NGX_Parameter_Input1,
+    NVSDK_NGX_Parameter_Input1_Format,
+    NVSDK_NGX_Parameter_Input1_SizeInBytes,
+    NVSDK_NGX_Parameter_Input2,
+    NVSDK_NGX_Parameter_Input2_Format,
+    NVSDK_NGX_Parameter_Input2_SizeInBytes,
+    NVSDK_NGX_Parameter_Color,
+    NVSDK_NGX_Parameter_Color_Format,
+    NVSDK_NGX_Parameter_Color_SizeInBytes,
+    NVSDK_NGX_Parameter_FI_Color1,
+    NVSDK_NGX_Parameter_FI_Color2,
+    NVSDK_NGX_Parameter_Albedo,
+    NVSDK_NGX_Parameter_Output,
+    NVSDK_NGX_Parameter_Output_Format,
+    NVSDK_NGX_Parameter_Output_SizeInBytes,
+    NVSDK_NGX_Parameter_FI_Output1,
+    NVSDK_NGX_Parameter_FI_Output2,
+    NVSDK_NGX_Parameter_FI_Output3,
+    NVSDK_NGX_Parameter_Reset,
+    NVSDK_NGX_Parameter_BlendFactor,
+    NVSDK_NGX_Parameter_MotionVectors,
+    NVSDK_NGX_Parameter_FI_MotionVectors1,
+    NVSDK_NGX_Parameter_FI_MotionVectors2,
+    NVSDK_NGX_Parameter_Rect_X,
+    NVSDK_NGX_Parameter_Rect_Y,
+    NVSDK_NGX_Parameter_Rect_W,
+    NVSDK_NGX_Parameter_Rect_H,
+    NVSDK_NGX_Parameter_OutRect_X,
+    NVSDK_NGX_Parameter_OutRect_Y,
+    NVSDK_NGX_Parameter_OutRect_W,
+    NVSDK_NGX_Parameter_OutRect_H,
+    NVSDK_NGX_Parameter_MV_Scale_X,
+    NVSDK_NGX_Parameter_MV_Scale_Y,
+    NVSDK_NGX_Parameter_Model,
+    NVSDK_NGX_Parameter_Format,
+    NVSDK_NGX_Parameter_SizeInBytes,
+    NVSDK_NGX_Parameter_ResourceAllocCallback,
+    NVSDK_NGX_Parameter_BufferAllocCallback,
+    NVSDK_NGX_Parameter_Tex2DAllocCallback,
+    NVSDK_NGX_Parameter_ResourceReleaseCallback,
+    NVSDK_NGX_Parameter_CreationNodeMask,
+    NVSDK_NGX_Parameter_VisibilityNodeMask,
+    NVSDK_NGX_Parameter_MV_Offset_X,
+    NVSDK_NGX_Parameter_MV_Offset_Y,
+    NVSDK_NGX_Parameter_Hint_UseFireflySwatter,
+    NVSDK_NGX_Parameter_Resource_Width,
+    NVSDK_NGX_Parameter_Resource_Height,
+    NVSDK_NGX_Parameter_Resource_OutWidth,
+    NVSDK_NGX_Parameter_Resource_OutHeight,
+    NVSDK_NGX_Parameter_Depth,
+    NVSDK_NGX_Parameter_FI_Depth1,
+    NVSDK_NGX_Parameter_FI_Depth2,
+    NVSDK_NGX_Parameter_DLSSOptimalSettingsCallback,
+    NVSDK_NGX_Parameter_DLSSGetStatsCallback,
+    NVSDK_NGX_Parameter_PerfQualityValue,
+    NVSDK_NGX_Parameter_RTXValue,
+    NVSDK_NGX_Parameter_DLSSMode,
+    NVSDK_NGX_Parameter_FI_Mode,
+    NVSDK_NGX_Parameter_FI_OF_Preset,
+    NVSDK_NGX_Parameter_FI_OF_GridSize,
+    NVSDK_NGX_Parameter_Jitter_Offset_X,
+    NVSDK_NGX_Parameter_Jitter_Offset_Y,
+    NVSDK_NGX_Parameter_Denoise,
+    NVSDK_NGX_Parameter_TransparencyMask,
+    NVSDK_NGX_Parameter_ExposureTexture,
+    NVSDK_NGX_Parameter_DLSS_Feature_Create_Flags,
+    NVSDK_NGX_Parameter_DLSS_Checkerboard_Jitter_Hack,
+    NVSDK_NGX_Parameter_GBuffer_Normals,
+    NVSDK_NGX_Parameter_GBuffer_Albedo,
+    NVSDK_NGX_Parameter_GBuffer_Roughness,
+    NVSDK_NGX_Parameter_GBuffer_DiffuseAlbedo,
+    NVSDK_NGX_Parameter_GBuffer_SpecularAlbedo,
+    NVSDK_NGX_Parameter_GBuffer_IndirectAlbedo,
+    NVSDK_NGX_Parameter_GBuffer_SpecularMvec,
+    NVSDK_NGX_Parameter_GBuffer_DisocclusionMask,
+    NVSDK_NGX_Parameter_GBuffer_Metallic,
+    NVSDK_NGX_Parameter_GBuffer_Specular,
+    NVSDK_NGX_Parameter_GBuffer_Subsurface,
+    NVSDK_NGX_Parameter_GBuffer_ShadingModelId,
+    NVSDK_NGX_Parameter_GBuffer_MaterialId,
+    NVSDK_NGX_Parameter_GBuffer_Atrrib_8,
+    NVSDK_NGX_Parameter_GBuffer_Atrrib_9,
+    NVSDK_NGX_Parameter_GBuffer_Atrrib_10,
+    NVSDK_NGX_Parameter_GBuffer_Atrrib_11,
+    NVSDK_NGX_Parameter_GBuffer_Atrrib_12,
+    NVSDK_NGX_Parameter_GBuffer_Atrrib_13,
+    NVSDK_NGX_Parameter_GBuffer_Atrrib_14,
+    NVSDK_NGX_Parameter_GBuffer_Atrrib_15,
+    NVSDK_NGX_Parameter_TonemapperType,
+    NVSDK_NGX_Parameter_FreeMemOnReleaseFeature,
+    NVSDK_NGX_Parameter_MotionVectors3D,
+    NVSDK_NGX_Parameter_IsParticleMask,
+    NVSDK_NGX_Parameter_AnimatedTextureMask,
+    NVSDK_NGX_Parameter_DepthHighRes,
+    NVSDK_NGX_Parameter_Position_ViewSpace,
+    NVSDK_NGX_Parameter_FrameTimeDeltaInMsec,
+    NVSDK_NGX_Parameter_RayTracingHitDistance,
+    NVSDK_NGX_Parameter_MotionVectorsReflection,
+    NVSDK_NGX_Parameter_DLSS_Enable_Output_Subrects,
+    NVSDK_NGX_Parameter_DLSS_Input_Color_Subrect_Base_X,
+    NVSDK_NGX_Parameter_DLSS_Input_Color_Subrect_Base_Y,
+    NVSDK_NGX_Parameter_DLSS_Input_Depth_Subrect_Base_X,
+    NVSDK_NGX_Parameter_DLSS_Input_Depth_Subrect_Base_Y,
+    NVSDK_NGX_Parameter_DLSS_Input_MV_SubrectBase_X,
+    NVSDK_NGX_Parameter_DLSS_Input_MV_SubrectBase_Y,
+    NVSDK_NGX_Parameter_DLSS_Input_Translucency_SubrectBase_X,
+    NVSDK_NGX_Parameter_DLSS_Input_Translucency_SubrectBase_Y,
+    NVSDK_NGX_Parameter_DLSS_Output_Subrect_Base_X,
+    NVSDK_NGX_Parameter_DLSS_Output_Subrect_Base_Y,
+    NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width,
+    NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height,
+    NVSDK_NGX_Parameter_DLSS_Pre_Exposure,
+    NVSDK_NGX_Parameter_DLSS_Exposure_Scale,
+    NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_Mask,
+    NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_SubrectBase_X,
+    NVSDK_NGX_Parameter_DLSS_Input_Bias_Current_Color_SubrectBase_Y,
+    NVSDK_NGX_Parameter_DLSS_Indicator_Invert_Y_Axis,
+    NVSDK_NGX_Parameter_DLSS_Indicator_Invert_X_Axis,
+    NVSDK_NGX_Parameter_DLSS_INV_VIEW_PROJECTION_MATRIX,
+    NVSDK_NGX_Parameter_DLSS_CLIP_TO_PREV_CLIP_MATRIX,
+    NVSDK_NGX_Parameter_DLSS_TransparencyLayer,
+    NVSDK_NGX_Parameter_DLSS_TransparencyLayer_Subrect_Base_X,
+    NVSDK_NGX_Parameter_DLSS_TransparencyLayer_Subrect_Base_Y,
+    NVSDK_NGX_Parameter_DLSS_TransparencyLayerOpacity,
+    NVSDK_NGX_Parameter_DLSS_TransparencyLayerOpacity_Subrect_Base_X,
+    NVSDK_NGX_Parameter_DLSS_TransparencyLayerOpacity_Subrect_Base_Y,
+    NVSDK_NGX_Parameter_DLSS_TransparencyLayerMvecs,
+    NVSDK_NGX_Parameter_DLSS_TransparencyLayerMvecs_Subrect_Base_X,
+    NVSDK_NGX_Parameter_DLSS_TransparencyLayerMvecs_Subrect_Base_Y,
+    NVSDK_NGX_Parameter_DLSS_DisocclusionMask,
+    NVSDK_NGX_Parameter_DLSS_DisocclusionMask_Subrect_Base_X,
+    NVSDK_NGX_Parameter_DLSS_DisocclusionMask_Subrect_Base_Y,
+    NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Width,
+    NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Height,
+    NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Width,
+    NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Height,
+    NVSDK_NGX_Parameter_DLSS_Hint_Render_Preset_DLAA,
+    NVSDK_NGX_Parameter_DLSS_Hint_Render_Preset_Quality,
+    NVSDK_NGX_Parameter_DLSS_Hint_Render_Preset_Balanced,
+    NVSDK_NGX_Parameter_DLSS_Hint_Render_Preset_Performance,
+    NVSDK_NGX_Parameter_DLSS_Hint_Render_Preset_UltraPerformance,
+    NVSDK_NGX_Parameter_DLSS_Hint_Render_Preset_UltraQuality,
+};
+
+class NGXParameterKeys
+{
+  public:
+    static constexpr size_t Count = std::size(NGXParameterKeyNames);
+
+    // Slot of the key, -1 for keys which are not in the list
+    static int32_t Find(const char* key)
+    {
+        if (key == nullptr)
+            return -1;
+
+        auto hash = Hash(key);
+
+        for (auto i = hash & TableMask;; i = (i + 1) & TableMask)
+        {
+            auto entry = _table.entries[i];
+
+            if (entry == 0)
+                return -1;
+
+            if (_table.hashes[entry - 1] == hash && std::strcmp(NGXParameterKeyNames[entry - 1], key) == 0)
+                return entry - 1;
+        }
+    }
+
+    static constexpr const char* Name(size_t slot) { return NGXParameterKeyNames[slot]; }
+
+  private:
+    // Power of 2 and under 1/4 full, probes stay short
+    static constexpr size_t TableSize = 2048;
+    static constexpr size_t TableMask = TableSize - 1;
+
+    static_assert(Count * 4 <= TableSize, "Parameter key table is too small");
+
+    struct Table
+    {
+        // Slot + 1, 0 is empty
+        uint16_t entries[TableSize] {};
+        uint64_t hashes[Count] {};
+    };
+
+    static constexpr uint64_t Hash(const char* key)
+    {
+        uint64_t hash = 0xCBF29CE484222325ull;
+
+        for (; *key != 0; key++)
+        {
+            hash ^= (uint8_t) *key;
+            hash *= 0x100000001B3ull;
+        }
+
+        return hash;
+    }
+
+    static constexpr Table Build()
+    {
+        Table table {};
+
+        for (size_t slot = 0; slot < Count; slot++)
+        {
+            auto hash = Hash(NGXParameterKeyNames[slot]);
+            table.hashes[slot] = hash;
+
+            auto i = hash & TableMask;
+
+            while (table.entries[i] != 0)
+                i = (i + 1) & TableMask;
+
+            table.entries[i] = (uint16_t) (slot + 1);
+        }
+
+        return table;
+    }
+
+    // Defined after the class, Build can't run in a constant expression before that
+    static const Table _table;
+};
+
+inline constexpr NGXParameterKeys::Table NGXParameterKeys::_table = NGXParameterKeys::Build();
@@ -5,6 +5,7 @@
 #include "Logger.h"
 #include "resource.h"
 #include "DllNames.h"
+#include "DllNameMatcher.h"
 
 #include "proxies/Dxgi_Proxy.h"
 #include <proxies/XeSS_Proxy.h>
@@ -38,6 +39,7 @@
 #include <hooks/Ntdll_Hooks.h>
 #include <hooks/Kernel_Hooks.h>
 #include <nvapi/NvApiHooks.h>
+#include <misc/DeferredInit.h>
 
 #include <cwctype>
 #include <version_check.h>
@@ -710,6 +712,9 @@ static void CheckWorkingMode()
     if (_passThruMode)
         return;
 
+    // Opti's own names are known now, load checks done so far used the lists without them
+    DllNameMatcher::Build();
+
     if (modeFound)
     {
         Config::Instance()->CheckUpscalerFiles();
@@ -1888,6 +1893,11 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserv
             }
         }
 
+        // Exe hooks scan the game exe for patterns, which is too slow to do while the loader lock is held.
+        // They run on the first device creation or library load, before the game can create its FSR contexts.
+        bool hookFsr2Exe = false;
+        bool hookFsr3Exe = false;
+
         if (Config::Instance()->EnableFsr2Inputs.value_or_default())
         {
             spdlog::info("");
@@ -1906,7 +1916,7 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserv
                 if (handle != nullptr)
                     HookFSR2Dx12Inputs(handle);
 
-                HookFSR2ExeInputs();
+                hookFsr2Exe = true;
             }
         }
 
@@ -1920,7 +1930,20 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD ul_reason_for_call, LPVOID lpReserv
             if (handle != nullptr)
                 HookFSR3Dx12Inputs(handle);
 
-            HookFSR3ExeInputs();
+            hookFsr3Exe = true;
+        }
+
+        if (hookFsr2Exe || hookFsr3Exe)
+        {
+            DeferredInit::Add(
+                [hookFsr2Exe, hookFsr3Exe]()
+                {
+                    if (hookFsr2Exe)
+                        HookFSR2ExeInputs();
+
+                    if (hookFsr3Exe)
+                        HookFSR3ExeInputs();
+                });
         }
         // HookFfxExeInputs();
 
@@ -0,0 +1,69 @@
+#pragma once
+#include <pch.h>
+#include "IFGFeature.h"
+
+#include <array>
+#include <atomic>
+
+// Per frame FG resource state for BUFFER_COUNT frames, indexed by frame index and FG_ResourceType.
+//
+// Inputs (game's render thread) fill an entry and then publish it, Present/Dispatch only reads entries which are
+// published for that frame. Publishing is a release store and checks are acquire loads so tagging never waits
+// for the present thread. Reset clears the published and ready bits when a slot is reused for a new frame,
+// entries keep their old contents until they are filled again.
+template <typename TEntry> class FG_FrameRing
+{
+    struct Slot
+    {
+        std::array<TEntry, FG_ResourceType::ResourceTypeCOUNT> entries {};
+        std::atomic<uint32_t> published { 0 };
+        std::atomic<uint32_t> ready { 0 };
+    };
+
+    Slot _slots[BUFFER_COUNT] {};
+
+    static constexpr uint32_t Bit(FG_ResourceType type) { return 1u << (uint32_t) type; }
+
+    static_assert(FG_ResourceType::ResourceTypeCOUNT <= 32, "FG resource types must fit in the slot bit masks");
+
+  public:
+    // Raw entry access for the producer, contents are only meaningful when published
+    TEntry& Entry(int index, FG_ResourceType type) { return _slots[index].entries[type]; }
+
+    // Returns nullptr when entry is not published for this frame
+    TEntry* Get(int index, FG_ResourceType type)
+    {
+        return IsPublished(index, type) ? &_slots[index].entries[type] : nullptr;
+    }
+
+    bool IsPublished(int index, FG_ResourceType type) const
+    {
+        return (_slots[index].published.load(std::memory_order_acquire) & Bit(type)) != 0;
+    }
+
+    void Publish(int index, FG_ResourceType type)
+    {
+        _slots[index].published.fetch_or(Bit(type), std::memory_order_release);
+    }
+
+    void Unpublish(int index, FG_ResourceType type)
+    {
+        _slots[index].published.fetch_and(~Bit(type), std::memory_order_release);
+    }
+
+    bool IsReady(int index, FG_ResourceType type) const
+    {
+        return (_slots[index].ready.load(std::memory_order_acquire) & Bit(type)) != 0;
+    }
+
+    void SetReady(int index, FG_ResourceType type)
+    {
+        _slots[index].ready.fetch_or(Bit(type), std::memory_order_release);
+    }
+
+    void Reset(int index)
+    {
+        _slots[index].ready.store(0, std::memory_order_release);
+        _slots[index].published.store(0, std::memory_order_release);
+    }
+};
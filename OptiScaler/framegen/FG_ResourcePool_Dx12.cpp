@@ -0,0 +1,360 @@
+#include "FG_ResourcePool_Dx12.h"
+
+#include <algorithm>
+
+static UINT64 AlignUp(UINT64 value, UINT64 alignment)
+{
+    if (alignment == 0)
+        return value;
+
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+FG_ResourcePool_Dx12::HeapClass FG_ResourcePool_Dx12::GetHeapClass(const D3D12_RESOURCE_DESC& desc)
+{
+    if (desc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER)
+        return HeapClass::Buffers;
+
+    if (desc.Flags & (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL))
+        return HeapClass::RtDsTextures;
+
+    return HeapClass::Textures;
+}
+
+bool FG_ResourcePool_Dx12::IsSameDesc(const D3D12_RESOURCE_DESC& a, const D3D12_RESOURCE_DESC& b)
+{
+    return a.Dimension == b.Dimension && a.Alignment == b.Alignment && a.Width == b.Width && a.Height == b.Height &&
+           a.DepthOrArraySize == b.DepthOrArraySize && a.MipLevels == b.MipLevels && a.Format == b.Format &&
+           a.SampleDesc.Count == b.SampleDesc.Count && a.SampleDesc.Quality == b.SampleDesc.Quality &&
+           a.Layout == b.Layout && a.Flags == b.Flags;
+}
+
+size_t FG_ResourcePool_Dx12::FindRange(HeapClass heapClass, UINT64 size, UINT64 alignment, Range& range)
+{
+    for (size_t i = 0; i < _heaps.size(); i++)
+    {
+        auto& heap = _heaps[i];
+
+        if (heap.heapClass != heapClass)
+            continue;
+
+        for (size_t j = 0; j < heap.free.size(); j++)
+        {
+            auto freeRange = heap.free[j];
+            auto offset = AlignUp(freeRange.offset, alignment);
+            auto end = freeRange.offset + freeRange.size;
+
+            if (offset + size > end)
+                continue;
+
+            heap.free.erase(heap.free.begin() + j);
+
+            if (offset > freeRange.offset)
+                heap.free.push_back({ freeRange.offset, offset - freeRange.offset });
+
+            if (offset + size < end)
+                heap.free.push_back({ offset + size, end - offset - size });
+
+            range = { offset, size };
+            return i;
+        }
+    }
+
+    return NoHeap;
+}
+
+void FG_ResourcePool_Dx12::ReturnRange(size_t heapIndex, Range range)
+{
+    auto& free = _heaps[heapIndex].free;
+    free.push_back(range);
+
+    std::sort(free.begin(), free.end(), [](const Range& a, const Range& b) { return a.offset < b.offset; });
+
+    // Merge neighbours
+    size_t last = 0;
+    for (size_t i = 1; i < free.size(); i++)
+    {
+        if (free[last].offset + free[last].size == free[i].offset)
+            free[last].size += free[i].size;
+        else
+            free[++last] = free[i];
+    }
+
+    free.resize(last + 1);
+}
+
+void FG_ResourcePool_Dx12::FreeAllocation(Allocation& allocation)
+{
+    if (allocation.resource != nullptr)
+    {
+        // Owner may still hold it, e.g. hudless copies are read without another Acquire
+        if (allocation.owner != nullptr && *allocation.owner == allocation.resource)
+            *allocation.owner = nullptr;
+
+        allocation.resource->Release();
+        allocation.resource = nullptr;
+    }
+
+    if (allocation.heapIndex >= 0)
+        ReturnRange(allocation.heapIndex, allocation.range);
+
+    _usedBytes -= allocation.size;
+}
+
+// Frees allocations accepted by filter which weren't used for RetireFrames frames
+template <typename F> bool FG_ResourcePool_Dx12::EvictRetired(UINT64 frame, F&& filter)
+{
+    auto evicted = false;
+
+    for (size_t i = 0; i < _allocations.size();)
+    {
+        auto& allocation = _allocations[i];
+
+        if (allocation.lastUsedFrame + RetireFrames >= frame || !filter(allocation))
+        {
+            i++;
+            continue;
+        }
+
+        LOG_DEBUG("Evicting {}x{} unused since frame {}", allocation.desc.Width, allocation.desc.Height,
+                  allocation.lastUsedFrame);
+
+        FreeAllocation(allocation);
+        _allocations.erase(_allocations.begin() + i);
+        evicted = true;
+    }
+
+    return evicted;
+}
+
+bool FG_ResourcePool_Dx12::CanInitialize(ID3D12GraphicsCommandList* cmdList, HeapClass heapClass)
+{
+    if (cmdList == nullptr)
+        return false;
+
+    // DiscardResource of render targets and depth stencils is only allowed on direct lists
+    return heapClass != HeapClass::RtDsTextures || cmdList->GetType() == D3D12_COMMAND_LIST_TYPE_DIRECT;
+}
+
+void FG_ResourcePool_Dx12::InitializePlaced(ID3D12GraphicsCommandList* cmdList, ID3D12Resource* resource,
+                                            HeapClass heapClass, D3D12_RESOURCE_STATES createState,
+                                            D3D12_RESOURCE_STATES state)
+{
+    // Memory may have been used by an evicted resource or never been touched
+    D3D12_RESOURCE_BARRIER barrier = {};
+    barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_ALIASING;
+    barrier.Aliasing.pResourceBefore = nullptr;
+    barrier.Aliasing.pResourceAfter = resource;
+    cmdList->ResourceBarrier(1, &barrier);
+
+    if (heapClass != HeapClass::RtDsTextures)
+        return;
+
+    // Placed render targets and depth stencils must be cleared, discarded or fully copied before first use
+    cmdList->DiscardResource(resource, nullptr);
+
+    if (createState != state)
+    {
+        barrier = {};
+        barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+        barrier.Transition.pResource = resource;
+        barrier.Transition.StateBefore = createState;
+        barrier.Transition.StateAfter = state;
+        barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+        cmdList->ResourceBarrier(1, &barrier);
+    }
+}
+
+bool FG_ResourcePool_Dx12::Acquire(ID3D12Device* InDevice, const D3D12_HEAP_PROPERTIES& InHeapProperties,
+                                   const D3D12_RESOURCE_DESC& InDesc, D3D12_RESOURCE_STATES InState,
+                                   ID3D12Resource** InOwner, UINT64 InFrame, ID3D12GraphicsCommandList* InCmdList,
+                                   ID3D12Resource** OutResource, bool* OutCreated)
+{
+    if (OutCreated != nullptr)
+        *OutCreated = false;
+
+    if (InDevice == nullptr || OutResource == nullptr)
+        return false;
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_device != InDevice)
+    {
+        ReleaseLocked();
+        _device = InDevice;
+    }
+
+    // Nothing else can use the memory of committed resources, release them as soon as they retire
+    if (_committedCheckFrame != InFrame)
+    {
+        _committedCheckFrame = InFrame;
+        EvictRetired(InFrame, [](const Allocation& allocation) { return allocation.heapIndex < 0; });
+    }
+
+    for (auto& allocation : _allocations)
+    {
+        if (allocation.owner == InOwner && IsSameDesc(allocation.desc, InDesc))
+        {
+            allocation.lastUsedFrame = InFrame;
+            *OutResource = allocation.resource;
+            return true;
+        }
+    }
+
+    Allocation allocation {};
+    allocation.owner = InOwner;
+    allocation.desc = InDesc;
+    allocation.lastUsedFrame = InFrame;
+
+    auto info = InDevice->GetResourceAllocationInfo(0, 1, &InDesc);
+    allocation.size = info.SizeInBytes;
+
+    auto heapClass = GetHeapClass(InDesc);
+
+    // Only default heaps are pooled, others use a committed resource like before.
+    // First use of placed memory must be recorded on a cmdList, without one a committed resource is used.
+    if (InHeapProperties.Type == D3D12_HEAP_TYPE_DEFAULT && info.SizeInBytes != UINT64_MAX &&
+        CanInitialize(InCmdList, heapClass))
+    {
+        Range range {};
+
+        auto heapIndex = FindRange(heapClass, info.SizeInBytes, info.Alignment, range);
+
+        auto placedInClass = [this, heapClass](const Allocation& allocation)
+        { return allocation.heapIndex >= 0 && _heaps[allocation.heapIndex].heapClass == heapClass; };
+
+        if (heapIndex == NoHeap && EvictRetired(InFrame, placedInClass))
+            heapIndex = FindRange(heapClass, info.SizeInBytes, info.Alignment, range);
+
+        if (heapIndex == NoHeap)
+        {
+            D3D12_HEAP_DESC heapDesc {};
+            heapDesc.SizeInBytes = std::max(HeapBlockSize, AlignUp(info.SizeInBytes, info.Alignment));
+            heapDesc.Properties = InHeapProperties;
+            heapDesc.Alignment = D3D12_DEFAULT_MSAA_RESOURCE_PLACEMENT_ALIGNMENT;
+
+            if (heapClass == HeapClass::Buffers)
+                heapDesc.Flags = D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS;
+            else if (heapClass == HeapClass::RtDsTextures)
+                heapDesc.Flags = D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES;
+            else
+                heapDesc.Flags = D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES;
+
+            Heap heap {};
+            auto hr = InDevice->CreateHeap(&heapDesc, IID_PPV_ARGS(&heap.heap));
+
+            if (hr == S_OK)
+            {
+                heap.heap->SetName(L"FG_ResourcePool_Dx12");
+                heap.heapClass = heapClass;
+                heap.size = heapDesc.SizeInBytes;
+                heap.free.push_back({ 0, heap.size });
+
+                _heaps.push_back(heap);
+                _reservedBytes += heap.size;
+
+                LOG_INFO("New heap: {} MB, pool reserved: {} MB, used: {} MB", heap.size >> 20, _reservedBytes >> 20,
+                         _usedBytes >> 20);
+
+                heapIndex = FindRange(heapClass, info.SizeInBytes, info.Alignment, range);
+            }
+            else
+            {
+                LOG_ERROR("CreateHeap result: {:X}", (UINT64) hr);
+            }
+        }
+
+        if (heapIndex != NoHeap)
+        {
+            // Render target and depth stencil textures are discarded before use, which needs these states
+            auto createState = InState;
+            if (heapClass == HeapClass::RtDsTextures)
+            {
+                createState = (InDesc.Flags & D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL)
+                                  ? D3D12_RESOURCE_STATE_DEPTH_WRITE
+                                  : D3D12_RESOURCE_STATE_RENDER_TARGET;
+            }
+
+            auto hr = InDevice->CreatePlacedResource(_heaps[heapIndex].heap, range.offset, &InDesc, createState,
+                                                     nullptr, IID_PPV_ARGS(&allocation.resource));
+
+            if (hr == S_OK)
+            {
+                allocation.heapIndex = (int) heapIndex;
+                allocation.range = range;
+
+                InitializePlaced(InCmdList, allocation.resource, heapClass, createState, InState);
+            }
+            else
+            {
+                LOG_WARN("CreatePlacedResource result: {:X}, using committed resource", (UINT64) hr);
+                allocation.resource = nullptr;
+                ReturnRange(heapIndex, range);
+            }
+        }
+    }
+
+    if (allocation.resource == nullptr)
+    {
+        auto hr = InDevice->CreateCommittedResource(&InHeapProperties, D3D12_HEAP_FLAG_NONE, &InDesc, InState, nullptr,
+                                                    IID_PPV_ARGS(&allocation.resource));
+
+        if (hr != S_OK)
+        {
+            LOG_ERROR("CreateCommittedResource result: {:X}", (UINT64) hr);
+            return false;
+        }
+
+        if (allocation.size == UINT64_MAX)
+            allocation.size = 0;
+    }
+
+    _usedBytes += allocation.size;
+    _allocations.push_back(allocation);
+    *OutResource = allocation.resource;
+
+    if (OutCreated != nullptr)
+        *OutCreated = true;
+
+    LOG_DEBUG("Created new one: {}x{}, pool used: {} MB, reserved: {} MB", InDesc.Width, InDesc.Height,
+              _usedBytes >> 20, _reservedBytes >> 20);
+
+    return true;
+}
+
+void FG_ResourcePool_Dx12::ReleaseLocked()
+{
+    for (auto& allocation : _allocations)
+    {
+        if (allocation.resource == nullptr)
+            continue;
+
+        if (allocation.owner != nullptr && *allocation.owner == allocation.resource)
+            *allocation.owner = nullptr;
+
+        allocation.resource->Release();
+    }
+
+    for (auto& heap : _heaps)
+    {
+        if (heap.heap != nullptr)
+            heap.heap->Release();
+    }
+
+    if (!_heaps.empty() || !_allocations.empty())
+    {
+        LOG_DEBUG("Released {} resources, {} MB of heaps", _allocations.size(), _reservedBytes >> 20);
+    }
+
+    _allocations.clear();
+    _heaps.clear();
+    _reservedBytes = 0;
+    _usedBytes = 0;
+    _device = nullptr;
+}
+
+void FG_ResourcePool_Dx12::Release()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    ReleaseLocked();
+}
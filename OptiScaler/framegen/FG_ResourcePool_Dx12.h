@@ -0,0 +1,95 @@
+#pragma once
+#include <pch.h>
+
+#include <d3d12.h>
+
+#include <mutex>
+#include <vector>
+
+// Owns the copy, flip and format transfer textures of FG and places them in a few large heaps.
+//
+// Resources are cached per owner (the caller's resource slot) and description, a slot that goes back to a
+// previously used size or format gets the old resource back. Placed allocations not requested for RetireFrames
+// frames are only released when their memory is needed, new resources then alias that memory. Committed ones are
+// released by the first Acquire of a frame after they retire. Callers never release the returned resources, a slot
+// still holding a released resource is set to nullptr.
+//
+// A new placed resource gets an aliasing barrier, render targets and depth stencils also a DiscardResource, on the
+// cmdList passed to Acquire. Without a cmdList the resource is created as a committed one.
+class FG_ResourcePool_Dx12
+{
+  public:
+    static constexpr UINT64 HeapBlockSize = 64ull * 1024 * 1024;
+    static constexpr UINT64 RetireFrames = BUFFER_COUNT * 2;
+
+    // Returns the cached resource of owner matching desc or creates a new one.
+    // cmdList must be the first one using the returned resource, can be nullptr.
+    // OutCreated is set when the resource is new and its contents are undefined.
+    bool Acquire(ID3D12Device* InDevice, const D3D12_HEAP_PROPERTIES& InHeapProperties,
+                 const D3D12_RESOURCE_DESC& InDesc, D3D12_RESOURCE_STATES InState, ID3D12Resource** InOwner,
+                 UINT64 InFrame, ID3D12GraphicsCommandList* InCmdList, ID3D12Resource** OutResource,
+                 bool* OutCreated = nullptr);
+
+    void Release();
+
+    UINT64 ReservedBytes() const { return _reservedBytes; }
+    UINT64 UsedBytes() const { return _usedBytes; }
+
+    FG_ResourcePool_Dx12() = default;
+    ~FG_ResourcePool_Dx12() { Release(); }
+
+  private:
+    enum class HeapClass : uint32_t
+    {
+        Buffers,
+        Textures,
+        RtDsTextures,
+    };
+
+    struct Range
+    {
+        UINT64 offset = 0;
+        UINT64 size = 0;
+    };
+
+    struct Heap
+    {
+        ID3D12Heap* heap = nullptr;
+        HeapClass heapClass = HeapClass::Textures;
+        UINT64 size = 0;
+        std::vector<Range> free;
+    };
+
+    struct Allocation
+    {
+        ID3D12Resource** owner = nullptr;
+        D3D12_RESOURCE_DESC desc {};
+        ID3D12Resource* resource = nullptr;
+        UINT64 lastUsedFrame = 0;
+        UINT64 size = 0;
+        int heapIndex = -1; // -1 for committed resources
+        Range range {};
+    };
+
+    static constexpr size_t NoHeap = (size_t) -1;
+
+    ID3D12Device* _device = nullptr;
+    std::vector<Heap> _heaps;
+    std::vector<Allocation> _allocations;
+    UINT64 _reservedBytes = 0;
+    UINT64 _usedBytes = 0;
+    UINT64 _committedCheckFrame = 0;
+    std::mutex _mutex;
+
+    static HeapClass GetHeapClass(const D3D12_RESOURCE_DESC& desc);
+    static bool IsSameDesc(const D3D12_RESOURCE_DESC& a, const D3D12_RESOURCE_DESC& b);
+    static bool CanInitialize(ID3D12GraphicsCommandList* cmdList, HeapClass heapClass);
+    static void InitializePlaced(ID3D12GraphicsCommandList* cmdList, ID3D12Resource* resource, HeapClass heapClass,
+                                 D3D12_RESOURCE_STATES createState, D3D12_RESOURCE_STATES state);
+
+    size_t FindRange(HeapClass heapClass, UINT64 size, UINT64 alignment, Range& range);
+    void ReturnRange(size_t heapIndex, Range range);
+    template <typename F> bool EvictRetired(UINT64 frame, F&& filter);
+    void FreeAllocation(Allocation& allocation);
+    void ReleaseLocked();
+};
@@ -47,7 +47,6 @@ UINT64 IFGFeature::StartNewFrame()
     auto fIndex = GetIndex();
     LOG_DEBUG("_frameCount: {}, fIndex: {}", _frameCount, fIndex);
 
-    _resourceReady[fIndex].clear();
     _waitingExecute[fIndex] = false;
 
     _noUi[fIndex] = true;
@@ -59,14 +58,6 @@ UINT64 IFGFeature::StartNewFrame()
     return _frameCount;
 }
 
-bool IFGFeature::IsResourceReady(FG_ResourceType type, int index)
-{
-    if (index < 0)
-        index = GetIndex();
-
-    return _resourceReady[index].contains(type);
-}
-
 bool IFGFeature::WaitingExecution(int index)
 {
     if (index < 0)
@@ -292,12 +283,3 @@ UINT64 IFGFeature::FrameCount() { return _frameCount; }
 UINT64 IFGFeature::LastDispatchedFrame() { return _lastDispatchedFrame; }
 
 UINT64 IFGFeature::TargetFrame() { return _targetFrame; }
-
-void IFGFeature::SetResourceReady(FG_ResourceType type, int index)
-{
-    if (index < 0)
-        index = GetIndex();
-
-    _resourceReady[index][type] = true;
-    _resourceFrame[type] = _frameCount;
-}
@@ -80,9 +80,6 @@ class IFGFeature
     UINT64 _targetFrame = 0;
     FG_Constants _constants {};
 
-    std::unordered_map<FG_ResourceType, bool> _resourceReady[BUFFER_COUNT] {};
-    std::unordered_map<FG_ResourceType, UINT64> _resourceFrame {};
-
     bool _noHudless[BUFFER_COUNT] = { true, true, true, true };
     bool _noUi[BUFFER_COUNT] = { true, true, true, true };
     bool _noDistortionField[BUFFER_COUNT] = { true, true, true, true };
@@ -107,13 +104,13 @@ class IFGFeature
     virtual bool ReleaseSwapchain(HWND hwnd) = 0;
     virtual bool Shutdown() = 0;
     virtual bool HasResource(FG_ResourceType type, int index = -1) = 0;
+    virtual bool IsResourceReady(FG_ResourceType type, int index = -1) = 0;
+    virtual void SetResourceReady(FG_ResourceType type, int index = -1) = 0;
 
     int GetIndex();
     int GetIndexWillBeDispatched();
     UINT64 StartNewFrame();
 
-    bool IsResourceReady(FG_ResourceType type, int index = -1);
-
     bool IsUsingUI();
     bool IsUsingUIAny(); // Same as IsUsingUI but checks if at least once buffer has UI
     bool IsUsingDistortionField();
@@ -145,7 +142,6 @@ class IFGFeature
     void GetInterpolationRect(UINT64& width, UINT& height, int index = -1);
     void SetInterpolationPos(UINT left, UINT top, int index = -1);
     void GetInterpolationPos(UINT& left, UINT& top, int index = -1);
-    void SetResourceReady(FG_ResourceType type, int index = -1);
 
     void ResetCounters();
     void UpdateTarget();
@@ -40,12 +40,26 @@ ID3D12CommandQueue* IFGFeature_Dx12::GetCommandQueue() { return _gameCommandQueu
 
 bool IFGFeature_Dx12::HasResource(FG_ResourceType type, int index)
 {
-    std::lock_guard<std::mutex> lock(_frMutex);
+    if (index < 0)
+        index = GetIndex();
 
+    return _frameResources.IsPublished(index, type);
+}
+
+bool IFGFeature_Dx12::IsResourceReady(FG_ResourceType type, int index)
+{
     if (index < 0)
         index = GetIndex();
 
-    return _frameResources[index].contains(type);
+    return _frameResources.IsReady(index, type);
+}
+
+void IFGFeature_Dx12::SetResourceReady(FG_ResourceType type, int index)
+{
+    if (index < 0)
+        index = GetIndex();
+
+    _frameResources.SetReady(index, type);
 }
 
 ID3D12GraphicsCommandList* IFGFeature_Dx12::GetUICommandList(int index)
@@ -105,22 +119,10 @@ ID3D12GraphicsCommandList* IFGFeature_Dx12::GetUICommandList(int index)
 
 Dx12Resource* IFGFeature_Dx12::GetResource(FG_ResourceType type, int index)
 {
-    std::lock_guard<std::mutex> lock(_frMutex);
-
-    // if (_resourceFrame[type] != _frameCount)
-    //     return nullptr;
-
     if (index < 0)
         index = GetIndex();
 
-    if (!_frameResources[index].contains(type))
-        return nullptr;
-
-    auto& currentIndex = _frameResources[index];
-    if (auto it = currentIndex.find(type); it != currentIndex.end())
-        return &it->second;
-
-    return nullptr;
+    return _frameResources.Get(index, type);
 }
 
 void IFGFeature_Dx12::NewFrame()
@@ -135,71 +137,75 @@ void IFGFeature_Dx12::NewFrame()
 
     auto fIndex = GetIndex();
 
-    std::lock_guard<std::mutex> lock(_frMutex);
-
     LOG_DEBUG("_frameCount: {}, fIndex: {}", _frameCount, fIndex);
 
-    _frameResources[fIndex].clear();
+    _frameResources.Reset(fIndex);
     _uiCommandListResetted[fIndex] = false;
     _lastFGFramePresentId = _fgFramePresentId;
 }
 
-void IFGFeature_Dx12::FlipResource(Dx12Resource* resource)
+bool IFGFeature_Dx12::PrepareResource(Dx12Resource* resource, uint32_t extraFlags)
 {
     auto type = resource->type;
 
-    if (type != FG_ResourceType::Depth && type != FG_ResourceType::Velocity)
-        return;
+    if (_device == nullptr || (type != FG_ResourceType::Depth && type != FG_ResourceType::Velocity))
+        return false;
 
-    auto fIndex = GetIndex();
-    ID3D12Resource* flipOutput = nullptr;
-    std::unique_ptr<RF_Dx12>* flip = nullptr;
+    uint32_t flags = extraFlags;
 
-    flipOutput = _resourceCopy[fIndex][type];
+    auto fgInput = State::Instance().activeFgInput;
 
-    if (!CreateBufferResource(_device, resource->resource, D3D12_RESOURCE_STATE_UNORDERED_ACCESS, &flipOutput, true,
-                              resource->type == FG_ResourceType::Depth))
+    if (fgInput == FGInput::Upscaler && Config::Instance()->FGResourceFlip.value_or_default())
+        flags |= (type == FG_ResourceType::Velocity) ? (FGP_Flip | FGP_NegateY) : FGP_Flip;
+
+    // FSR 3.0 FG input also gets depth from the upscaler
+    if ((fgInput == FGInput::Upscaler || fgInput == FGInput::FSRFG30) && type == FG_ResourceType::Depth &&
+        Config::Instance()->FGEnableDepthScale.value_or_default())
     {
-        LOG_ERROR("{}, CreateBufferResource for flip is failed!", magic_enum::enum_name(type));
-        return;
+        flags |= FGP_DepthScale;
     }
 
-    _resourceCopy[fIndex][type] = flipOutput;
+    if (type != FG_ResourceType::Depth)
+        flags &= ~(FGP_DepthScale | FGP_DepthInvert);
 
-    if (type == FG_ResourceType::Depth)
-    {
-        if (_depthFlip.get() == nullptr)
-        {
-            _depthFlip = std::make_unique<RF_Dx12>("DepthFlip", _device);
-            return;
-        }
+    if (flags == FGP_None)
+        return false;
 
-        flip = &_depthFlip;
-    }
-    else
-    {
-        if (_mvFlip.get() == nullptr)
-        {
-            _mvFlip = std::make_unique<RF_Dx12>("VelocityFlip", _device);
-            return;
-        }
+    auto fIndex = GetIndex();
+    auto& prep = (type == FG_ResourceType::Depth) ? _depthPrep : _mvPrep;
 
-        flip = &_mvFlip;
+    if (prep.get() == nullptr)
+    {
+        prep = std::make_unique<FGP_Dx12>((type == FG_ResourceType::Depth) ? "DepthPrep" : "VelocityPrep", _device);
+        return false;
     }
 
-    if (flip->get()->IsInit())
+    if (!prep->IsInit())
+        return false;
+
+    auto cmdList = (resource->cmdList != nullptr) ? resource->cmdList : GetUICommandList(fIndex);
+
+    if (!CreateBufferResource(_device, resource->resource, D3D12_RESOURCE_STATE_UNORDERED_ACCESS,
+                              &_resourceCopy[fIndex][type], true, type == FG_ResourceType::Depth, cmdList))
     {
-        auto cmdList = (resource->cmdList != nullptr) ? resource->cmdList : GetUICommandList(fIndex);
-        auto result = flip->get()->Dispatch(_device, (ID3D12GraphicsCommandList*) cmdList, resource->resource,
-                                            flipOutput, resource->width, resource->height, true);
+        LOG_ERROR("{}, CreateBufferResource for prep is failed!", magic_enum::enum_name(type));
+        return false;
+    }
 
-        if (result)
-        {
-            LOG_TRACE("Setting {} from flip, index: {}", magic_enum::enum_name(type), fIndex);
-            resource->copy = flipOutput;
-            resource->state = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
-        }
+    auto prepOutput = _resourceCopy[fIndex][type];
+
+    if (!prep->Dispatch(_device, cmdList, resource->resource, prepOutput, resource->width, resource->height, flags,
+                        Config::Instance()->FGDepthScaleMax.value_or_default()))
+    {
+        return false;
     }
+
+    LOG_TRACE("Setting {} from prep, flags: {:X}, index: {}", magic_enum::enum_name(type), flags, fIndex);
+    resource->copy = prepOutput;
+    resource->state = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
+    resource->validity = FG_ResourceValidity::UntilPresent;
+
+    return true;
 }
 
 bool IFGFeature_Dx12::CreateBufferResourceWithSize(ID3D12Device* device, ID3D12Resource* source,
@@ -217,22 +223,17 @@ bool IFGFeature_Dx12::CreateBufferResourceWithSize(ID3D12Device* device, ID3D12R
     if (depth)
         inDesc.Format = DXGI_FORMAT_R32_FLOAT;
 
-    if (*target != nullptr)
-    {
-        auto bufDesc = (*target)->GetDesc();
+    inDesc.Width = width;
+    inDesc.Height = height;
 
-        if (bufDesc.Width != width || bufDesc.Height != height || bufDesc.Format != inDesc.Format ||
-            bufDesc.Flags != inDesc.Flags)
-        {
-            (*target)->Release();
-            (*target) = nullptr;
-        }
-        else
-        {
-            return true;
-        }
-    }
+    return CreatePooledResource(device, source, inDesc, state, target, nullptr);
+}
 
+bool IFGFeature_Dx12::CreatePooledResource(ID3D12Device* device, ID3D12Resource* source,
+                                           const D3D12_RESOURCE_DESC& desc, D3D12_RESOURCE_STATES state,
+                                           ID3D12Resource** target, ID3D12GraphicsCommandList* cmdList,
+                                           bool* created)
+{
     D3D12_HEAP_PROPERTIES heapProperties;
     D3D12_HEAP_FLAGS heapFlags;
     HRESULT hr = source->GetHeapProperties(&heapProperties, &heapFlags);
@@ -243,21 +244,7 @@ bool IFGFeature_Dx12::CreateBufferResourceWithSize(ID3D12Device* device, ID3D12R
         return false;
     }
 
-    inDesc.Width = width;
-    inDesc.Height = height;
-
-    hr = device->CreateCommittedResource(&heapProperties, D3D12_HEAP_FLAG_NONE, &inDesc, state, nullptr,
-                                         IID_PPV_ARGS(target));
-
-    if (hr != S_OK)
-    {
-        LOG_ERROR("CreateCommittedResource result: {:X}", (UINT64) hr);
-        return false;
-    }
-
-    LOG_DEBUG("Created new one: {}x{}", inDesc.Width, inDesc.Height);
-
-    return true;
+    return _resourcePool.Acquire(device, heapProperties, desc, state, target, _frameCount, cmdList, target, created);
 }
 
 bool IFGFeature_Dx12::InitCopyCmdList()
@@ -328,58 +315,395 @@ void IFGFeature_Dx12::DestroyCopyCmdList()
     }
 }
 
-bool IFGFeature_Dx12::CreateBufferResource(ID3D12Device* device, ID3D12Resource* source,
-                                           D3D12_RESOURCE_STATES initialState, ID3D12Resource** target, bool UAV,
-                                           bool depth)
+bool IFGFeature_Dx12::InitSnapshotQueue()
 {
-    if (device == nullptr || source == nullptr)
+    if (_snapshotQueue != nullptr)
+        return true;
+
+    if (_device == nullptr || _snapshotQueueFailed)
         return false;
 
-    auto inDesc = source->GetDesc();
+    do
+    {
+        // Direct queue, copy and compute queues can't transition render target or depth sources
+        D3D12_COMMAND_QUEUE_DESC queueDesc = {};
+        queueDesc.Type = D3D12_COMMAND_LIST_TYPE_DIRECT;
+        queueDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
+        queueDesc.NodeMask = 0;
+        queueDesc.Priority = D3D12_COMMAND_QUEUE_PRIORITY_NORMAL;
+
+        auto result = _device->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&_snapshotQueue));
+        if (result != S_OK)
+        {
+            LOG_ERROR("CreateCommandQueue: {:X}", (unsigned long) result);
+            break;
+        }
 
-    if (UAV)
-        inDesc.Flags = D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
+        _snapshotQueue->SetName(L"_snapshotQueue");
 
-    if (depth)
-        inDesc.Format = DXGI_FORMAT_R32_FLOAT;
+        // ExecuteCommandLists hook sees the real queue
+        ID3D12CommandQueue* queue = nullptr;
+        if (CheckForRealObject(__FUNCTION__, _snapshotQueue, (IUnknown**) &queue))
+            _snapshotQueue = queue;
 
-    if (*target != nullptr)
-    {
-        //(*target)->Release();
-        //(*target) = nullptr;
+        result = _device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&_sourceFence));
+        if (result != S_OK)
+        {
+            LOG_ERROR("CreateFence _sourceFence: {:X}", (unsigned long) result);
+            break;
+        }
+
+        result = _device->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&_snapshotFence));
+        if (result != S_OK)
+        {
+            LOG_ERROR("CreateFence _snapshotFence: {:X}", (unsigned long) result);
+            break;
+        }
 
-        auto bufDesc = (*target)->GetDesc();
+        ID3D12CommandAllocator* allocator = nullptr;
+        ID3D12GraphicsCommandList* cmdList = nullptr;
+        size_t i = 0;
 
-        if (bufDesc.Width != inDesc.Width || bufDesc.Height != inDesc.Height || bufDesc.Format != inDesc.Format ||
-            bufDesc.Flags != inDesc.Flags)
+        for (; i < BUFFER_COUNT; i++)
         {
-            (*target)->Release();
-            (*target) = nullptr;
+            result = _device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT,
+                                                     IID_PPV_ARGS(&_snapshotCommandAllocator[i]));
+            if (result != S_OK)
+            {
+                LOG_ERROR("_snapshotCommandAllocator[{}]: {:X}", i, (unsigned long) result);
+                break;
+            }
+
+            _snapshotCommandAllocator[i]->SetName(L"_snapshotCommandAllocator");
+            if (CheckForRealObject(__FUNCTION__, _snapshotCommandAllocator[i], (IUnknown**) &allocator))
+                _snapshotCommandAllocator[i] = allocator;
+
+            result = _device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, _snapshotCommandAllocator[i], NULL,
+                                                IID_PPV_ARGS(&_snapshotCommandList[i]));
+            if (result != S_OK)
+            {
+                LOG_ERROR("_snapshotCommandList[{}]: {:X}", i, (unsigned long) result);
+                break;
+            }
+
+            _snapshotCommandList[i]->SetName(L"_snapshotCommandList");
+            if (CheckForRealObject(__FUNCTION__, _snapshotCommandList[i], (IUnknown**) &cmdList))
+                _snapshotCommandList[i] = cmdList;
+
+            result = _snapshotCommandList[i]->Close();
+            if (result != S_OK)
+            {
+                LOG_ERROR("_snapshotCommandList[{}]->Close: {:X}", i, (unsigned long) result);
+                break;
+            }
         }
-        else
+
+        if (i < BUFFER_COUNT)
+            break;
+
+        LOG_INFO("Snapshot queue created");
+        return true;
+
+    } while (false);
+
+    // Don't retry every frame
+    _snapshotQueueFailed = true;
+    DestroySnapshotQueue();
+
+    return false;
+}
+
+void IFGFeature_Dx12::DestroySnapshotQueue()
+{
+    std::lock_guard<std::mutex> lock(_snapshotMutex);
+
+    // Copies may still be reading sources and writing targets
+    if (_snapshotFence != nullptr && _snapshotFence->GetCompletedValue() < _snapshotFenceValue)
+        _snapshotFence->SetEventOnCompletion(_snapshotFenceValue, nullptr);
+
+    _snapshots.clear();
+    _pendingSnapshots.store(0, std::memory_order_release);
+    _blockedQueue.store(nullptr, std::memory_order_release);
+
+    for (size_t i = 0; i < BUFFER_COUNT; i++)
+    {
+        if (_snapshotCommandAllocator[i] != nullptr)
         {
-            return true;
+            _snapshotCommandAllocator[i]->Release();
+            _snapshotCommandAllocator[i] = nullptr;
         }
+
+        if (_snapshotCommandList[i] != nullptr)
+        {
+            _snapshotCommandList[i]->Release();
+            _snapshotCommandList[i] = nullptr;
+        }
+
+        _snapshotAllocatorFrame[i] = 0;
+        _snapshotAllocatorValue[i] = 0;
     }
 
-    D3D12_HEAP_PROPERTIES heapProperties;
-    D3D12_HEAP_FLAGS heapFlags;
-    auto hr = source->GetHeapProperties(&heapProperties, &heapFlags);
+    if (_sourceFence != nullptr)
+    {
+        _sourceFence->Release();
+        _sourceFence = nullptr;
+    }
 
-    hr = device->CreateCommittedResource(&heapProperties, D3D12_HEAP_FLAG_NONE, &inDesc, initialState, nullptr,
-                                         IID_PPV_ARGS(target));
+    if (_snapshotFence != nullptr)
+    {
+        _snapshotFence->Release();
+        _snapshotFence = nullptr;
+    }
 
-    if (hr != S_OK)
+    if (_snapshotQueue != nullptr)
+    {
+        _snapshotQueue->Release();
+        _snapshotQueue = nullptr;
+    }
+
+    _sourceFenceValue = 0;
+    _snapshotFenceValue = 0;
+    _presentWaitValue = 0;
+    _blockedQueueValue = 0;
+}
+
+bool IFGFeature_Dx12::QueueSnapshot(Dx12Resource* resource, ID3D12GraphicsCommandList* cmdList, int index,
+                                    const D3D12_BOX* box)
+{
+    if (!Config::Instance()->FGSnapshotQueue.value_or_default() || cmdList == nullptr || resource == nullptr)
+        return false;
+
+    if (!InitSnapshotQueue())
+        return false;
+
+    auto type = resource->type;
+    auto created = false;
+
+    // Without a cmdList the pool creates a committed resource, placed ones need their first use on a cmdList
+    if (!CreateBufferResource(_device, resource->resource, D3D12_RESOURCE_STATE_COPY_DEST,
+                              &_resourceCopy[index][type], false, false, nullptr, &created))
     {
-        LOG_ERROR("CreateCommittedResource result: {:X}", (UINT64) hr);
         return false;
     }
 
-    LOG_DEBUG("Created new one: {}x{}", inDesc.Width, inDesc.Height);
+    Dx12Snapshot snapshot {};
+    snapshot.type = type;
+    snapshot.frameIndex = index;
+    snapshot.source = resource->resource;
+    snapshot.target = _resourceCopy[index][type];
+    snapshot.state = resource->state;
+
+    // ExecuteCommandLists hook sees the real cmdList
+    ID3D12GraphicsCommandList* realCmdList = nullptr;
+    if (!CheckForRealObject(__FUNCTION__, cmdList, (IUnknown**) &realCmdList))
+        realCmdList = cmdList;
+
+    snapshot.cmdList = realCmdList;
+
+    // Contents of a new target are undefined, copy it whole
+    if (box != nullptr && !created)
+    {
+        snapshot.box = *box;
+        snapshot.useBox = true;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_snapshotMutex);
+
+        // Entry of the same slot which was never submitted
+        std::erase_if(_snapshots, [&](const Dx12Snapshot& s) { return s.frameIndex == index && s.type == type; });
+
+        _snapshots.push_back(snapshot);
+        _pendingSnapshots.store(_snapshots.size(), std::memory_order_release);
+    }
+
+    LOG_DEBUG("Queued snapshot of {}, index: {}, cmdList: {:X}", magic_enum::enum_name(type), index,
+              (size_t) realCmdList);
 
     return true;
 }
 
+void IFGFeature_Dx12::SubmitSnapshotsLocked(ID3D12CommandQueue* queue, std::vector<Dx12Snapshot>& snapshots)
+{
+    // Allocator is reset once per frame, after the copies of its last use are done
+    auto slot = _frameCount % BUFFER_COUNT;
+    auto allocator = _snapshotCommandAllocator[slot];
+    auto cmdList = _snapshotCommandList[slot];
+
+    if (_snapshotAllocatorFrame[slot] != _frameCount)
+    {
+        if (_snapshotFence->GetCompletedValue() < _snapshotAllocatorValue[slot])
+            _snapshotFence->SetEventOnCompletion(_snapshotAllocatorValue[slot], nullptr);
+
+        auto result = allocator->Reset();
+        if (result != S_OK)
+        {
+            LOG_ERROR("_snapshotCommandAllocator[{}]->Reset() error: {:X}", slot, (UINT) result);
+            return;
+        }
+
+        _snapshotAllocatorFrame[slot] = _frameCount;
+    }
+
+    auto result = cmdList->Reset(allocator, nullptr);
+    if (result != S_OK)
+    {
+        LOG_ERROR("_snapshotCommandList[{}]->Reset() error: {:X}", slot, (UINT) result);
+        return;
+    }
+
+    auto transitioned = false;
+
+    for (const auto& snapshot : snapshots)
+    {
+        // Sources already readable by copies keep their state
+        auto needsBarrier = (snapshot.state & D3D12_RESOURCE_STATE_COPY_SOURCE) == 0;
+
+        if (needsBarrier)
+            ResourceBarrier(cmdList, snapshot.source, snapshot.state, D3D12_RESOURCE_STATE_COPY_SOURCE);
+
+        CopyRegion(cmdList, snapshot.source, snapshot.target, snapshot.useBox ? &snapshot.box : nullptr);
+
+        if (needsBarrier)
+            ResourceBarrier(cmdList, snapshot.source, D3D12_RESOURCE_STATE_COPY_SOURCE, snapshot.state);
+
+        transitioned |= needsBarrier;
+    }
+
+    result = cmdList->Close();
+    if (result != S_OK)
+    {
+        LOG_ERROR("_snapshotCommandList[{}]->Close() error: {:X}", slot, (UINT) result);
+        return;
+    }
+
+    // Copies start when the game's cmdLists before this point are done
+    queue->Signal(_sourceFence, ++_sourceFenceValue);
+    _snapshotQueue->Wait(_sourceFence, _sourceFenceValue);
+    _snapshotQueue->ExecuteCommandLists(1, (ID3D12CommandList**) &cmdList);
+    _snapshotQueue->Signal(_snapshotFence, ++_snapshotFenceValue);
+    _snapshotAllocatorValue[slot] = _snapshotFenceValue;
+
+    LOG_DEBUG("Submitted {} snapshots, fence: {}", snapshots.size(), _snapshotFenceValue);
+
+    // Game must not use a source while it is in copy state, read only sources only wait at present
+    if (transitioned)
+    {
+        auto blocked = _blockedQueue.load(std::memory_order_acquire);
+
+        if (blocked != nullptr && blocked != queue)
+            blocked->Wait(_snapshotFence, _blockedQueueValue);
+
+        _blockedQueueValue = _snapshotFenceValue;
+        _blockedQueue.store(queue, std::memory_order_release);
+    }
+}
+
+void IFGFeature_Dx12::WaitForSnapshots(ID3D12CommandQueue* queue)
+{
+    if (_blockedQueue.load(std::memory_order_acquire) != queue || queue == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> lock(_snapshotMutex);
+
+    if (_blockedQueue.load(std::memory_order_relaxed) != queue)
+        return;
+
+    queue->Wait(_snapshotFence, _blockedQueueValue);
+    _blockedQueue.store(nullptr, std::memory_order_release);
+}
+
+void IFGFeature_Dx12::SubmitSnapshots(ID3D12CommandQueue* queue, UINT count, ID3D12CommandList* const* cmdLists)
+{
+    if (_pendingSnapshots.load(std::memory_order_acquire) == 0 || queue == _snapshotQueue)
+        return;
+
+    std::lock_guard<std::mutex> lock(_snapshotMutex);
+
+    std::vector<Dx12Snapshot> submitted;
+
+    std::erase_if(_snapshots,
+                  [&](const Dx12Snapshot& snapshot)
+                  {
+                      for (UINT i = 0; i < count; i++)
+                      {
+                          if (cmdLists[i] == snapshot.cmdList)
+                          {
+                              submitted.push_back(snapshot);
+                              return true;
+                          }
+                      }
+
+                      return false;
+                  });
+
+    if (submitted.empty())
+        return;
+
+    _pendingSnapshots.store(_snapshots.size(), std::memory_order_release);
+    SubmitSnapshotsLocked(queue, submitted);
+}
+
+void IFGFeature_Dx12::FlushSnapshots(int index)
+{
+    if (_snapshotQueue == nullptr || _gameCommandQueue == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> lock(_snapshotMutex);
+
+    if (!_snapshots.empty())
+    {
+        std::vector<Dx12Snapshot> submitted;
+
+        std::erase_if(_snapshots,
+                      [&](const Dx12Snapshot& snapshot)
+                      {
+                          if (snapshot.frameIndex != index)
+                              return false;
+
+                          submitted.push_back(snapshot);
+                          return true;
+                      });
+
+        _pendingSnapshots.store(_snapshots.size(), std::memory_order_release);
+
+        // Sources are valid until present, game queue has submitted the frame by now
+        if (!submitted.empty())
+        {
+            LOG_DEBUG("{} snapshots of index {} weren't submitted with their cmdList", submitted.size(), index);
+            SubmitSnapshotsLocked(_gameCommandQueue, submitted);
+        }
+    }
+
+    // FG and the game's next frame use the copies after this point
+    if (_snapshotFenceValue > _presentWaitValue)
+    {
+        _gameCommandQueue->Wait(_snapshotFence, _snapshotFenceValue);
+        _presentWaitValue = _snapshotFenceValue;
+
+        if (_blockedQueue.load(std::memory_order_relaxed) == _gameCommandQueue)
+            _blockedQueue.store(nullptr, std::memory_order_release);
+    }
+}
+
+bool IFGFeature_Dx12::CreateBufferResource(ID3D12Device* device, ID3D12Resource* source,
+                                           D3D12_RESOURCE_STATES initialState, ID3D12Resource** target, bool UAV,
+                                           bool depth, ID3D12GraphicsCommandList* cmdList, bool* created)
+{
+    if (device == nullptr || source == nullptr)
+        return false;
+
+    auto inDesc = source->GetDesc();
+
+    if (UAV)
+        inDesc.Flags = D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
+
+    if (depth)
+        inDesc.Format = DXGI_FORMAT_R32_FLOAT;
+
+    return CreatePooledResource(device, source, inDesc, initialState, target, cmdList, created);
+}
+
 void IFGFeature_Dx12::ResourceBarrier(ID3D12GraphicsCommandList* cmdList, ID3D12Resource* resource,
                                       D3D12_RESOURCE_STATES beforeState, D3D12_RESOURCE_STATES afterState)
 {
@@ -396,14 +720,17 @@ void IFGFeature_Dx12::ResourceBarrier(ID3D12GraphicsCommandList* cmdList, ID3D12
 }
 
 bool IFGFeature_Dx12::CopyResource(ID3D12GraphicsCommandList* cmdList, ID3D12Resource* source, ID3D12Resource** target,
-                                   D3D12_RESOURCE_STATES sourceState)
+                                   D3D12_RESOURCE_STATES sourceState, const D3D12_BOX* box)
 {
     auto result = true;
 
     ResourceBarrier(cmdList, source, sourceState, D3D12_RESOURCE_STATE_COPY_SOURCE);
 
-    if (CreateBufferResource(_device, source, D3D12_RESOURCE_STATE_COPY_DEST, target))
-        cmdList->CopyResource(*target, source);
+    auto created = false;
+
+    // Contents of a new target are undefined, copy it whole so nothing outside of the box is left uninitialized
+    if (CreateBufferResource(_device, source, D3D12_RESOURCE_STATE_COPY_DEST, target, false, false, cmdList, &created))
+        CopyRegion(cmdList, source, *target, created ? nullptr : box);
     else
         result = false;
 
@@ -411,3 +738,75 @@ bool IFGFeature_Dx12::CopyResource(ID3D12GraphicsCommandList* cmdList, ID3D12Res
 
     return result;
 }
+
+void IFGFeature_Dx12::CopyRegion(ID3D12GraphicsCommandList* cmdList, ID3D12Resource* source, ID3D12Resource* target,
+                                 const D3D12_BOX* box)
+{
+    if (box == nullptr)
+    {
+        cmdList->CopyResource(target, source);
+        return;
+    }
+
+    D3D12_TEXTURE_COPY_LOCATION srcLocation;
+    ZeroMemory(&srcLocation, sizeof(srcLocation));
+    srcLocation.pResource = source;
+    srcLocation.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+    srcLocation.SubresourceIndex = 0;
+
+    D3D12_TEXTURE_COPY_LOCATION dstLocation;
+    ZeroMemory(&dstLocation, sizeof(dstLocation));
+    dstLocation.pResource = target;
+    dstLocation.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+    dstLocation.SubresourceIndex = 0;
+
+    // Copy keeps the position of the box
+    cmdList->CopyTextureRegion(&dstLocation, box->left, box->top, 0, &srcLocation, box);
+}
+
+bool IFGFeature_Dx12::GetInterpolationBox(FG_ResourceType type, ID3D12Resource* resource, int index, D3D12_BOX& box)
+{
+    // Only hudless and UI are in the same coordinates with interpolation rect
+    if (resource == nullptr || (type != FG_ResourceType::HudlessColor && type != FG_ResourceType::UIColor))
+        return false;
+
+    if (index < 0)
+        index = GetIndex();
+
+    auto desc = resource->GetDesc();
+
+    if (desc.Dimension != D3D12_RESOURCE_DIMENSION_TEXTURE2D || desc.MipLevels != 1 || desc.DepthOrArraySize != 1)
+        return false;
+
+    auto config = Config::Instance();
+
+    UINT64 width = config->FGRectWidth.value_or((int) _interpolationWidth[index]);
+    UINT64 height = config->FGRectHeight.value_or((int) _interpolationHeight[index]);
+
+    if (width == 0 || height == 0)
+        return false;
+
+    UINT64 defaultLeft = desc.Width > width ? (desc.Width - width) / 2 : 0;
+    UINT64 defaultTop = desc.Height > height ? (desc.Height - height) / 2 : 0;
+
+    UINT64 left = config->FGRectLeft.value_or(_interpolationLeft[index].value_or((UINT) defaultLeft));
+    UINT64 top = config->FGRectTop.value_or(_interpolationTop[index].value_or((UINT) defaultTop));
+
+    if (left >= desc.Width || top >= desc.Height)
+        return false;
+
+    width = std::min(width, desc.Width - left);
+    height = std::min(height, (UINT64) desc.Height - top);
+
+    if (width == desc.Width && height == desc.Height)
+        return false;
+
+    box.left = (UINT) left;
+    box.top = (UINT) top;
+    box.front = 0;
+    box.right = (UINT) (left + width);
+    box.bottom = (UINT) (top + height);
+    box.back = 1;
+
+    return true;
+}
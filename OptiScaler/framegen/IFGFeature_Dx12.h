@@ -1,10 +1,12 @@
 #pragma once
 #include <pch.h>
 #include "IFGFeature.h"
+#include "FG_FrameRing.h"
+#include "FG_ResourcePool_Dx12.h"
 
 #include <upscalers/IFeature.h>
 
-#include <shaders/resource_flip/RF_Dx12.h>
+#include <shaders/fg_prep/FGP_Dx12.h>
 #include <shaders/hudless_compare/HC_Dx12.h>
 
 #include <dxgi1_6.h>
@@ -30,6 +32,19 @@ struct Dx12Resource
     ID3D12Resource* GetResource() { return (copy == nullptr) ? resource : copy; }
 };
 
+// Copy of a resource on _snapshotQueue, waits until the game submits the cmdList which tagged the source
+struct Dx12Snapshot
+{
+    FG_ResourceType type;
+    int frameIndex = -1;
+    ID3D12CommandList* cmdList = nullptr;
+    ID3D12Resource* source = nullptr;
+    ID3D12Resource* target = nullptr;
+    D3D12_RESOURCE_STATES state = D3D12_RESOURCE_STATE_COMMON;
+    D3D12_BOX box {};
+    bool useBox = false;
+};
+
 class IFGFeature_Dx12 : public virtual IFGFeature
 {
   private:
@@ -39,6 +54,30 @@ class IFGFeature_Dx12 : public virtual IFGFeature
     bool InitCopyCmdList();
     void DestroyCopyCmdList();
 
+    // Snapshot queue, used when FGSnapshotQueue is enabled
+    std::mutex _snapshotMutex;
+    std::vector<Dx12Snapshot> _snapshots;
+    std::atomic<size_t> _pendingSnapshots { 0 };
+    ID3D12CommandQueue* _snapshotQueue = nullptr;
+    bool _snapshotQueueFailed = false;
+    ID3D12GraphicsCommandList* _snapshotCommandList[BUFFER_COUNT] {};
+    ID3D12CommandAllocator* _snapshotCommandAllocator[BUFFER_COUNT] {};
+    UINT64 _snapshotAllocatorFrame[BUFFER_COUNT] {};
+    UINT64 _snapshotAllocatorValue[BUFFER_COUNT] {};
+    ID3D12Fence* _sourceFence = nullptr;
+    UINT64 _sourceFenceValue = 0;
+    ID3D12Fence* _snapshotFence = nullptr;
+    UINT64 _snapshotFenceValue = 0;
+    UINT64 _presentWaitValue = 0;
+
+    // Queue which transitioned sources are submitted on, has to wait for the copies before its next work
+    std::atomic<ID3D12CommandQueue*> _blockedQueue { nullptr };
+    UINT64 _blockedQueueValue = 0;
+
+    bool InitSnapshotQueue();
+    void DestroySnapshotQueue();
+    void SubmitSnapshotsLocked(ID3D12CommandQueue* queue, std::vector<Dx12Snapshot>& snapshots);
+
   protected:
     ID3D12Device* _device = nullptr;
     IDXGISwapChain* _swapChain = nullptr;
@@ -53,25 +92,49 @@ class IFGFeature_Dx12 : public virtual IFGFeature
     ID3D12CommandAllocator* _uiCommandAllocator[BUFFER_COUNT] {};
     bool _uiCommandListResetted[BUFFER_COUNT] { false, false, false, false };
 
-    std::unordered_map<FG_ResourceType, Dx12Resource> _frameResources[BUFFER_COUNT] {};
-    std::unordered_map<FG_ResourceType, ID3D12Resource*> _resourceCopy[BUFFER_COUNT] {};
-    std::mutex _frMutex;
+    FG_FrameRing<Dx12Resource> _frameResources;
+    ID3D12Resource* _resourceCopy[BUFFER_COUNT][FG_ResourceType::ResourceTypeCOUNT] {};
 
-    std::unique_ptr<RF_Dx12> _mvFlip;
-    std::unique_ptr<RF_Dx12> _depthFlip;
+    // Separate instances as depth and velocity can be prepared on the same cmdList
+    std::unique_ptr<FGP_Dx12> _mvPrep;
+    std::unique_ptr<FGP_Dx12> _depthPrep;
     std::unique_ptr<HC_Dx12> _hudlessCompare;
 
+    // Owns the resources returned by CreateBufferResource, OutResource slot is the cache key
+    FG_ResourcePool_Dx12 _resourcePool;
+
     bool CreateBufferResource(ID3D12Device* InDevice, ID3D12Resource* InSource, D3D12_RESOURCE_STATES InState,
-                              ID3D12Resource** OutResource, bool UAV = false, bool depth = false);
+                              ID3D12Resource** OutResource, bool UAV = false, bool depth = false,
+                              ID3D12GraphicsCommandList* InCmdList = nullptr, bool* OutCreated = nullptr);
     bool CreateBufferResourceWithSize(ID3D12Device* device, ID3D12Resource* source, D3D12_RESOURCE_STATES state,
                                       ID3D12Resource** target, UINT width, UINT height, bool UAV, bool depth);
+    bool CreatePooledResource(ID3D12Device* device, ID3D12Resource* source, const D3D12_RESOURCE_DESC& desc,
+                              D3D12_RESOURCE_STATES state, ID3D12Resource** target,
+                              ID3D12GraphicsCommandList* cmdList, bool* created = nullptr);
     void ResourceBarrier(ID3D12GraphicsCommandList* InCommandList, ID3D12Resource* InResource,
                          D3D12_RESOURCE_STATES InBeforeState, D3D12_RESOURCE_STATES InAfterState);
+    // When box is set only the box is copied, except for a new target which is copied whole once
     bool CopyResource(ID3D12GraphicsCommandList* cmdList, ID3D12Resource* source, ID3D12Resource** target,
-                      D3D12_RESOURCE_STATES sourceState);
+                      D3D12_RESOURCE_STATES sourceState, const D3D12_BOX* box = nullptr);
+    void CopyRegion(ID3D12GraphicsCommandList* cmdList, ID3D12Resource* source, ID3D12Resource* target,
+                    const D3D12_BOX* box);
+
+    // Interpolation rect of the frame clamped to resource, false when the whole resource is needed
+    bool GetInterpolationBox(FG_ResourceType type, ID3D12Resource* resource, int index, D3D12_BOX& box);
 
     void NewFrame() override final;
-    void FlipResource(Dx12Resource* resource);
+
+    // Flip, depth scale & invert of depth and velocity in one pass into _resourceCopy
+    // Flip and scale come from config, extraFlags are backend specific steps (FGP_Flags)
+    // Returns true when resource->copy is set, copy stays valid until present
+    bool PrepareResource(Dx12Resource* resource, uint32_t extraFlags = FGP_None);
+
+    // Copies resource into _resourceCopy on _snapshotQueue after the game submits cmdList
+    // Only for inputs which stay valid until present, false when the copy has to be made on cmdList
+    bool QueueSnapshot(Dx12Resource* resource, ID3D12GraphicsCommandList* cmdList, int index, const D3D12_BOX* box);
+
+    // Submits the snapshots of the frame whose cmdList wasn't seen and makes the game queue wait for all of them
+    void FlushSnapshots(int index);
 
   protected:
     virtual void ReleaseObjects() = 0;
@@ -100,8 +163,18 @@ class IFGFeature_Dx12 : public virtual IFGFeature
     bool GetResourceCopy(FG_ResourceType type, D3D12_RESOURCE_STATES bufferState, ID3D12Resource* output);
     ID3D12CommandQueue* GetCommandQueue();
 
+    // Called by the ExecuteCommandLists hook, before and after the game's cmdLists are executed
+    void WaitForSnapshots(ID3D12CommandQueue* queue);
+    void SubmitSnapshots(ID3D12CommandQueue* queue, UINT count, ID3D12CommandList* const* cmdLists);
+
     bool HasResource(FG_ResourceType type, int index = -1) override final;
+    bool IsResourceReady(FG_ResourceType type, int index = -1) override final;
+    void SetResourceReady(FG_ResourceType type, int index = -1) override final;
 
     IFGFeature_Dx12() = default;
-    virtual ~IFGFeature_Dx12() { DestroyCopyCmdList(); }
+    virtual ~IFGFeature_Dx12()
+    {
+        DestroySnapshotQueue();
+        DestroyCopyCmdList();
+    }
 };
@@ -128,21 +128,31 @@ bool FSRFG_Dx12::HudlessFormatTransfer(int index, ID3D12Device* device, DXGI_FOR
         return false;
     }
 
+    auto copyCreated = false;
+
     if (_hudlessTransfer[index].get() != nullptr &&
         _hudlessTransfer[index].get()->CreateBufferResource(device, resource->GetResource(),
                                                             D3D12_RESOURCE_STATE_UNORDERED_ACCESS) &&
         (resource->cmdList == nullptr ||
          CreateBufferResource(device, resource->GetResource(), D3D12_RESOURCE_STATE_COPY_DEST,
-                              &_hudlessCopyResource[index])))
+                              &_hudlessCopyResource[index], false, false, resource->cmdList, &copyCreated)))
     {
         auto cmdList = GetUICommandList(index);
 
+        // Only interpolation rect is copied and converted
+        D3D12_BOX box {};
+        auto useBox = GetInterpolationBox(resource->type, resource->GetResource(), index, box);
+        UINT width = useBox ? box.right : 0;
+        UINT height = useBox ? box.bottom : 0;
+
         if (resource->cmdList != nullptr && _hudlessCopyResource[index] != nullptr)
         {
             ResourceBarrier(resource->cmdList, resource->GetResource(), resource->state,
                             D3D12_RESOURCE_STATE_COPY_SOURCE);
 
-            resource->cmdList->CopyResource(_hudlessCopyResource[index], resource->GetResource());
+            // New copy target is copied whole once, its contents outside of the box are undefined
+            CopyRegion(resource->cmdList, resource->GetResource(), _hudlessCopyResource[index],
+                       (useBox && !copyCreated) ? &box : nullptr);
 
             ResourceBarrier(resource->cmdList, resource->GetResource(), D3D12_RESOURCE_STATE_COPY_SOURCE,
                             resource->state);
@@ -151,7 +161,7 @@ bool FSRFG_Dx12::HudlessFormatTransfer(int index, ID3D12Device* device, DXGI_FOR
                             D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
 
             _hudlessTransfer[index].get()->Dispatch(device, cmdList, _hudlessCopyResource[index],
-                                                    _hudlessTransfer[index].get()->Buffer());
+                                                    _hudlessTransfer[index].get()->Buffer(), width, height);
 
             ResourceBarrier(cmdList, _hudlessCopyResource[index], D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE,
                             D3D12_RESOURCE_STATE_COPY_DEST);
@@ -162,7 +172,7 @@ bool FSRFG_Dx12::HudlessFormatTransfer(int index, ID3D12Device* device, DXGI_FOR
                             D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
 
             _hudlessTransfer[index].get()->Dispatch(device, cmdList, resource->GetResource(),
-                                                    _hudlessTransfer[index].get()->Buffer());
+                                                    _hudlessTransfer[index].get()->Buffer(), width, height);
 
             ResourceBarrier(cmdList, resource->GetResource(), D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE,
                             resource->state);
@@ -196,11 +206,14 @@ bool FSRFG_Dx12::UIFormatTransfer(int index, ID3D12Device* device, ID3D12Graphic
         _uiTransfer[index].get()->CreateBufferResource(device, resource->GetResource(),
                                                        D3D12_RESOURCE_STATE_UNORDERED_ACCESS))
     {
+        D3D12_BOX box {};
+        auto useBox = GetInterpolationBox(resource->type, resource->GetResource(), index, box);
+
         ResourceBarrier(cmdList, resource->GetResource(), resource->state,
                         D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
 
-        _uiTransfer[index].get()->Dispatch(device, cmdList, resource->GetResource(),
-                                           _uiTransfer[index].get()->Buffer());
+        _uiTransfer[index].get()->Dispatch(device, cmdList, resource->GetResource(), _uiTransfer[index].get()->Buffer(),
+                                           useBox ? box.right : 0, useBox ? box.bottom : 0);
 
         ResourceBarrier(cmdList, resource->GetResource(), D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE,
                         resource->state);
@@ -305,10 +318,7 @@ bool FSRFG_Dx12::Dispatch()
 
     LOG_DEBUG("_frameCount: {}, willDispatchFrame: {}, fIndex: {}", _frameCount, willDispatchFrame, fIndex);
 
-    if (!_resourceReady[fIndex].contains(FG_ResourceType::Depth) ||
-        !_resourceReady[fIndex].at(FG_ResourceType::Depth) ||
-        !_resourceReady[fIndex].contains(FG_ResourceType::Velocity) ||
-        !_resourceReady[fIndex].at(FG_ResourceType::Velocity))
+    if (!IsResourceReady(FG_ResourceType::Depth, fIndex) || !IsResourceReady(FG_ResourceType::Velocity, fIndex))
     {
         LOG_WARN("Depth or Velocity is not ready, skipping");
         return false;
@@ -617,13 +627,13 @@ ffxReturnCode_t FSRFG_Dx12::DispatchCallback(ffxDispatchDescFrameGeneration* par
 
         if (hudlessResource == nullptr)
         {
-            auto hudless = _frameResources[fIndex][FG_ResourceType::HudlessColor];
-            if (hudless.validity == FG_ResourceValidity::UntilPresent)
-                hudlessResource = hudless.GetResource();
+            auto hudless = GetResource(FG_ResourceType::HudlessColor, fIndex);
+            if (hudless != nullptr && hudless->validity == FG_ResourceValidity::UntilPresent)
+                hudlessResource = hudless->GetResource();
 
             // hudless.state only holds the state for the original resource, not the copy that we could get here
-            if (hudlessResource && hudlessResource == hudless.resource)
-                hudlessState = hudless.state;
+            if (hudlessResource && hudlessResource == hudless->resource)
+                hudlessState = hudless->state;
         }
 
         if (presentWithHud && hudlessResource)
@@ -641,9 +651,12 @@ ffxReturnCode_t FSRFG_Dx12::DispatchCallback(ffxDispatchDescFrameGeneration* par
                 // threshold
                 float hudDetectionThreshold = State::Instance().activeFgInput == FGInput::FSRFG ? 0.03f : 0.01f;
 
+                D3D12_BOX box {};
+                auto useBox = GetInterpolationBox(FG_ResourceType::HudlessColor, presentWithHud, fIndex, box);
+
                 hudCopy->Dispatch(_device, cmdList, hudlessResource, presentWithHud, hudlessState,
                                   GetD3D12State((FfxApiResourceState) params->presentColor.state),
-                                  hudDetectionThreshold);
+                                  hudDetectionThreshold, useBox ? &box : nullptr);
             }
         }
     }
@@ -1169,8 +1182,8 @@ void FSRFG_Dx12::ReleaseObjects()
         }
     }
 
-    _mvFlip.reset();
-    _depthFlip.reset();
+    _mvPrep.reset();
+    _depthPrep.reset();
 }
 
 bool FSRFG_Dx12::ExecuteCommandList(int index)
@@ -1198,8 +1211,8 @@ bool FSRFG_Dx12::SetResource(Dx12Resource* inputResource)
 
     auto& type = inputResource->type;
 
-    if (_frameResources[fIndex].contains(type) &&
-        _frameResources[fIndex][type].validity == FG_ResourceValidity::ValidNow)
+    if (_frameResources.IsPublished(fIndex, type) &&
+        _frameResources.Entry(fIndex, type).validity == FG_ResourceValidity::ValidNow)
     {
         return false;
     }
@@ -1219,16 +1232,17 @@ bool FSRFG_Dx12::SetResource(Dx12Resource* inputResource)
     if (type == FG_ResourceType::UIColor && Config::Instance()->FGDisableUI.value_or_default())
         return false;
 
-    std::lock_guard<std::mutex> lock(_frMutex);
-
     if (inputResource->cmdList == nullptr && inputResource->validity == FG_ResourceValidity::ValidNow)
     {
         LOG_ERROR("{}, validity == ValidNow but cmdList is nullptr!", magic_enum::enum_name(type));
         return false;
     }
 
-    _frameResources[fIndex][type] = {};
-    auto fResource = &_frameResources[fIndex][type];
+    // Entry is rewritten, hide it from present until it's complete again
+    _frameResources.Unpublish(fIndex, type);
+
+    auto fResource = &_frameResources.Entry(fIndex, type);
+    *fResource = {};
     fResource->type = type;
     fResource->state = inputResource->state;
     fResource->validity = inputResource->validity;
@@ -1237,15 +1251,8 @@ bool FSRFG_Dx12::SetResource(Dx12Resource* inputResource)
     fResource->height = inputResource->height;
     fResource->cmdList = inputResource->cmdList;
 
-    auto willFlip = State::Instance().activeFgInput == FGInput::Upscaler &&
-                    Config::Instance()->FGResourceFlip.value_or_default() &&
-                    (fResource->type == FG_ResourceType::Velocity || fResource->type == FG_ResourceType::Depth);
-
-    // Resource flipping
-    if (willFlip && _device != nullptr)
-    {
-        FlipResource(fResource);
-    }
+    // Flip and depth scale in one pass
+    auto prepared = PrepareResource(fResource);
 
     if (type == FG_ResourceType::UIColor)
     {
@@ -1261,7 +1268,6 @@ bool FSRFG_Dx12::SetResource(Dx12Resource* inputResource)
                 LOG_WARN("Skipping UI resource due to format mismatch! UI: {}, swapchain: {}",
                          magic_enum::enum_name(uiFormat), magic_enum::enum_name(scFormat));
 
-                _frameResources[fIndex][type] = {};
                 return false;
             }
             else
@@ -1293,7 +1299,6 @@ bool FSRFG_Dx12::SetResource(Dx12Resource* inputResource)
                          magic_enum::enum_name(_lastHudlessFormat), magic_enum::enum_name(scFfxFormat));
 
                 _lastHudlessFormat = FFX_API_SURFACE_FORMAT_UNKNOWN;
-                _frameResources[fIndex][type] = {};
                 return false;
             }
             else
@@ -1305,36 +1310,38 @@ bool FSRFG_Dx12::SetResource(Dx12Resource* inputResource)
         _noHudless[fIndex] = false;
     }
 
-    // For FSR FG we always copy ValidNow
-    if (fResource->validity == FG_ResourceValidity::ValidButMakeCopy)
+    // For FSR FG we always copy ValidNow, snapshot queue can take the copies that stay valid until present
+    auto snapshot = fResource->validity == FG_ResourceValidity::ValidButMakeCopy;
+    if (snapshot)
         fResource->validity = FG_ResourceValidity::ValidNow;
 
-    fResource->validity = (fResource->validity != FG_ResourceValidity::ValidNow || willFlip)
+    fResource->validity = (fResource->validity != FG_ResourceValidity::ValidNow || prepared)
                               ? FG_ResourceValidity::UntilPresent
                               : FG_ResourceValidity::ValidNow;
 
     // Copy ValidNow
     if (fResource->validity == FG_ResourceValidity::ValidNow)
     {
-        ID3D12Resource* copyOutput = nullptr;
+        D3D12_BOX box {};
+        auto useBox = GetInterpolationBox(type, inputResource->resource, fIndex, box);
 
-        if (_resourceCopy[fIndex].contains(type))
-            copyOutput = _resourceCopy[fIndex].at(type);
-
-        if (!CopyResource(inputResource->cmdList, inputResource->resource, &copyOutput, inputResource->state))
+        if (!(snapshot && QueueSnapshot(inputResource, inputResource->cmdList, fIndex, useBox ? &box : nullptr)) &&
+            !CopyResource(inputResource->cmdList, inputResource->resource, &_resourceCopy[fIndex][type],
+                          inputResource->state, useBox ? &box : nullptr))
         {
             LOG_ERROR("{}, CopyResource error!", magic_enum::enum_name(type));
             return false;
         }
 
+        auto copyOutput = _resourceCopy[fIndex][type];
         copyOutput->SetName(std::format(L"_resourceCopy[{}][{}]", fIndex, (UINT) type).c_str());
 
-        _resourceCopy[fIndex][type] = copyOutput;
         fResource->copy = copyOutput;
         fResource->state = D3D12_RESOURCE_STATE_COPY_DEST;
         LOG_TRACE("Made a copy: {:X} of input: {:X}", (size_t) fResource->copy, (size_t) fResource->resource);
     }
 
+    _frameResources.Publish(fIndex, type);
     SetResourceReady(type, fIndex);
 
     // if (inputResource->validity == FG_ResourceValidity::UntilPresent)
@@ -1459,6 +1466,8 @@ bool FSRFG_Dx12::Present()
 
     bool result = false;
 
+    FlushSnapshots(fIndex);
+
     // if (IsActive() && !IsPaused())
     {
         if (_uiCommandListResetted[fIndex])
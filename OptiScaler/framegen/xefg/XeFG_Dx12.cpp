@@ -174,14 +174,14 @@ xefg_swapchain_d3d12_resource_data_t XeFG_Dx12::GetResourceData(FG_ResourceType
 
     xefg_swapchain_d3d12_resource_data_t resourceParam = {};
 
-    if (!_frameResources[index].contains(type))
+    auto fResource = _frameResources.Get(index, type);
+
+    if (fResource == nullptr)
     {
         LOG_WARN("Resource type not found: {} for index: {}", magic_enum::enum_name(type), index);
         return resourceParam;
     }
 
-    auto fResource = &_frameResources[index].at(type);
-
     resourceParam.validity = (fResource->validity == FG_ResourceValidity::ValidNow)
                                  ? XEFG_SWAPCHAIN_RV_ONLY_NOW
                                  : XEFG_SWAPCHAIN_RV_UNTIL_NEXT_PRESENT;
@@ -631,10 +631,7 @@ bool XeFG_Dx12::Dispatch()
 
     LOG_DEBUG("_frameCount: {}, willDispatchFrame: {}, fIndex: {}", _frameCount, willDispatchFrame, fIndex);
 
-    if (!_resourceReady[fIndex].contains(FG_ResourceType::Depth) ||
-        !_resourceReady[fIndex].at(FG_ResourceType::Depth) ||
-        !_resourceReady[fIndex].contains(FG_ResourceType::Velocity) ||
-        !_resourceReady[fIndex].at(FG_ResourceType::Velocity))
+    if (!IsResourceReady(FG_ResourceType::Depth, fIndex) || !IsResourceReady(FG_ResourceType::Velocity, fIndex))
     {
         LOG_WARN("Depth or Velocity is not ready, skipping");
         return false;
@@ -669,7 +666,7 @@ bool XeFG_Dx12::Dispatch()
 
     if (!_noHudless[fIndex])
     {
-        auto res = &_frameResources[fIndex][FG_ResourceType::HudlessColor];
+        auto res = &_frameResources.Entry(fIndex, FG_ResourceType::HudlessColor);
         if (res->validity != FG_ResourceValidity::ValidNow)
         {
             res->validity = FG_ResourceValidity::UntilPresentFromDispatch;
@@ -680,7 +677,7 @@ bool XeFG_Dx12::Dispatch()
 
     if (!_noUi[fIndex])
     {
-        auto res = &_frameResources[fIndex][FG_ResourceType::UIColor];
+        auto res = &_frameResources.Entry(fIndex, FG_ResourceType::UIColor);
         if (res->validity != FG_ResourceValidity::ValidNow)
         {
             res->validity = FG_ResourceValidity::UntilPresentFromDispatch;
@@ -691,7 +688,7 @@ bool XeFG_Dx12::Dispatch()
 
     if (!_noDistortionField[fIndex])
     {
-        auto res = &_frameResources[fIndex][FG_ResourceType::Distortion];
+        auto res = &_frameResources.Entry(fIndex, FG_ResourceType::Distortion);
         if (res->validity != FG_ResourceValidity::ValidNow)
         {
             res->validity = FG_ResourceValidity::UntilPresentFromDispatch;
@@ -932,9 +929,8 @@ void XeFG_Dx12::EvaluateState(ID3D12Device* device, FG_Constants& fgConstants)
 
 void XeFG_Dx12::ReleaseObjects()
 {
-    _mvFlip.reset();
-    _depthFlip.reset();
-    _depthInvert.reset();
+    _mvPrep.reset();
+    _depthPrep.reset();
 }
 
 void XeFG_Dx12::CreateObjects(ID3D12Device* InDevice)
@@ -1025,6 +1021,8 @@ bool XeFG_Dx12::Present()
 
     bool result = false;
 
+    FlushSnapshots(fIndex);
+
     // if (IsActive() && !IsPaused())
     {
         if (_uiCommandListResetted[fIndex])
@@ -1072,7 +1070,7 @@ bool XeFG_Dx12::SetResource(Dx12Resource* inputResource)
         if (Config::Instance()->FGDisableHudless.value_or_default())
             return false;
 
-        if (!_noHudless[fIndex] && (_frameResources[fIndex][type].validity == FG_ResourceValidity::ValidNow))
+        if (!_noHudless[fIndex] && (_frameResources.Entry(fIndex, type).validity == FG_ResourceValidity::ValidNow))
         {
             return false;
         }
@@ -1089,7 +1087,7 @@ bool XeFG_Dx12::SetResource(Dx12Resource* inputResource)
         if (Config::Instance()->FGDisableUI.value_or_default())
             return false;
 
-        if (!_noUi[fIndex] && (_frameResources[fIndex][type].validity == FG_ResourceValidity::ValidNow))
+        if (!_noUi[fIndex] && (_frameResources.Entry(fIndex, type).validity == FG_ResourceValidity::ValidNow))
         {
             return false;
         }
@@ -1097,19 +1095,19 @@ bool XeFG_Dx12::SetResource(Dx12Resource* inputResource)
 
     if (type == FG_ResourceType::Distortion)
     {
-        if (!_noDistortionField[fIndex] && (_frameResources[fIndex][type].validity == FG_ResourceValidity::ValidNow))
+        if (!_noDistortionField[fIndex] &&
+            (_frameResources.Entry(fIndex, type).validity == FG_ResourceValidity::ValidNow))
         {
             return false;
         }
     }
 
-    if ((type == FG_ResourceType::Depth || type == FG_ResourceType::Velocity) && _frameResources[fIndex].contains(type))
+    if ((type == FG_ResourceType::Depth || type == FG_ResourceType::Velocity) &&
+        _frameResources.IsPublished(fIndex, type))
     {
         return false;
     }
 
-    std::lock_guard<std::mutex> lock(_frMutex);
-
     if (inputResource->cmdList == nullptr && inputResource->validity == FG_ResourceValidity::ValidNow)
     {
         LOG_ERROR("{}, validity == ValidNow but cmdList is nullptr!", magic_enum::enum_name(type));
@@ -1122,7 +1120,11 @@ bool XeFG_Dx12::SetResource(Dx12Resource* inputResource)
         return false;
     }
 
-    auto fResource = &_frameResources[fIndex][type];
+    // Dispatch re-sends published entries as input, keep them as they are
+    auto fResource = &_frameResources.Entry(fIndex, type);
+    if (!_frameResources.IsPublished(fIndex, type))
+        *fResource = {};
+
     fResource->type = type;
     fResource->state = inputResource->state;
     fResource->validity = inputResource->validity;
@@ -1133,70 +1135,46 @@ bool XeFG_Dx12::SetResource(Dx12Resource* inputResource)
     fResource->height = inputResource->height;
     fResource->cmdList = inputResource->cmdList;
 
-    auto willFlip = State::Instance().activeFgInput == FGInput::Upscaler &&
-                    Config::Instance()->FGResourceFlip.value_or_default() &&
-                    (type == FG_ResourceType::Velocity || type == FG_ResourceType::Depth);
-
-    // Resource flipping
-    if (willFlip && _device != nullptr)
-        FlipResource(fResource);
+    static auto version = Version();
 
     // Depth Invert
     // https://github.com/intel/xess/issues/50
-    static auto version = Version();
-
     // SDK version 2.1.1 fixed this
-    if (version < feature_version { 1, 2, 2 } && _device != nullptr && type == FG_ResourceType::Depth &&
-        !Config::Instance()->FGXeFGDepthInverted.value_or_default())
-    {
-        if (_depthInvert.get() == nullptr)
-        {
-            _depthInvert = std::make_unique<DI_Dx12>("DepthInvert", _device);
-        }
-        else if (_depthInvert->IsInit())
-        {
-            if (_depthInvert->CreateBufferResource(_device, fResource->GetResource(), fResource->width,
-                                                   fResource->height, fResource->state) &&
-                _depthInvert->Buffer() != nullptr)
-            {
-                auto cmdList = (fResource->cmdList != nullptr) ? fResource->cmdList : GetUICommandList(fIndex);
-
-                _depthInvert->SetBufferState(cmdList, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
+    uint32_t prepFlags = FGP_None;
+    if (version < feature_version { 1, 2, 2 } && !Config::Instance()->FGXeFGDepthInverted.value_or_default())
+        prepFlags |= FGP_DepthInvert;
 
-                if (_depthInvert->Dispatch(_device, cmdList, fResource->GetResource(), _depthInvert->Buffer()))
-                {
-                    fResource->copy = _depthInvert->Buffer();
-                }
-
-                _depthInvert->SetBufferState(cmdList, fResource->state);
-            }
-        }
-    }
+    // Flip, depth scale and invert in one pass
+    auto prepared = PrepareResource(fResource, prepFlags);
 
     // We usually don't copy any resources for XeFG, the ones with this tag are the exception
+    // Prepared resources are already copies
     if (inputResource->cmdList != nullptr && fResource->validity == FG_ResourceValidity::ValidButMakeCopy)
     {
         LOG_DEBUG("Making a resource copy of: {}", magic_enum::enum_name(type));
 
-        ID3D12Resource* copyOutput = nullptr;
+        D3D12_BOX box {};
+        auto useBox = GetInterpolationBox(type, inputResource->resource, fIndex, box);
 
-        if (_resourceCopy[fIndex].contains(type))
-            copyOutput = _resourceCopy[fIndex][type];
-
-        if (!CopyResource(inputResource->cmdList, inputResource->resource, &copyOutput, inputResource->state))
+        // Copy on the snapshot queue when enabled, on the game's cmdList otherwise
+        if (!QueueSnapshot(inputResource, inputResource->cmdList, fIndex, useBox ? &box : nullptr) &&
+            !CopyResource(inputResource->cmdList, inputResource->resource, &_resourceCopy[fIndex][type],
+                          inputResource->state, useBox ? &box : nullptr))
         {
             LOG_ERROR("{}, CopyResource error!", magic_enum::enum_name(type));
             return false;
         }
 
-        _resourceCopy[fIndex][type] = copyOutput;
-        _resourceCopy[fIndex][type]->SetName(std::format(L"_resourceCopy[{}][{}]", fIndex, (UINT) type).c_str());
+        auto copyOutput = _resourceCopy[fIndex][type];
+        copyOutput->SetName(std::format(L"_resourceCopy[{}][{}]", fIndex, (UINT) type).c_str());
         fResource->copy = copyOutput;
         fResource->state = D3D12_RESOURCE_STATE_COPY_DEST;
 
         fResource->validity = FG_ResourceValidity::UntilPresent;
     }
 
+    _frameResources.Publish(fIndex, type);
+
     if (type == FG_ResourceType::UIColor)
         _noUi[fIndex] = false;
     else if (type == FG_ResourceType::Distortion)
@@ -1208,7 +1186,7 @@ bool XeFG_Dx12::SetResource(Dx12Resource* inputResource)
         (fResource->validity != FG_ResourceValidity::UntilPresent &&
          fResource->validity != FG_ResourceValidity::JustTrackCmdlist))
     {
-        fResource->validity = (fResource->validity != FG_ResourceValidity::ValidNow || willFlip)
+        fResource->validity = (fResource->validity != FG_ResourceValidity::ValidNow || prepared)
                                   ? FG_ResourceValidity::UntilPresent
                                   : FG_ResourceValidity::ValidNow;
 
@@ -5,8 +5,6 @@
 #include <proxies/XeLL_Proxy.h>
 #include <proxies/XeFG_Proxy.h>
 
-#include "shaders/depth_invert/DI_Dx12.h"
-
 #include <xell.h>
 #include <xell_d3d12.h>
 #include <xefg_swapchain.h>
@@ -24,8 +22,6 @@ class XeFG_Dx12 : public virtual IFGFeature_Dx12
     bool _infiniteDepth = false;
     std::optional<bool> _haveHudless = std::nullopt;
 
-    std::unique_ptr<DI_Dx12> _depthInvert;
-
     static void xefgLogCallback(const char* message, xefg_swapchain_logging_level_t level, void* userData);
 
     bool CreateSwapchainContext(ID3D12Device* device);
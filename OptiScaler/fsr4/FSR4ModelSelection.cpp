@@ -82,7 +82,7 @@ void FSR4ModelSelection::Hook(HMODULE module, bool unhookOld)
 
     if (o_getModelBlob == nullptr && o_createModel == nullptr)
     {
-        const char* pattern = "83 F9 05 0F 87";
+        static const scanner::Pattern pattern("83 F9 05 0F 87");
         o_getModelBlob = (PFN_getModelBlob) scanner::GetAddress(module, pattern);
 
         if (o_getModelBlob)
@@ -99,9 +99,9 @@ void FSR4ModelSelection::Hook(HMODULE module, bool unhookOld)
         else
         {
             // From amd_fidelityfx_upscaler_dx12 4.0.3.604
-            const char* pattern =
+            static const scanner::Pattern pattern(
                 "48 89 5C 24 ? 55 56 57 41 54 41 55 41 56 41 57 48 8D AC 24 ? ? ? ? B8 ? ? ? ? E8 ? ? ? ? 48 2B E0 0F "
-                "29 B4 24 ? ? ? ? 0F 29 BC 24 ? ? ? ? 48 8B 05 ? ? ? ? 48 33 C4 48 89 85 ? ? ? ? 44 8B F2";
+                "29 B4 24 ? ? ? ? 0F 29 BC 24 ? ? ? ? 48 8B 05 ? ? ? ? 48 33 C4 48 89 85 ? ? ? ? 44 8B F2");
             o_createModel = (PFN_createModel) scanner::GetAddress(module, pattern);
 
             if (o_createModel)
@@ -5,6 +5,8 @@
 
 #include <proxies/KernelBase_Proxy.h>
 
+#include <misc/DeferredInit.h>
+
 #include <wrapped/wrapped_swapchain.h>
 
 #include <detours/detours.h>
@@ -142,6 +144,9 @@ static HRESULT hkD3D11CreateDevice(IDXGIAdapter* pAdapter, D3D_DRIVER_TYPE Drive
 
     LOG_DEBUG("Caller: {}", Util::WhoIsTheCaller(_ReturnAddress()));
 
+    // Exe input hooks must be in place before the game can create its FSR contexts
+    DeferredInit::Run();
+
 #ifdef ENABLE_DEBUG_LAYER_DX11
     Flags |= D3D11_CREATE_DEVICE_DEBUG;
 #endif
@@ -249,6 +254,9 @@ static HRESULT hkD3D11CreateDeviceAndSwapChain(IDXGIAdapter* pAdapter, D3D_DRIVE
 
     LOG_DEBUG("Caller: {}", Util::WhoIsTheCaller(_ReturnAddress()));
 
+    // Exe input hooks must be in place before the game can create its FSR contexts
+    DeferredInit::Run();
+
 #ifdef ENABLE_DEBUG_LAYER_DX11
     Flags |= D3D11_CREATE_DEVICE_DEBUG;
 #endif
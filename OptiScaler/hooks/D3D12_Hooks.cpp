@@ -4,6 +4,10 @@
 #include <Config.h>
 
 #include <resource_tracking/ResTrack_Dx12.h>
+#include <misc/DeferredInit.h>
+#include <misc/HookProfiler.h>
+#include <misc/RootSignatureCache.h>
+#include <misc/SamplerOverrides.h>
 
 #include <proxies/D3D12_Proxy.h>
 #include <proxies/IGDExt_Proxy.h>
@@ -11,7 +15,10 @@
 
 #include <detours/detours.h>
 
+#include <ankerl/unordered_dense.h>
+
 #include <dxgi1_6.h>
+#include <string_view>
 
 #pragma intrinsic(_ReturnAddress)
 
@@ -108,135 +115,88 @@ static void CALLBACK D3D12DebugCallback(D3D12_MESSAGE_CATEGORY Category, D3D12_M
 static void HookToDevice(ID3D12Device* InDevice);
 static void UnhookDevice();
 
-static inline D3D12_FILTER UpgradeToAF(D3D12_FILTER f)
-{
-    // Skip point filter
-    const auto minF = D3D12_DECODE_MIN_FILTER(f);
-    const auto magF = D3D12_DECODE_MAG_FILTER(f);
-    const auto mipF = D3D12_DECODE_MIP_FILTER(f);
-    if (Config::Instance()->AnisotropySkipPointFilter.value_or_default() &&
-        ((mipF == D3D12_FILTER_TYPE_POINT) || (minF == D3D12_FILTER_TYPE_POINT && magF == D3D12_FILTER_TYPE_POINT)))
-    {
-        return f;
-    }
-
-    const auto reduction = D3D12_DECODE_FILTER_REDUCTION(f);
-
-    if (reduction == D3D12_FILTER_REDUCTION_TYPE_COMPARISON)
-    {
-        if (Config::Instance()->AnisotropyModifyComp.value_or_default())
-            return D3D12_ENCODE_ANISOTROPIC_FILTER(D3D12_FILTER_REDUCTION_TYPE_COMPARISON);
+// Collects biases written while a root signature is rewritten, so cache hits can update stats too
+static thread_local bool _collectMipBias = false;
+static thread_local bool _collectedHasMipBias = false;
+static thread_local float _collectedMinMipBias = 0.0f;
+static thread_local float _collectedMaxMipBias = 0.0f;
 
-        return f;
-    }
+static void UpdateMipBiasStats(float mipBias)
+{
+    if (State::Instance().lastMipBiasMax < mipBias)
+        State::Instance().lastMipBiasMax = mipBias;
 
-    if (reduction == D3D12_FILTER_REDUCTION_TYPE_MINIMUM)
-    {
-        if (Config::Instance()->AnisotropyModifyMinMax.value_or_default())
-            return D3D12_ENCODE_ANISOTROPIC_FILTER(D3D12_FILTER_REDUCTION_TYPE_MINIMUM);
+    if (State::Instance().lastMipBias > mipBias)
+        State::Instance().lastMipBias = mipBias;
 
-        return f;
-    }
+    if (!_collectMipBias)
+        return;
 
-    if (reduction == D3D12_FILTER_REDUCTION_TYPE_MAXIMUM)
+    if (!_collectedHasMipBias)
     {
-        if (Config::Instance()->AnisotropyModifyMinMax.value_or_default())
-            return D3D12_ENCODE_ANISOTROPIC_FILTER(D3D12_FILTER_REDUCTION_TYPE_MAXIMUM);
-
-        return f;
+        _collectedHasMipBias = true;
+        _collectedMinMipBias = mipBias;
+        _collectedMaxMipBias = mipBias;
+        return;
     }
 
-    return D3D12_ENCODE_ANISOTROPIC_FILTER(D3D12_FILTER_REDUCTION_TYPE_STANDARD);
+    _collectedMinMipBias = std::min(_collectedMinMipBias, mipBias);
+    _collectedMaxMipBias = std::max(_collectedMaxMipBias, mipBias);
 }
 
-static void ApplySamplerOverrides(D3D12_STATIC_SAMPLER_DESC& samplerDesc)
+static void ApplySamplerOverrides(D3D12_STATIC_SAMPLER_DESC& samplerDesc, const SamplerOverridePolicy& policy)
 {
-    if (Config::Instance()->MipmapBiasOverride.has_value())
+    if (policy.mipBiasEnabled)
     {
         auto isMipmapped = samplerDesc.MinLOD != samplerDesc.MaxLOD;
         auto isAnisotropic = (samplerDesc.Filter == D3D12_FILTER_ANISOTROPIC) || (samplerDesc.MaxAnisotropy > 1);
         auto isAlreadyBiased = samplerDesc.MipLODBias < 0.0f;
 
-        if ((isMipmapped && (isAnisotropic || isAlreadyBiased)) ||
-            Config::Instance()->MipmapBiasOverrideAll.value_or_default())
+        if ((isMipmapped && (isAnisotropic || isAlreadyBiased)) || policy.mipBiasAll)
         {
-            if (Config::Instance()->MipmapBiasOverride.has_value())
-            {
-                LOG_DEBUG("Overriding mipmap bias {0} -> {1}", samplerDesc.MipLODBias,
-                          Config::Instance()->MipmapBiasOverride.value());
-
-                if (Config::Instance()->MipmapBiasFixedOverride.value_or_default())
-                    samplerDesc.MipLODBias = Config::Instance()->MipmapBiasOverride.value();
-                else if (Config::Instance()->MipmapBiasScaleOverride.value_or_default())
-                    samplerDesc.MipLODBias = samplerDesc.MipLODBias * Config::Instance()->MipmapBiasOverride.value();
-                else
-                    samplerDesc.MipLODBias = samplerDesc.MipLODBias + Config::Instance()->MipmapBiasOverride.value();
-            }
-
-            if (State::Instance().lastMipBiasMax < samplerDesc.MipLODBias)
-                State::Instance().lastMipBiasMax = samplerDesc.MipLODBias;
-
-            if (State::Instance().lastMipBias > samplerDesc.MipLODBias)
-                State::Instance().lastMipBias = samplerDesc.MipLODBias;
+            samplerDesc.MipLODBias = policy.ApplyMipBias(samplerDesc.MipLODBias);
+            UpdateMipBiasStats(samplerDesc.MipLODBias);
         }
     }
 
     samplerDesc.MipLODBias = std::clamp(samplerDesc.MipLODBias, -16.0f, 15.99f);
 
-    if (Config::Instance()->AnisotropyOverride.has_value())
+    if (policy.anisotropyEnabled)
     {
-        LOG_DEBUG("Overriding {2:X} to anisotropic filtering {0} -> {1}", samplerDesc.MaxAnisotropy,
-                  Config::Instance()->AnisotropyOverride.value(), (UINT) samplerDesc.Filter);
-
-        samplerDesc.Filter = UpgradeToAF(samplerDesc.Filter);
-        samplerDesc.MaxAnisotropy = Config::Instance()->AnisotropyOverride.value();
+        samplerDesc.Filter = policy.UpgradeFilter(samplerDesc.Filter);
+        samplerDesc.MaxAnisotropy = policy.anisotropy;
     }
 }
 
-static void ApplySamplerOverrides(D3D12_STATIC_SAMPLER_DESC1& samplerDesc)
+static void ApplySamplerOverrides(D3D12_STATIC_SAMPLER_DESC1& samplerDesc, const SamplerOverridePolicy& policy)
 {
-    if (Config::Instance()->MipmapBiasOverride.has_value())
+    if (policy.mipBiasEnabled)
     {
-        if ((samplerDesc.MipLODBias < 0.0f && samplerDesc.MinLOD != samplerDesc.MaxLOD) ||
-            Config::Instance()->MipmapBiasOverrideAll.value_or_default())
+        if ((samplerDesc.MipLODBias < 0.0f && samplerDesc.MinLOD != samplerDesc.MaxLOD) || policy.mipBiasAll)
         {
-            if (Config::Instance()->MipmapBiasOverride.has_value())
-            {
-                LOG_DEBUG("Overriding mipmap bias {0} -> {1}", samplerDesc.MipLODBias,
-                          Config::Instance()->MipmapBiasOverride.value());
-
-                if (Config::Instance()->MipmapBiasFixedOverride.value_or_default())
-                    samplerDesc.MipLODBias = Config::Instance()->MipmapBiasOverride.value();
-                else if (Config::Instance()->MipmapBiasScaleOverride.value_or_default())
-                    samplerDesc.MipLODBias = samplerDesc.MipLODBias * Config::Instance()->MipmapBiasOverride.value();
-                else
-                    samplerDesc.MipLODBias = samplerDesc.MipLODBias + Config::Instance()->MipmapBiasOverride.value();
-            }
-
-            if (State::Instance().lastMipBiasMax < samplerDesc.MipLODBias)
-                State::Instance().lastMipBiasMax = samplerDesc.MipLODBias;
-
-            if (State::Instance().lastMipBias > samplerDesc.MipLODBias)
-                State::Instance().lastMipBias = samplerDesc.MipLODBias;
+            samplerDesc.MipLODBias = policy.ApplyMipBias(samplerDesc.MipLODBias);
+            UpdateMipBiasStats(samplerDesc.MipLODBias);
         }
     }
 
-    if (Config::Instance()->AnisotropyOverride.has_value())
+    if (policy.anisotropyEnabled)
     {
-        LOG_DEBUG("Overriding {2:X} to anisotropic filtering {0} -> {1}", samplerDesc.MaxAnisotropy,
-                  Config::Instance()->AnisotropyOverride.value(), (UINT) samplerDesc.Filter);
-
-        samplerDesc.Filter = UpgradeToAF(samplerDesc.Filter);
-        samplerDesc.MaxAnisotropy = Config::Instance()->AnisotropyOverride.value();
+        samplerDesc.Filter = policy.UpgradeFilter(samplerDesc.Filter);
+        samplerDesc.MaxAnisotropy = policy.anisotropy;
     }
 }
 
 static HRESULT hkD3D12CreateDevice(IDXGIAdapter* pAdapter, D3D_FEATURE_LEVEL MinimumFeatureLevel, REFIID riid,
                                    void** ppDevice)
 {
+    HookProfiler::Scope profile(ProfiledHook::D3D12_CreateDevice);
+
     LOG_DEBUG("Adapter: {:X}, Level: {:X}, Caller: {}", (size_t) pAdapter, (UINT) MinimumFeatureLevel,
               Util::WhoIsTheCaller(_ReturnAddress()));
 
+    // Exe input hooks must be in place before the game can create its FSR contexts
+    DeferredInit::Run();
+
 #ifdef ENABLE_DEBUG_LAYER_DX12
     LOG_WARN("Debug layers active!");
     if (debugController == nullptr && D3D12GetDebugInterface(IID_PPV_ARGS(&debugController)) == S_OK)
@@ -276,7 +236,7 @@ static HRESULT hkD3D12CreateDevice(IDXGIAdapter* pAdapter, D3D_FEATURE_LEVEL Min
     {
         LOG_ERROR("ppDevice is nullptr");
         _creatingD3D12Device = true;
-        auto result = o_D3D12CreateDevice(pAdapter, minLevel, riid, ppDevice);
+        auto result = profile.Call(o_D3D12CreateDevice, pAdapter, minLevel, riid, ppDevice);
         _creatingD3D12Device = false;
         return result;
     }
@@ -286,11 +246,11 @@ static HRESULT hkD3D12CreateDevice(IDXGIAdapter* pAdapter, D3D_FEATURE_LEVEL Min
     if (desc.VendorId == VendorId::Intel)
     {
         ScopedSkipSpoofing skipSpoofing {};
-        result = o_D3D12CreateDevice(pAdapter, minLevel, riid, ppDevice);
+        result = profile.Call(o_D3D12CreateDevice, pAdapter, minLevel, riid, ppDevice);
     }
     else
     {
-        result = o_D3D12CreateDevice(pAdapter, minLevel, riid, ppDevice);
+        result = profile.Call(o_D3D12CreateDevice, pAdapter, minLevel, riid, ppDevice);
     }
     _creatingD3D12Device = false;
 
@@ -360,15 +320,20 @@ static HRESULT hkD3D12CreateDevice(IDXGIAdapter* pAdapter, D3D_FEATURE_LEVEL Min
 static HRESULT hkCreateDevice(ID3D12DeviceFactory* pFactory, IDXGIAdapter* pAdapter,
                               D3D_FEATURE_LEVEL MinimumFeatureLevel, REFIID riid, void** ppDevice)
 {
+    HookProfiler::Scope profile(ProfiledHook::D3D12_FactoryCreateDevice);
+
     LOG_DEBUG("Adapter: {:X}, Level: {:X}, Caller: {}", (size_t) pAdapter, (UINT) MinimumFeatureLevel,
               Util::WhoIsTheCaller(_ReturnAddress()));
 
     if (_creatingD3D12Device)
     {
         LOG_DEBUG("Calling from hkD3D12CreateDevice, calling original CreateDevice");
-        return o_CreateDevice(pFactory, pAdapter, MinimumFeatureLevel, riid, ppDevice);
+        return profile.Call(o_CreateDevice, pFactory, pAdapter, MinimumFeatureLevel, riid, ppDevice);
     }
 
+    // Exe input hooks must be in place before the game can create its FSR contexts
+    DeferredInit::Run();
+
 #ifdef ENABLE_DEBUG_LAYER_DX12
     LOG_WARN("Debug layers active!");
     if (debugController == nullptr && D3D12GetDebugInterface(IID_PPV_ARGS(&debugController)) == S_OK)
@@ -407,18 +372,18 @@ static HRESULT hkCreateDevice(ID3D12DeviceFactory* pFactory, IDXGIAdapter* pAdap
     if (ppDevice == nullptr)
     {
         LOG_ERROR("ppDevice is nullptr");
-        return o_CreateDevice(pFactory, pAdapter, minLevel, riid, ppDevice);
+        return profile.Call(o_CreateDevice, pFactory, pAdapter, minLevel, riid, ppDevice);
     }
 
     HRESULT result;
     if (desc.VendorId == VendorId::Intel)
     {
         ScopedSkipSpoofing skipSpoofing {};
-        result = o_CreateDevice(pFactory, pAdapter, minLevel, riid, ppDevice);
+        result = profile.Call(o_CreateDevice, pFactory, pAdapter, minLevel, riid, ppDevice);
     }
     else
     {
-        result = o_CreateDevice(pFactory, pAdapter, minLevel, riid, ppDevice);
+        result = profile.Call(o_CreateDevice, pFactory, pAdapter, minLevel, riid, ppDevice);
     }
 
     LOG_DEBUG("o_D3D12CreateDevice result: {:X}", (UINT) result);
@@ -488,50 +453,60 @@ static HRESULT hkD3D12SerializeRootSignature(D3d12Proxy::D3D12_ROOT_SIGNATURE_DE
                                              D3D_ROOT_SIGNATURE_VERSION Version, ID3DBlob** ppBlob,
                                              ID3DBlob** ppErrorBlob)
 {
+    HookProfiler::Scope profile(ProfiledHook::D3D12_SerializeRootSignature);
+
     if (pRootSignature != nullptr)
     {
+        auto& policy = SamplerOverrides::Policy();
+
         for (size_t i = 0; i < pRootSignature->NumStaticSamplers; i++)
         {
-            ApplySamplerOverrides(pRootSignature->pStaticSamplers[i]);
+            ApplySamplerOverrides(pRootSignature->pStaticSamplers[i], policy);
         }
     }
 
-    return o_D3D12SerializeRootSignature(pRootSignature, Version, ppBlob, ppErrorBlob);
+    return profile.Call(o_D3D12SerializeRootSignature, pRootSignature, Version, ppBlob, ppErrorBlob);
 }
 
 static HRESULT hkD3D12SerializeVersionedRootSignature(D3d12Proxy::D3D12_VERSIONED_ROOT_SIGNATURE_DESC_L* pRootSignature,
                                                       ID3DBlob** ppBlob, ID3DBlob** ppErrorBlob)
 {
+    HookProfiler::Scope profile(ProfiledHook::D3D12_SerializeVersionedRootSignature);
+
     if (pRootSignature != nullptr)
     {
+        auto& policy = SamplerOverrides::Policy();
+
         if (pRootSignature->Version == D3D_ROOT_SIGNATURE_VERSION_1_0)
         {
             for (size_t i = 0; i < pRootSignature->Desc_1_0.NumStaticSamplers; i++)
             {
-                ApplySamplerOverrides(pRootSignature->Desc_1_0.pStaticSamplers[i]);
+                ApplySamplerOverrides(pRootSignature->Desc_1_0.pStaticSamplers[i], policy);
             }
         }
         else if (pRootSignature->Version == D3D_ROOT_SIGNATURE_VERSION_1_1)
         {
             for (size_t i = 0; i < pRootSignature->Desc_1_1.NumStaticSamplers; i++)
             {
-                ApplySamplerOverrides(pRootSignature->Desc_1_1.pStaticSamplers[i]);
+                ApplySamplerOverrides(pRootSignature->Desc_1_1.pStaticSamplers[i], policy);
             }
         }
         else if (pRootSignature->Version == D3D_ROOT_SIGNATURE_VERSION_1_2)
         {
             for (size_t i = 0; i < pRootSignature->Desc_1_2.NumStaticSamplers; i++)
             {
-                ApplySamplerOverrides(pRootSignature->Desc_1_2.pStaticSamplers[i]);
+                ApplySamplerOverrides(pRootSignature->Desc_1_2.pStaticSamplers[i], policy);
             }
         }
     }
 
-    return o_D3D12SerializeVersionedRootSignature(pRootSignature, ppBlob, ppErrorBlob);
+    return profile.Call(o_D3D12SerializeVersionedRootSignature, pRootSignature, ppBlob, ppErrorBlob);
 }
 
 static ULONG hkD3D12DeviceRelease(IUnknown* device)
 {
+    HookProfiler::Scope profile(ProfiledHook::D3D12_DeviceRelease);
+
     if (Config::Instance()->UESpoofIntelAtomics64.value_or_default() && device == _intelD3D12Device)
     {
         auto refCount = device->AddRef();
@@ -543,12 +518,12 @@ static ULONG hkD3D12DeviceRelease(IUnknown* device)
             IGDExtProxy::DestroyContext();
         }
 
-        o_D3D12DeviceRelease(device);
+        profile.Call(o_D3D12DeviceRelease, device);
     }
     else if (State::Instance().currentD3D12Device == device)
     {
         device->AddRef();
-        auto refCount = o_D3D12DeviceRelease(device);
+        auto refCount = profile.Call(o_D3D12DeviceRelease, device);
         LOG_DEBUG("Found currentD3D12Device: {:X}, refCount: {}", (size_t) device, refCount);
 
         if (refCount == 1)
@@ -558,14 +533,16 @@ static ULONG hkD3D12DeviceRelease(IUnknown* device)
         }
     }
 
-    auto result = o_D3D12DeviceRelease(device);
+    auto result = profile.Call(o_D3D12DeviceRelease, device);
     return result;
 }
 
 static HRESULT hkCheckFeatureSupport(ID3D12Device* device, D3D12_FEATURE Feature, void* pFeatureSupportData,
                                      UINT FeatureSupportDataSize)
 {
-    auto result = o_CheckFeatureSupport(device, Feature, pFeatureSupportData, FeatureSupportDataSize);
+    HookProfiler::Scope profile(ProfiledHook::D3D12_CheckFeatureSupport);
+
+    auto result = profile.Call(o_CheckFeatureSupport, device, Feature, pFeatureSupportData, FeatureSupportDataSize);
 
     if (Config::Instance()->UESpoofIntelAtomics64.value_or_default() && Feature == D3D12_FEATURE_D3D12_OPTIONS9 &&
         device == State::Instance().currentD3D12Device)
@@ -586,6 +563,8 @@ static HRESULT hkCreateCommittedResource(ID3D12Device* device, const D3D12_HEAP_
                                          const D3D12_CLEAR_VALUE* pOptimizedClearValue, REFIID riidResource,
                                          void** ppvResource)
 {
+    HookProfiler::Scope profile(ProfiledHook::D3D12_CreateCommittedResource);
+
     if (!_skipCommitedResource)
     {
         auto ueDesc = reinterpret_cast<UE_D3D12_RESOURCE_DESC*>(pDesc);
@@ -604,8 +583,8 @@ static HRESULT hkCreateCommittedResource(ID3D12Device* device, const D3D12_HEAP_
         }
     }
 
-    return o_CreateCommittedResource(device, pHeapProperties, HeapFlags, pDesc, InitialResourceState,
-                                     pOptimizedClearValue, riidResource, ppvResource);
+    return profile.Call(o_CreateCommittedResource, device, pHeapProperties, HeapFlags, pDesc, InitialResourceState,
+                        pOptimizedClearValue, riidResource, ppvResource);
 }
 
 static bool skipPlacedResource = false;
@@ -614,6 +593,8 @@ static HRESULT hkCreatePlacedResource(ID3D12Device* device, ID3D12Heap* pHeap, U
                                       D3D12_RESOURCE_DESC* pDesc, D3D12_RESOURCE_STATES InitialState,
                                       const D3D12_CLEAR_VALUE* pOptimizedClearValue, REFIID riid, void** ppvResource)
 {
+    HookProfiler::Scope profile(ProfiledHook::D3D12_CreatePlacedResource);
+
     if (!skipPlacedResource)
     {
         auto ueDesc = reinterpret_cast<UE_D3D12_RESOURCE_DESC*>(pDesc);
@@ -631,8 +612,8 @@ static HRESULT hkCreatePlacedResource(ID3D12Device* device, ID3D12Heap* pHeap, U
         }
     }
 
-    return o_CreatePlacedResource(device, pHeap, HeapOffset, pDesc, InitialState, pOptimizedClearValue, riid,
-                                  ppvResource);
+    return profile.Call(o_CreatePlacedResource, device, pHeap, HeapOffset, pDesc, InitialState, pOptimizedClearValue,
+                        riid, ppvResource);
 }
 
 /*
@@ -677,63 +658,79 @@ hkGetResourceAllocationInfo(ID3D12Device* device, D3D12_RESOURCE_ALLOCATION_INFO
     return pResult;
 }
 
-static void hkCreateSampler(ID3D12Device* device, const D3D12_SAMPLER_DESC* pDesc,
-                            D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor)
+// Translated sampler descs of a thread, direct mapped by input desc hash
+struct SamplerMemoEntry
 {
-    if (pDesc == nullptr || device == nullptr)
-        return;
+    const SamplerOverridePolicy* policy = nullptr;
+    bool mipBiased = false;
+    D3D12_SAMPLER_DESC input {};
+    D3D12_SAMPLER_DESC output {};
+};
 
-    D3D12_SAMPLER_DESC newDesc = *pDesc;
+constexpr size_t SAMPLER_MEMO_SIZE = 256;
+static thread_local std::unique_ptr<SamplerMemoEntry[]> _samplerMemo;
 
-    if (Config::Instance()->AnisotropyOverride.has_value())
-    {
-        LOG_DEBUG("Overriding {2:X} to anisotropic filtering {0} -> {1}", pDesc->MaxAnisotropy,
-                  Config::Instance()->AnisotropyOverride.value(), (UINT) newDesc.Filter);
+// Returns true when mip bias stats need to be updated
+static bool TranslateSampler(const D3D12_SAMPLER_DESC& desc, const SamplerOverridePolicy& policy,
+                             D3D12_SAMPLER_DESC& newDesc)
+{
+    newDesc = desc;
 
-        newDesc.Filter = UpgradeToAF(pDesc->Filter);
-        newDesc.MaxAnisotropy = Config::Instance()->AnisotropyOverride.value();
-    }
-    else
+    if (policy.anisotropyEnabled)
     {
-        newDesc.Filter = pDesc->Filter;
-        newDesc.MaxAnisotropy = pDesc->MaxAnisotropy;
+        newDesc.Filter = policy.UpgradeFilter(desc.Filter);
+        newDesc.MaxAnisotropy = policy.anisotropy;
     }
 
-    if ((newDesc.MipLODBias < 0.0f && newDesc.MinLOD != newDesc.MaxLOD) ||
-        Config::Instance()->MipmapBiasOverrideAll.value_or_default())
+    if ((newDesc.MipLODBias < 0.0f && newDesc.MinLOD != newDesc.MaxLOD) || policy.mipBiasAll)
     {
-        if (Config::Instance()->MipmapBiasOverride.has_value())
-        {
-            LOG_DEBUG("Overriding mipmap bias {0} -> {1}", pDesc->MipLODBias,
-                      Config::Instance()->MipmapBiasOverride.value());
+        if (policy.mipBiasEnabled)
+            newDesc.MipLODBias = policy.ApplyMipBias(newDesc.MipLODBias);
 
-            if (Config::Instance()->MipmapBiasFixedOverride.value_or_default())
-                newDesc.MipLODBias = Config::Instance()->MipmapBiasOverride.value();
-            else if (Config::Instance()->MipmapBiasScaleOverride.value_or_default())
-                newDesc.MipLODBias = newDesc.MipLODBias * Config::Instance()->MipmapBiasOverride.value();
-            else
-                newDesc.MipLODBias = newDesc.MipLODBias + Config::Instance()->MipmapBiasOverride.value();
-        }
-
-        if (State::Instance().lastMipBiasMax < newDesc.MipLODBias)
-            State::Instance().lastMipBiasMax = newDesc.MipLODBias;
-
-        if (State::Instance().lastMipBias > newDesc.MipLODBias)
-            State::Instance().lastMipBias = newDesc.MipLODBias;
+        return true;
     }
 
-    return o_CreateSampler(device, &newDesc, DestDescriptor);
+    return false;
 }
 
-static HRESULT hkCreateRootSignature(ID3D12Device* device, UINT nodeMask, const void* pBlobWithRootSignature,
-                                     SIZE_T blobLengthInBytes, REFIID riid, void** ppvRootSignature)
+static void hkCreateSampler(ID3D12Device* device, const D3D12_SAMPLER_DESC* pDesc,
+                            D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor)
 {
-    if (!Config::Instance()->MipmapBiasOverride.has_value() && !Config::Instance()->AnisotropyOverride.has_value())
+    HookProfiler::Scope profile(ProfiledHook::D3D12_CreateSampler);
+
+    if (pDesc == nullptr || device == nullptr)
+        return;
+
+    auto& policy = SamplerOverrides::Policy();
+
+    if (_samplerMemo == nullptr)
+        _samplerMemo = std::make_unique<SamplerMemoEntry[]>(SAMPLER_MEMO_SIZE);
+
+    auto hash =
+        ankerl::unordered_dense::hash<std::string_view> {}(std::string_view((const char*) pDesc, sizeof(*pDesc)));
+    auto& entry = _samplerMemo[hash & (SAMPLER_MEMO_SIZE - 1)];
+
+    // Policies are never freed, so pointer also tells if config is changed
+    if (entry.policy != &policy || std::memcmp(&entry.input, pDesc, sizeof(*pDesc)) != 0)
     {
-        return o_CreateRootSignature(device, nodeMask, pBlobWithRootSignature, blobLengthInBytes, riid,
-                                     ppvRootSignature);
+        entry.policy = &policy;
+        entry.input = *pDesc;
+        entry.mipBiased = TranslateSampler(*pDesc, policy, entry.output);
     }
 
+    if (entry.mipBiased)
+        UpdateMipBiasStats(entry.output.MipLODBias);
+
+    // Copy as original call might end up here again on this thread
+    D3D12_SAMPLER_DESC newDesc = entry.output;
+
+    return profile.Call(o_CreateSampler, device, &newDesc, DestDescriptor);
+}
+
+// Deserializer & serializer round trip, used when blob can't be patched in place
+static bool ReserializeRootSignature(const void* pBlobWithRootSignature, SIZE_T blobLengthInBytes,
+                                     const SamplerOverridePolicy& policy, std::vector<uint8_t>& output)
+{
     ID3D12VersionedRootSignatureDeserializer* deserializer = nullptr;
     auto result = D3d12Proxy::D3D12CreateVersionedRootSignatureDeserializer_()(
         pBlobWithRootSignature, blobLengthInBytes, IID_PPV_ARGS(&deserializer));
@@ -742,8 +739,7 @@ static HRESULT hkCreateRootSignature(ID3D12Device* device, UINT nodeMask, const
     if (FAILED(result))
     {
         LOG_ERROR("Failed to create deserializer, error: {:X}", (UINT) result);
-        return o_CreateRootSignature(device, nodeMask, pBlobWithRootSignature, blobLengthInBytes, riid,
-                                     ppvRootSignature);
+        return false;
     }
 
     const D3D12_VERSIONED_ROOT_SIGNATURE_DESC* desc = deserializer->GetUnconvertedRootSignatureDesc();
@@ -764,7 +760,7 @@ static HRESULT hkCreateRootSignature(ID3D12Device* device, UINT nodeMask, const
                             descCopy.Desc_1_0.pStaticSamplers + descCopy.Desc_1_0.NumStaticSamplers);
 
             for (auto& s : samplers)
-                ApplySamplerOverrides(s);
+                ApplySamplerOverrides(s, policy);
 
             descCopy.Desc_1_0.pStaticSamplers = samplers.data();
         }
@@ -777,7 +773,7 @@ static HRESULT hkCreateRootSignature(ID3D12Device* device, UINT nodeMask, const
                             descCopy.Desc_1_1.pStaticSamplers + descCopy.Desc_1_1.NumStaticSamplers);
 
             for (auto& s : samplers)
-                ApplySamplerOverrides(s);
+                ApplySamplerOverrides(s, policy);
 
             descCopy.Desc_1_1.pStaticSamplers = samplers.data();
         }
@@ -790,7 +786,7 @@ static HRESULT hkCreateRootSignature(ID3D12Device* device, UINT nodeMask, const
                              descCopy.Desc_1_2.pStaticSamplers + descCopy.Desc_1_2.NumStaticSamplers);
 
             for (auto& s : samplers1)
-                ApplySamplerOverrides(s);
+                ApplySamplerOverrides(s, policy);
 
             descCopy.Desc_1_2.pStaticSamplers = samplers1.data();
         }
@@ -798,15 +794,14 @@ static HRESULT hkCreateRootSignature(ID3D12Device* device, UINT nodeMask, const
 
     ID3DBlob* newBlob = nullptr;
     ID3DBlob* errorBlob = nullptr;
-    result = S_OK;
 
     // Reserialize
     result = o_D3D12SerializeVersionedRootSignature(&descCopy, &newBlob, &errorBlob);
 
     if (SUCCEEDED(result))
     {
-        result = o_CreateRootSignature(device, nodeMask, newBlob->GetBufferPointer(), newBlob->GetBufferSize(), riid,
-                                       ppvRootSignature);
+        auto newData = (const uint8_t*) newBlob->GetBufferPointer();
+        output.assign(newData, newData + newBlob->GetBufferSize());
         newBlob->Release();
 
         if (errorBlob)
@@ -821,22 +816,95 @@ static HRESULT hkCreateRootSignature(ID3D12Device* device, UINT nodeMask, const
             LOG_ERROR("RootSig Serialization Failed: {}", (char*) errorBlob->GetBufferPointer());
             errorBlob->Release();
         }
-
-        // Fallback to original blob
-        result =
-            o_CreateRootSignature(device, nodeMask, pBlobWithRootSignature, blobLengthInBytes, riid, ppvRootSignature);
     }
 
     deserializer->Release();
-    return result;
+    return SUCCEEDED(result);
+}
+
+static std::shared_ptr<const RootSignatureCacheEntry> RewriteRootSignature(UINT64 key,
+                                                                           const void* pBlobWithRootSignature,
+                                                                           SIZE_T blobLengthInBytes,
+                                                                           const SamplerOverridePolicy& policy)
+{
+    RootSignatureCacheEntry entry {};
+    RootSignatureCache::SetInput(entry, pBlobWithRootSignature, blobLengthInBytes);
+
+    _collectMipBias = true;
+    _collectedHasMipBias = false;
+
+    auto patched = RootSignatureCache::PatchStaticSamplers(
+        pBlobWithRootSignature, blobLengthInBytes,
+        [&policy](D3D12_STATIC_SAMPLER_DESC& samplerDesc) { ApplySamplerOverrides(samplerDesc, policy); },
+        [&policy](D3D12_STATIC_SAMPLER_DESC1& samplerDesc) { ApplySamplerOverrides(samplerDesc, policy); }, entry.blob);
+
+    if (!patched)
+    {
+        LOG_DEBUG("Can't patch root signature in place, reserializing");
+        patched = ReserializeRootSignature(pBlobWithRootSignature, blobLengthInBytes, policy, entry.blob);
+    }
+
+    _collectMipBias = false;
+
+    // Not cached so a failing blob keeps falling back to the original one
+    if (!patched)
+        return nullptr;
+
+    entry.hasMipBias = _collectedHasMipBias;
+    entry.minMipBias = _collectedMinMipBias;
+    entry.maxMipBias = _collectedMaxMipBias;
+
+    return RootSignatureCache::Put(key, std::move(entry));
+}
+
+static HRESULT hkCreateRootSignature(ID3D12Device* device, UINT nodeMask, const void* pBlobWithRootSignature,
+                                     SIZE_T blobLengthInBytes, REFIID riid, void** ppvRootSignature)
+{
+    HookProfiler::Scope profile(ProfiledHook::D3D12_CreateRootSignature);
+
+    auto& policy = SamplerOverrides::Policy();
+
+    if (!policy.IsActive())
+    {
+        return profile.Call(o_CreateRootSignature, device, nodeMask, pBlobWithRootSignature, blobLengthInBytes, riid,
+                            ppvRootSignature);
+    }
+
+    auto key = RootSignatureCache::GetKey(pBlobWithRootSignature, blobLengthInBytes, policy.settingsHash);
+    auto cached = RootSignatureCache::Get(key, pBlobWithRootSignature, blobLengthInBytes);
+
+    if (cached != nullptr)
+    {
+        if (cached->hasMipBias)
+        {
+            UpdateMipBiasStats(cached->minMipBias);
+            UpdateMipBiasStats(cached->maxMipBias);
+        }
+    }
+    else
+    {
+        cached = RewriteRootSignature(key, pBlobWithRootSignature, blobLengthInBytes, policy);
+    }
+
+    // Fallback to original blob
+    if (cached == nullptr || cached->blob.empty())
+    {
+        return profile.Call(o_CreateRootSignature, device, nodeMask, pBlobWithRootSignature, blobLengthInBytes, riid,
+                            ppvRootSignature);
+    }
+
+    return profile.Call(o_CreateRootSignature, device, nodeMask, cached->blob.data(), cached->blob.size(), riid,
+                        ppvRootSignature);
 }
 
 static HRESULT hkD3D12GetInterface(REFCLSID rclsid, REFIID riid, void** ppvDebug)
 {
+    HookProfiler::Scope profile(ProfiledHook::D3D12_GetInterface);
+
     LOG_DEBUG("D3D12GetInterface called: {:X}, {:X}, Caller: {}", (size_t) &rclsid, (size_t) &riid,
               Util::WhoIsTheCaller(_ReturnAddress()));
 
-    auto result = o_D3D12GetInterface(rclsid, riid, ppvDebug);
+    auto result = profile.Call(o_D3D12GetInterface, rclsid, riid, ppvDebug);
 
     if (rclsid == CLSID_D3D12DeviceFactory && o_CreateDevice == nullptr)
     {
@@ -914,6 +982,8 @@ static void HookToDevice(ID3D12Device* InDevice)
         }
 
         DetourTransactionCommit();
+
+        SamplerOverrides::Refresh();
     }
 
     if (State::Instance().activeFgInput == FGInput::Upscaler)
@@ -971,6 +1041,8 @@ void D3D12Hooks::Hook()
     o_D3D12SerializeRootSignature = D3d12Proxy::Hook_D3D12SerializeRootSignature(hkD3D12SerializeRootSignature);
     o_D3D12SerializeVersionedRootSignature =
         D3d12Proxy::Hook_D3D12SerializeVersionedRootSignature(hkD3D12SerializeVersionedRootSignature);
+
+    SamplerOverrides::Refresh();
 }
 
 void D3D12Hooks::HookAgility(HMODULE module)
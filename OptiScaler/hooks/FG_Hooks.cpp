@@ -12,6 +12,7 @@
 #include <resource_tracking/ResTrack_Dx12.h>
 
 #include <misc/FrameLimit.h>
+#include <misc/HookProfiler.h>
 #include <upscaler_time/UpscalerTime_Dx12.h>
 
 #include <detours/detours.h>
@@ -386,6 +387,8 @@ HRESULT FGHooks::hkGetFullscreenState(IDXGISwapChain* This, BOOL* pFullscreen, I
 HRESULT FGHooks::hkResizeBuffers(IDXGISwapChain* This, UINT BufferCount, UINT Width, UINT Height, DXGI_FORMAT NewFormat,
                                  UINT SwapChainFlags)
 {
+    HookProfiler::Scope profile(ProfiledHook::FG_ResizeBuffers);
+
     // Skip XeFG's internal call
     if (_skipResize)
     {
@@ -408,7 +411,7 @@ HRESULT FGHooks::hkResizeBuffers(IDXGISwapChain* This, UINT BufferCount, UINT Wi
             return result;
         }
 
-        return o_FGSCResizeBuffers(This, BufferCount, Width, Height, NewFormat, SwapChainFlags);
+        return profile.Call(o_FGSCResizeBuffers, This, BufferCount, Width, Height, NewFormat, SwapChainFlags);
     }
 
     if (State::Instance().activeFgOutput == FGOutput::XeFG)
@@ -522,7 +525,7 @@ HRESULT FGHooks::hkResizeBuffers(IDXGISwapChain* This, UINT BufferCount, UINT Wi
     HRESULT result;
     {
         ScopedSkipSpoofing skipSpoofing {};
-        result = o_FGSCResizeBuffers(This, BufferCount, Width, Height, NewFormat, SwapChainFlags);
+        result = profile.Call(o_FGSCResizeBuffers, This, BufferCount, Width, Height, NewFormat, SwapChainFlags);
     }
 
     _skipResize1 = false;
@@ -581,6 +584,8 @@ HRESULT FGHooks::hkResizeTarget(IDXGISwapChain* This, DXGI_MODE_DESC* pNewTarget
 HRESULT FGHooks::hkResizeBuffers1(IDXGISwapChain* This, UINT BufferCount, UINT Width, UINT Height, DXGI_FORMAT Format,
                                   UINT SwapChainFlags, const UINT* pCreationNodeMask, IUnknown* const* ppPresentQueue)
 {
+    HookProfiler::Scope profile(ProfiledHook::FG_ResizeBuffers);
+
     // Skip XeFG's internal call
     if (_skipResize1)
     {
@@ -605,8 +610,8 @@ HRESULT FGHooks::hkResizeBuffers1(IDXGISwapChain* This, UINT BufferCount, UINT W
             return result;
         }
 
-        return o_FGSCResizeBuffers1(This, BufferCount, Width, Height, Format, SwapChainFlags, pCreationNodeMask,
-                                    ppPresentQueue);
+        return profile.Call(o_FGSCResizeBuffers1, This, BufferCount, Width, Height, Format, SwapChainFlags,
+                            pCreationNodeMask, ppPresentQueue);
     }
 
     if (State::Instance().activeFgOutput == FGOutput::XeFG)
@@ -718,8 +723,8 @@ HRESULT FGHooks::hkResizeBuffers1(IDXGISwapChain* This, UINT BufferCount, UINT W
         ScopedSkipSpoofing skipSpoofing {};
         _skipResize = true;
 
-        result = o_FGSCResizeBuffers1(This, BufferCount, Width, Height, Format, SwapChainFlags, pCreationNodeMask,
-                                      ppPresentQueue);
+        result = profile.Call(o_FGSCResizeBuffers1, This, BufferCount, Width, Height, Format, SwapChainFlags,
+                              pCreationNodeMask, ppPresentQueue);
 
         _skipResize = false;
     }
@@ -840,14 +845,16 @@ HRESULT FGHooks::hkFGPresent1(void* This, UINT SyncInterval, UINT Flags,
 
 HRESULT FGHooks::FGPresent(void* This, UINT SyncInterval, UINT Flags, const DXGI_PRESENT_PARAMETERS* pPresentParameters)
 {
+    HookProfiler::Scope profile(ProfiledHook::FG_Present);
+
     _lastPresentFlags = Flags;
 
     if (State::Instance().isShuttingDown)
     {
         if (pPresentParameters == nullptr)
-            return o_FGSCPresent(This, SyncInterval, Flags);
+            return profile.Call(o_FGSCPresent, This, SyncInterval, Flags);
         else
-            return o_FGSCPresent1(This, SyncInterval, Flags, pPresentParameters);
+            return profile.Call(o_FGSCPresent1, This, SyncInterval, Flags, pPresentParameters);
     }
 
     auto willPresent = (Flags & DXGI_PRESENT_TEST) == 0;
@@ -952,15 +959,15 @@ HRESULT FGHooks::FGPresent(void* This, UINT SyncInterval, UINT Flags, const DXGI
 
     HRESULT result;
     if (pPresentParameters == nullptr)
-        result = o_FGSCPresent(This, SyncInterval, Flags);
+        result = profile.Call(o_FGSCPresent, This, SyncInterval, Flags);
     else
-        result = o_FGSCPresent1(This, SyncInterval, Flags, pPresentParameters);
+        result = profile.Call(o_FGSCPresent1, This, SyncInterval, Flags, pPresentParameters);
     LOG_DEBUG("Result: {:X}", result);
 
     Hudfix_Dx12::PresentEnd();
 
     if (willPresent && !State::Instance().reflexLimitsFps && State::Instance().activeFgOutput != FGOutput::NoFG)
-        FrameLimit::sleep(fg != nullptr ? fg->IsActive() : false);
+        profile.Call(FrameLimit::sleep, fg != nullptr ? fg->IsActive() : false);
 
     if (mutexUsed && fg != nullptr)
     {
@@ -11,7 +11,9 @@
 #include <State.h>
 #include <Config.h>
 
+#include <atomic>
 #include <cwctype>
+#include <string_view>
 
 #pragma intrinsic(_ReturnAddress)
 
@@ -47,6 +49,67 @@ static inline bool IsInsideWindowsDirectory(const std::string& path)
     return false;
 }
 
+enum class InterceptedProc
+{
+    None,
+    AmdExtD3DCreateInterface,
+    D3DKMTEnumAdapters2,
+};
+
+static constexpr uint64_t ProcNameHash(std::string_view name)
+{
+    uint64_t hash = 0xCBF29CE484222325ull;
+
+    for (auto c : name)
+    {
+        hash ^= (uint8_t) c;
+        hash *= 0x100000001B3ull;
+    }
+
+    return hash;
+}
+
+// Only names which pass this are compared against module handles
+static inline InterceptedProc FindInterceptedProc(LPCSTR lpProcName)
+{
+    std::string_view name(lpProcName);
+
+    switch (ProcNameHash(name))
+    {
+    case ProcNameHash("AmdExtD3DCreateInterface"):
+        if (name == "AmdExtD3DCreateInterface")
+            return InterceptedProc::AmdExtD3DCreateInterface;
+
+        break;
+
+    case ProcNameHash("D3DKMTEnumAdapters2"):
+        if (name == "D3DKMTEnumAdapters2")
+            return InterceptedProc::D3DKMTEnumAdapters2;
+
+        break;
+    }
+
+    return InterceptedProc::None;
+}
+
+// Handle is resolved again only when it doesn't match the cached one, module might be loaded after the first check
+static inline bool IsModule(std::atomic<HMODULE>& cache, HMODULE module, LPCWSTR moduleName)
+{
+    if (module == nullptr)
+        return false;
+
+    if (module == cache.load(std::memory_order_relaxed))
+        return true;
+
+    auto handle = KernelBaseProxy::GetModuleHandleW_()(moduleName);
+    cache.store(handle, std::memory_order_relaxed);
+
+    return module == handle;
+}
+
+static std::atomic<HMODULE> _gdi32Module = nullptr;
+static std::atomic<HMODULE> _amdxc64Module = nullptr;
+
 static inline HMODULE CheckLoad(const std::wstring& name)
 {
     do
@@ -99,19 +162,23 @@ FARPROC WINAPI KernelHooks::hk_K32_GetProcAddress(HMODULE hModule, LPCSTR lpProc
                   Util::WhoIsTheCaller(_ReturnAddress()));
     }
 
+    auto intercepted = lpProcName != nullptr ? FindInterceptedProc(lpProcName) : InterceptedProc::None;
+
+    if (intercepted == InterceptedProc::None)
+        return o_K32_GetProcAddress(hModule, lpProcName);
+
     // FSR 4 Init in case of missing amdxc64.dll
     // 2nd check is amdxcffx64.dll trying to queue amdxc64 but amdxc64 not being loaded.
     // Also skip the internal call of amdxc64
-    if (lpProcName != nullptr && (hModule == amdxc64Mark || hModule == nullptr) &&
-        lstrcmpA(lpProcName, "AmdExtD3DCreateInterface") == 0 && Config::Instance()->Fsr4Update.value_or_default() &&
-        Util::GetCallerModule(_ReturnAddress()) != KernelBaseProxy::GetModuleHandleW_()(L"amdxc64.dll"))
+    if (intercepted == InterceptedProc::AmdExtD3DCreateInterface &&
+        (hModule == amdxc64Mark || hModule == nullptr) && Config::Instance()->Fsr4Update.value_or_default() &&
+        !IsModule(_amdxc64Module, Util::GetCallerModule(_ReturnAddress()), L"amdxc64.dll"))
     {
         return (FARPROC) &hkAmdExtD3DCreateInterface;
     }
 
-    if (State::Instance().isRunningOnLinux && lpProcName != nullptr &&
-        hModule == KernelBaseProxy::GetModuleHandleW_()(L"gdi32.dll") &&
-        lstrcmpA(lpProcName, "D3DKMTEnumAdapters2") == 0)
+    if (intercepted == InterceptedProc::D3DKMTEnumAdapters2 && State::Instance().isRunningOnLinux &&
+        IsModule(_gdi32Module, hModule, L"gdi32.dll"))
     {
         return (FARPROC) &customD3DKMTEnumAdapters2;
     }
@@ -183,8 +250,8 @@ FARPROC WINAPI KernelHooks::hk_KB_GetProcAddress(HMODULE hModule, LPCSTR lpProcN
     }
 
     if (State::Instance().isRunningOnLinux && lpProcName != nullptr &&
-        hModule == KernelBaseProxy::GetModuleHandleW_()(L"gdi32.dll") &&
-        lstrcmpA(lpProcName, "D3DKMTEnumAdapters2") == 0)
+        FindInterceptedProc(lpProcName) == InterceptedProc::D3DKMTEnumAdapters2 &&
+        IsModule(_gdi32Module, hModule, L"gdi32.dll"))
         return (FARPROC) &customD3DKMTEnumAdapters2;
 
     return o_KB_GetProcAddress(hModule, lpProcName);
@@ -2,6 +2,9 @@
 
 #include <Config.h>
 #include <DllNames.h>
+#include <DllNameMatcher.h>
+
+#include <misc/DeferredInit.h>
 
 #include <proxies/Ntdll_Proxy.h>
 #include <proxies/Kernel32_Proxy.h>
@@ -42,6 +45,12 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
     LOG_TRACE("{}", libNameA);
 #endif
 
+    // Covers the games which load their FSR dll or graphics api after DllMain without a device hook
+    DeferredInit::Run();
+
+    // Every name list is checked in one pass
+    auto match = DllNameMatcher::Match(libName);
+
     // C:\\Path\\like\\this.dll
     auto normalizedPath = std::filesystem::path(libName).lexically_normal().wstring();
 
@@ -56,7 +65,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
 
         auto pos = libName.rfind(exePath);
 
-        if (Config::Instance()->EnableDlssInputs.value_or_default() && CheckDllNameW(&libName, &nvngxNamesW) &&
+        if (Config::Instance()->EnableDlssInputs.value_or_default() && match.Has(DllNameList::Nvngx) &&
             (!Config::Instance()->HookOriginalNvngxOnly.value_or_default() || pos == std::string::npos))
         {
             LOG_INFO("nvngx call: {0}, returning this dll!", libNameA);
@@ -69,7 +78,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
     }
 
     if (!State::Instance().isWorkingAsNvngx &&
-        (!State::Instance().isDxgiMode || !State::Instance().skipDxgiLoadChecks) && CheckDllNameW(&libName, &dllNamesW))
+        (!State::Instance().isDxgiMode || !State::Instance().skipDxgiLoadChecks) && match.Has(DllNameList::Opti))
     {
         if (!State::Instance().ServeOriginal())
         {
@@ -85,7 +94,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
 
     // nvngx_dlss
     if (Config::Instance()->DLSSEnabled.value_or_default() && Config::Instance()->NVNGX_DLSS_Library.has_value() &&
-        CheckDllNameW(&libName, &nvngxDlssNamesW))
+        match.Has(DllNameList::NvngxDlss))
     {
         auto nvngxDlss = LoadNvngxDlss(libName);
 
@@ -118,7 +127,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
     }
 
     // NvApi64.dll
-    if (CheckDllNameW(&libName, &nvapiNamesW))
+    if (match.Has(DllNameList::Nvapi))
     {
         if (Config::Instance()->OverrideNvapiDll.value_or_default())
         {
@@ -155,7 +164,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
     }
 
     // sl.interposer.dll
-    if (CheckDllNameW(&libName, &slInterposerNamesW))
+    if (match.Has(DllNameList::SlInterposer))
     {
         auto streamlineModule = NtdllProxy::LoadLibraryExW_Ldr(lpLibFullPath, NULL, 0);
 
@@ -175,7 +184,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
     // sl.dlss.dll
     // Try to catch something like this:
     // C:\ProgramData/NVIDIA/NGX/models/sl_dlss_0/versions/133120/files/190_E658703.dll
-    if (CheckDllNameW(&libName, &slDlssNamesW) ||
+    if (match.Has(DllNameList::SlDlss) ||
         (normalizedPath.contains(L"\\versions\\") && normalizedPath.contains(L"\\sl_dlss_0")))
     {
         auto dlssModule = NtdllProxy::LoadLibraryExW_Ldr(lpLibFullPath, NULL, 0);
@@ -193,7 +202,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
     }
 
     // sl.dlss_g.dll
-    if (CheckDllNameW(&libName, &slDlssgNamesW) ||
+    if (match.Has(DllNameList::SlDlssg) ||
         (normalizedPath.contains(L"\\versions\\") && normalizedPath.contains(L"\\sl_dlss_g_")))
     {
         auto dlssgModule = NtdllProxy::LoadLibraryExW_Ldr(lpLibFullPath, NULL, 0);
@@ -211,7 +220,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
     }
 
     // sl.reflex.dll
-    if (CheckDllNameW(&libName, &slReflexNamesW) ||
+    if (match.Has(DllNameList::SlReflex) ||
         (normalizedPath.contains(L"\\versions\\") && normalizedPath.contains(L"\\sl_reflex_")))
     {
         auto reflexModule = NtdllProxy::LoadLibraryExW_Ldr(lpLibFullPath, NULL, 0);
@@ -229,7 +238,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
     }
 
     // sl.pcl.dll
-    if (CheckDllNameW(&libName, &slPclNamesW) ||
+    if (match.Has(DllNameList::SlPcl) ||
         (normalizedPath.contains(L"\\versions\\") && normalizedPath.contains(L"\\sl_pcl_")))
     {
         auto pclModule = NtdllProxy::LoadLibraryExW_Ldr(lpLibFullPath, NULL, 0);
@@ -247,7 +256,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
     }
 
     // sl.common.dll
-    if (CheckDllNameW(&libName, &slCommonNamesW) ||
+    if (match.Has(DllNameList::SlCommon) ||
         (normalizedPath.contains(L"\\versions\\") && normalizedPath.contains(L"\\sl_common_")))
     {
         auto commonModule = NtdllProxy::LoadLibraryExW_Ldr(lpLibFullPath, NULL, 0);
@@ -264,12 +273,12 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
         return commonModule;
     }
 
-    if (Config::Instance()->DisableOverlays.value_or_default() && CheckDllNameW(&libName, &blockOverlayNamesW))
+    if (Config::Instance()->DisableOverlays.value_or_default() && match.Has(DllNameList::BlockOverlay))
     {
         LOG_DEBUG("Blocking overlay dll: {}", wstring_to_string(libName));
         return (HMODULE) 1337;
     }
-    else if (CheckDllNameW(&libName, &overlayNamesW))
+    else if (match.Has(DllNameList::Overlay))
     {
         LOG_DEBUG("Overlay dll: {}", wstring_to_string(libName));
 
@@ -319,7 +328,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
     }
 
     // Hooks
-    if (CheckDllNameW(&libName, &dx11NamesW))
+    if (match.Has(DllNameList::Dx11))
     {
         auto module = NtdllProxy::LoadLibraryExW_Ldr(libName.c_str(), NULL, 0);
 
@@ -329,7 +338,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
         return module;
     }
 
-    if (CheckDllNameW(&libName, &dx12NamesW))
+    if (match.Has(DllNameList::Dx12))
     {
         auto module = NtdllProxy::LoadLibraryExW_Ldr(libName.c_str(), NULL, 0);
 
@@ -342,7 +351,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
         return module;
     }
 
-    if (CheckDllNameW(&libName, &dx12agilityNamesW))
+    if (match.Has(DllNameList::Dx12Agility))
     {
         auto module = NtdllProxy::LoadLibraryExW_Ldr(libName.c_str(), NULL, 0);
 
@@ -352,7 +361,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
         return module;
     }
 
-    if (CheckDllNameW(&libName, &vkNamesW))
+    if (match.Has(DllNameList::Vulkan))
     {
         auto module = NtdllProxy::LoadLibraryExW_Ldr(libName.c_str(), NULL, 0);
 
@@ -368,7 +377,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
         return module;
     }
 
-    if (!State::Instance().skipDxgiLoadChecks && CheckDllNameW(&libName, &dxgiNamesW))
+    if (!State::Instance().skipDxgiLoadChecks && match.Has(DllNameList::Dxgi))
     {
         auto module = NtdllProxy::LoadLibraryExW_Ldr(libName.c_str(), NULL, LOAD_LIBRARY_SEARCH_SYSTEM32);
 
@@ -379,7 +388,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
         }
     }
 
-    if (CheckDllNameW(&libName, &fsr2NamesW))
+    if (match.Has(DllNameList::Fsr2))
     {
         auto module = NtdllProxy::LoadLibraryExW_Ldr(libName.c_str(), NULL, 0);
 
@@ -389,7 +398,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
         return module;
     }
 
-    if (CheckDllNameW(&libName, &fsr2BENamesW))
+    if (match.Has(DllNameList::Fsr2BE))
     {
         auto module = NtdllProxy::LoadLibraryExW_Ldr(libName.c_str(), NULL, 0);
 
@@ -399,7 +408,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
         return module;
     }
 
-    if (CheckDllNameW(&libName, &fsr3NamesW))
+    if (match.Has(DllNameList::Fsr3))
     {
         auto module = NtdllProxy::LoadLibraryExW_Ldr(libName.c_str(), NULL, 0);
 
@@ -409,7 +418,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
         return module;
     }
 
-    if (CheckDllNameW(&libName, &fsr3BENamesW))
+    if (match.Has(DllNameList::Fsr3BE))
     {
         auto module = NtdllProxy::LoadLibraryExW_Ldr(libName.c_str(), NULL, 0);
 
@@ -419,7 +428,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
         return module;
     }
 
-    if (CheckDllNameW(&libName, &xessNamesW))
+    if (match.Has(DllNameList::Xess))
     {
         auto module = LoadLibxess(libName);
 
@@ -431,7 +440,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
         return module;
     }
 
-    if (CheckDllNameW(&libName, &xessDx11NamesW))
+    if (match.Has(DllNameList::XessDx11))
     {
         auto module = LoadLibxessDx11(libName);
 
@@ -443,7 +452,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
         return module;
     }
 
-    if (CheckDllNameW(&libName, &ffxDx12NamesW))
+    if (match.Has(DllNameList::FfxDx12))
     {
         auto module = LoadFfxapiDx12(libName);
 
@@ -453,7 +462,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
         return module;
     }
 
-    if (CheckDllNameW(&libName, &ffxDx12UpscalerNamesW))
+    if (match.Has(DllNameList::FfxDx12Upscaler))
     {
         auto module = NtdllProxy::LoadLibraryExW_Ldr(libName.c_str(), NULL, 0);
 
@@ -465,7 +474,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
         return module;
     }
 
-    if (CheckDllNameW(&libName, &ffxDx12FGNamesW))
+    if (match.Has(DllNameList::FfxDx12FG))
     {
         auto module = NtdllProxy::LoadLibraryExW_Ldr(libName.c_str(), NULL, 0);
 
@@ -475,7 +484,7 @@ HMODULE LibraryLoadHooks::LoadLibraryCheckW(std::wstring libName, LPCWSTR lpLibF
         return module;
     }
 
-    if (CheckDllNameW(&libName, &ffxVkNamesW))
+    if (match.Has(DllNameList::FfxVk))
     {
         auto module = LoadFfxapiVk(libName);
 
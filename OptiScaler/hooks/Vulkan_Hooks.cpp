@@ -7,7 +7,9 @@
 #include <proxies/KernelBase_Proxy.h>
 #include <upscaler_time/UpscalerTime_Vk.h>
 
+#include <misc/DeferredInit.h>
 #include <misc/FrameLimit.h>
+#include <misc/HookProfiler.h>
 #include "Reflex_Hooks.h"
 
 #include <vulkan/vulkan.hpp>
@@ -178,6 +180,9 @@ static VkResult hkvkCreateDevice(VkPhysicalDevice physicalDevice, const VkDevice
 {
     LOG_FUNC();
 
+    // Exe input hooks must be in place before the game can create its FSR contexts
+    DeferredInit::Run();
+
     auto result = o_vkCreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice);
 
     if (o_vkCmdPipelineBarrier == nullptr)
@@ -226,8 +231,12 @@ static VkResult hkvkQueuePresentKHR(VkQueue queue, VkPresentInfoKHR* pPresentInf
     // get upscaler time
     UpscalerTimeVk::ReadUpscalingTime(_device);
 
+    // DXVK presents are counted by the DXGI swapchain wrapper
     if (!State::Instance().isRunningOnDXVK)
+    {
         State::Instance().swapchainApi = Vulkan;
+        HookProfiler::EndFrame();
+    }
 
     // Tick feature to let it know if it's frozen
     if (auto currentFeature = State::Instance().currentFeature; currentFeature != nullptr)
@@ -5,6 +5,7 @@
 #include <Config.h>
 
 #include <framegen/IFGFeature_Dx12.h>
+#include <resource_tracking/ResTrack_Filter.h>
 
 bool Hudfix_Dx12::CreateObjects()
 {
@@ -414,7 +415,12 @@ void Hudfix_Dx12::UpscaleStart()
     if (State::Instance().ClearCapturedHudlesses)
     {
         State::Instance().ClearCapturedHudlesses = false;
+
+        for (const auto& [resource, info] : State::Instance().CapturedHudlesses)
+            TrackedResourceFilter::Remove(resource);
+
         State::Instance().CapturedHudlesses.clear();
+        ResetSampling();
     }
 }
 
@@ -432,6 +438,8 @@ void Hudfix_Dx12::UpscaleEnd(UINT64 frameId, double lastFGFrameTime)
 
 void Hudfix_Dx12::PresentStart()
 {
+    UpdateSampling();
+
     _fgCounter = _upscaleCounter;
     return;
 }
@@ -493,6 +501,69 @@ bool Hudfix_Dx12::IsResourceCheckActive()
 
 bool Hudfix_Dx12::SkipHudlessChecks() { return _skipHudlessChecks; }
 
+void Hudfix_Dx12::UpdateSampling()
+{
+    auto config = Config::Instance();
+    auto& s = State::Instance();
+
+    // Hudless limit and resource list features need to see every candidate
+    if (!config->FGHudfixSampling.value_or_default() || config->FGHUDLimit.value_or_default() > 1 ||
+        s.FGcaptureResources || s.FGonlyUseCapturedResources)
+    {
+        if (_stableHudless != nullptr || _sampledResource.load(std::memory_order_relaxed) != nullptr)
+            ResetSampling();
+
+        return;
+    }
+
+    // Only once per upscaled frame
+    if (_samplingCheckedFrame == _upscaleCounter || _upscaleCounter <= _fgCounter)
+        return;
+
+    _samplingCheckedFrame = _upscaleCounter;
+
+    auto hudless = _frameHudless.exchange(nullptr, std::memory_order_relaxed);
+
+    if (hudless == nullptr || hudless != _stableHudless)
+    {
+        if (_sampledResource.load(std::memory_order_relaxed) != nullptr)
+        {
+            LOG_DEBUG("Sampled hudless {:X} lost, new hudless: {:X}, back to full tracking", (size_t) _stableHudless,
+                      (size_t) hudless);
+        }
+
+        _stableHudless = hudless;
+        _stableFrames = hudless != nullptr ? 1 : 0;
+        _sampledResource.store(nullptr, std::memory_order_relaxed);
+        return;
+    }
+
+    _stableFrames++;
+
+    auto stableLimit = (UINT64) config->FGHudfixSamplingStableFrames.value_or_default();
+
+    if (_stableFrames < stableLimit)
+        return;
+
+    if (_stableFrames == stableLimit)
+        LOG_DEBUG("Hudless {:X} stable for {} frames, sampling its binds", (size_t) hudless, _stableFrames);
+
+    // Periodic full scan to catch game switching to another hudless
+    auto fullScanInterval = (UINT64) config->FGHudfixSamplingFullScanInterval.value_or_default();
+    auto fullScan = fullScanInterval > 0 && ((_stableFrames - stableLimit + 1) % fullScanInterval) == 0;
+
+    _sampledResource.store(fullScan ? nullptr : hudless, std::memory_order_relaxed);
+}
+
+void Hudfix_Dx12::ResetSampling()
+{
+    _sampledResource.store(nullptr, std::memory_order_relaxed);
+    _frameHudless.store(nullptr, std::memory_order_relaxed);
+    _stableHudless = nullptr;
+    _stableFrames = 0;
+    _samplingCheckedFrame = 0;
+}
+
 bool Hudfix_Dx12::CheckForHudless(ID3D12GraphicsCommandList* cmdList, ResourceInfo* resource,
                                   D3D12_RESOURCE_STATES state, bool ignoreBlocked)
 {
@@ -509,7 +580,12 @@ bool Hudfix_Dx12::CheckForHudless(ID3D12GraphicsCommandList* cmdList, ResourceIn
         if (!CheckResource(resource))
             break;
 
-        CapturedHudlessInfo* capturedHudlessInfo = &s.CapturedHudlesses[resource->buffer];
+        // Entries must be visible to resource tracker's Release filter so they are erased on release
+        auto [hudlessIt, hudlessInserted] = s.CapturedHudlesses.try_emplace(resource->buffer);
+        if (hudlessInserted)
+            TrackedResourceFilter::Add(resource->buffer);
+
+        CapturedHudlessInfo* capturedHudlessInfo = &hudlessIt->second;
         if (capturedHudlessInfo != nullptr && !capturedHudlessInfo->enabled)
         {
             LOG_DEBUG("Skipping {:X}, disabled from captured hudless list!", (size_t) resource->buffer);
@@ -841,6 +917,7 @@ bool Hudfix_Dx12::CheckForHudless(ID3D12GraphicsCommandList* cmdList, ResourceIn
         }
 
         capturedHudlessInfo->captureInfo = resource->captureInfo;
+        _frameHudless.store(resource->buffer, std::memory_order_relaxed);
 
         return true;
 
@@ -860,6 +937,7 @@ void Hudfix_Dx12::ResetCounters()
     _frameTime = 0.0;
 
     _hudlessList.clear();
+    ResetSampling();
 
     _captureCounter[0] = 0;
     _captureCounter[1] = 0;
@@ -6,6 +6,7 @@
 #include <ankerl/unordered_dense.h>
 
 #include <set>
+#include <atomic>
 #include <dxgi.h>
 #include <d3d12.h>
 #include <shared_mutex>
@@ -97,6 +98,14 @@ class Hudfix_Dx12
 
     inline static bool _skipHudlessChecks = false;
 
+    // Adaptive sampling, once same hudless is captured for enough frames only its binds are checked
+    inline static std::atomic<ID3D12Resource*> _sampledResource { nullptr };
+    // Written on the render thread, read on the present thread
+    inline static std::atomic<ID3D12Resource*> _frameHudless { nullptr };
+    inline static ID3D12Resource* _stableHudless = nullptr;
+    inline static UINT64 _stableFrames = 0;
+    inline static UINT64 _samplingCheckedFrame = 0;
+
     static bool CreateObjects();
     static bool CreateBufferResource(ID3D12Device* InDevice, ResourceInfo* InSource, D3D12_RESOURCE_STATES InState,
                                      ID3D12Resource** OutResource);
@@ -113,6 +122,10 @@ class Hudfix_Dx12
 
     static int GetIndex();
 
+    // Decides tracking mode of next frame from the hudless captured in the ending frame
+    static void UpdateSampling();
+    static void ResetSampling();
+
     inline static IID streamlineRiid {};
     static bool CheckForRealObject(std::string functionName, IUnknown* pObject, IUnknown** ppRealObject);
 
@@ -138,6 +151,9 @@ class Hudfix_Dx12
     // For resource tracking in hooks
     static bool SkipHudlessChecks();
 
+    // Only resource to check in a sampled frame, nullptr when every bind needs to be tracked
+    static ID3D12Resource* SampledResource() { return _sampledResource.load(std::memory_order_relaxed); }
+
     // Check resource for hudless
     static bool CheckForHudless(ID3D12GraphicsCommandList* cmdList, ResourceInfo* resource, D3D12_RESOURCE_STATES state,
                                 bool ignoreBlocked = false);
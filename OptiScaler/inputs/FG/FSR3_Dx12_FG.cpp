@@ -9,8 +9,6 @@
 #include <framegen/ffx/FSRFG_Dx12.h>
 #include <framegen/xefg/XeFG_Dx12.h>
 
-#include "shaders/depth_scale/DS_Dx12.h"
-
 #include <proxies/Ntdll_Proxy.h>
 #include <proxies/KernelBase_Proxy.h>
 
@@ -94,8 +92,6 @@ static ID3D12Resource* _interpolation[BUFFER_COUNT] = {};
 static Dx12Resource _uiRes[BUFFER_COUNT] = {};
 static bool _uiIndex[BUFFER_COUNT] = {};
 
-static DS_Dx12* DepthScale = nullptr;
-
 static Fsr3::FfxResourceStates GetFfxApiState(D3D12_RESOURCE_STATES state)
 {
     switch (state)
@@ -1363,51 +1359,18 @@ void FSR3FG::SetUpscalerInputs(ID3D12GraphicsCommandList* InCmdList, NVSDK_NGX_P
 
         if (paramDepth != nullptr)
         {
-            auto done = false;
-
-            if (Config::Instance()->FGEnableDepthScale.value_or_default())
-            {
-                if (DepthScale == nullptr)
-                    DepthScale = new DS_Dx12("Depth Scale", _device);
-
-                if (DepthScale->CreateBufferResource(_device, paramDepth, feature->DisplayWidth(),
-                                                     feature->DisplayHeight(), D3D12_RESOURCE_STATE_UNORDERED_ACCESS) &&
-                    DepthScale->Buffer() != nullptr)
-                {
-                    DepthScale->SetBufferState(InCmdList, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
-
-                    if (DepthScale->Dispatch(_device, InCmdList, paramDepth, DepthScale->Buffer()))
-                    {
-                        Dx12Resource setResource {};
-                        setResource.type = FG_ResourceType::Depth;
-                        setResource.cmdList = commandList;
-                        setResource.resource = DepthScale->Buffer();
-                        setResource.width = feature->RenderWidth();
-                        setResource.height = feature->RenderHeight();
-                        setResource.state = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
-                        setResource.validity = FG_ResourceValidity::JustTrackCmdlist;
-
-                        fg->SetResource(&setResource);
-
-                        done = true;
-                    }
-                }
-            }
-
-            if (!done)
-            {
-                Dx12Resource setResource {};
-                setResource.type = FG_ResourceType::Depth;
-                setResource.cmdList = commandList;
-                setResource.resource = paramDepth;
-                setResource.width = feature->RenderWidth();
-                setResource.height = feature->RenderHeight();
-                setResource.state = (D3D12_RESOURCE_STATES) Config::Instance()->DepthResourceBarrier.value_or(
-                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
-                setResource.validity = FG_ResourceValidity::ValidNow;
+            // Depth scale is done by the FG prep pass
+            Dx12Resource setResource {};
+            setResource.type = FG_ResourceType::Depth;
+            setResource.cmdList = commandList;
+            setResource.resource = paramDepth;
+            setResource.width = feature->RenderWidth();
+            setResource.height = feature->RenderHeight();
+            setResource.state = (D3D12_RESOURCE_STATES) Config::Instance()->DepthResourceBarrier.value_or(
+                D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
+            setResource.validity = FG_ResourceValidity::ValidNow;
 
-                fg->SetResource(&setResource);
-            }
+            fg->SetResource(&setResource);
         }
 
         LOG_DEBUG("(FG) copy buffers done, frame: {0}", fg->FrameCount());
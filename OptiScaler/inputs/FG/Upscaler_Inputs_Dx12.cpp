@@ -3,10 +3,6 @@
 #include <hudfix/Hudfix_Dx12.h>
 #include <resource_tracking/ResTrack_dx12.h>
 
-#include "shaders/depth_scale/DS_Dx12.h"
-
-static DS_Dx12* DepthScale = nullptr;
-
 void UpscalerInputsDx12::Init(ID3D12Device* device)
 {
     if (State::Instance().activeFgInput != FGInput::Upscaler)
@@ -182,53 +178,20 @@ void UpscalerInputsDx12::UpscaleStart(ID3D12GraphicsCommandList* InCmdList, NVSD
         if (InParameters->Get(NVSDK_NGX_Parameter_Depth, &paramDepth) != NVSDK_NGX_Result_Success)
             InParameters->Get(NVSDK_NGX_Parameter_Depth, (void**) &paramDepth);
 
+        // Depth scale is done by FG together with flip
         if (paramDepth != nullptr)
         {
-            auto done = false;
-
-            if (Config::Instance()->FGEnableDepthScale.value_or_default())
-            {
-                if (DepthScale == nullptr)
-                    DepthScale = new DS_Dx12("Depth Scale", _device);
-
-                if (DepthScale->CreateBufferResource(_device, paramDepth, feature->DisplayWidth(),
-                                                     feature->DisplayHeight(), D3D12_RESOURCE_STATE_UNORDERED_ACCESS) &&
-                    DepthScale->Buffer() != nullptr)
-                {
-                    DepthScale->SetBufferState(InCmdList, D3D12_RESOURCE_STATE_UNORDERED_ACCESS);
-
-                    if (DepthScale->Dispatch(_device, InCmdList, paramDepth, DepthScale->Buffer()))
-                    {
-                        Dx12Resource setResource {};
-                        setResource.type = FG_ResourceType::Depth;
-                        setResource.cmdList = commandList;
-                        setResource.resource = DepthScale->Buffer();
-                        setResource.width = feature->RenderWidth();
-                        setResource.height = feature->RenderHeight();
-                        setResource.state = D3D12_RESOURCE_STATE_UNORDERED_ACCESS;
-                        setResource.validity = FG_ResourceValidity::JustTrackCmdlist;
-
-                        fg->SetResource(&setResource);
-
-                        done = true;
-                    }
-                }
-            }
-
-            if (!done)
-            {
-                Dx12Resource setResource {};
-                setResource.type = FG_ResourceType::Depth;
-                setResource.cmdList = commandList;
-                setResource.resource = paramDepth;
-                setResource.width = feature->RenderWidth();
-                setResource.height = feature->RenderHeight();
-                setResource.state = (D3D12_RESOURCE_STATES) Config::Instance()->DepthResourceBarrier.value_or(
-                    D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
-                setResource.validity = FG_ResourceValidity::ValidNow;
+            Dx12Resource setResource {};
+            setResource.type = FG_ResourceType::Depth;
+            setResource.cmdList = commandList;
+            setResource.resource = paramDepth;
+            setResource.width = feature->RenderWidth();
+            setResource.height = feature->RenderHeight();
+            setResource.state = (D3D12_RESOURCE_STATES) Config::Instance()->DepthResourceBarrier.value_or(
+                D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
+            setResource.validity = FG_ResourceValidity::ValidNow;
 
-                fg->SetResource(&setResource);
-            }
+            fg->SetResource(&setResource);
         }
 
         LOG_DEBUG("(FG) copy buffers done, frame: {0}", fg->FrameCount());
@@ -1150,14 +1150,41 @@ void HookFSR2ExeInputs()
     {
         // LOG_DEBUG("Pattern matching started");
 
+        static const scanner::Pattern createPattern(
+            "40 55 57 41 54 41 56 48 8D AC 24 ? ? ? ? 48 81 EC ? ? ? ? 48 8B 05 ? ? ? ? 48 33 C4 48 89 85 ? ? ? ? "
+            "4C 8B F2 41 B8 ? ? ? ? 33 D2 48 8B F9 E8");
+
+        static const scanner::Pattern destroyPattern(
+            "40 53 48 83 EC 20 48 8B D9 48 85 C9 75 ? B8 00 00 00 80 48 83 C4 20 5B C3");
+
+        // DRG
+        static const scanner::Pattern dispatchPattern20(
+            "40 55 56 41 57 48 8D AC 24 ? ? ? ? B8 ? ? ? ? E8 ? ? ? ? 48 2B E0 80 B9 ? ? ? ? 00 4C 8B FA 48 8B 02 "
+            "48 8B F1");
+
+        // Lies of P
+        static const scanner::Pattern dispatchPattern(
+            "40 55 53 57 48 8D AC 24 ? ? ? ? B8 ? ? ? ? E8 ? ? ? ? 48 2B E0 80 B9 ? ? ? ? 00 48 8B DA 48 8B 02 "
+            "48 8B F9");
+
+        // Alone in the Dark, Deliver Us Mars
+        static const scanner::Pattern dispatchPatternAITD(
+            "40 55 57 41 56 48 8D AC 24 ? ? ? ? B8 ? ? ? ? E8 ? ? ? ? 48 2B E0 80 B9 ? ? ? ? ? 4C 8B F2 48 8B 02 "
+            "48 8B F9");
+
+        // Banishers
+        static const scanner::Pattern dispatchPatternBanish(
+            "40 55 56 57 48 8D AC 24 ? ? ? ? B8 ? ? ? ? E8 ? ? ? ? 48 2B E0 48 8B 05 ? ? ? ? 48 33 C4 48 89 85 ? ? ? ? "
+            "F7 01 ? ? ? ? 48 8B F2 48 8B F9");
+
         do
         {
-            // Create
+            // Create, Banishers dispatch is not searched relative to create so it's checked in the same pass
             LOG_DEBUG("Checking createPattern");
-            std::string_view createPattern("40 55 57 41 54 41 56 48 8D AC 24 ? ? ? ? 48 81 EC ? ? ? ? 48 8B 05 ? ? ? ? "
-                                           "48 33 C4 48 89 85 ? ? ? ? 4C 8B F2 41 B8 ? ? ? ? 33 D2 48 8B F9 E8");
-            o_ffxFsr2ContextCreate_Pattern_Dx12 =
-                (PFN_ffxFsr2ContextCreate) scanner::GetAddress(exeModule, createPattern, 0);
+            scanner::PatternScan createScans[] = { { &createPattern }, { &dispatchPatternBanish } };
+            scanner::Scan(exeModule, createScans);
+
+            o_ffxFsr2ContextCreate_Pattern_Dx12 = (PFN_ffxFsr2ContextCreate) createScans[0].Address();
 
             // Witchfire
             // if (o_ffxFsr2ContextCreate_Pattern_Dx12 == nullptr)
@@ -1199,12 +1226,17 @@ void HookFSR2ExeInputs()
                 break;
             }
 
+            // Destroy and dispatch methods come after create
+            LOG_DEBUG("Checking destroy and dispatch patterns");
+            auto createAddress = (uintptr_t) o_ffxFsr2ContextCreate_Pattern_Dx12;
+            scanner::PatternScan scans[] = { { &destroyPattern, createAddress },
+                                             { &dispatchPattern20, createAddress },
+                                             { &dispatchPattern, createAddress },
+                                             { &dispatchPatternAITD, createAddress } };
+            scanner::Scan(exeModule, scans);
+
             // Destroy
-            LOG_DEBUG("Checking destroyPattern");
-            std::string_view destroyPattern(
-                "40 53 48 83 EC 20 48 8B D9 48 85 C9 75 ? B8 00 00 00 80 48 83 C4 20 5B C3");
-            o_ffxFsr2ContextDestroy_Pattern_Dx12 = (PFN_ffxFsr2ContextDestroy) scanner::GetAddress(
-                exeModule, destroyPattern, 0, (size_t) o_ffxFsr2ContextCreate_Pattern_Dx12);
+            o_ffxFsr2ContextDestroy_Pattern_Dx12 = (PFN_ffxFsr2ContextDestroy) scans[0].Address();
 
             if (o_ffxFsr2ContextDestroy_Pattern_Dx12 != nullptr)
                 DetourAttach(&(PVOID&) o_ffxFsr2ContextDestroy_Pattern_Dx12, ffxFsr2ContextDestroy_Pattern_Dx12);
@@ -1220,11 +1252,7 @@ void HookFSR2ExeInputs()
             // DRG
             // Not receiving calls
             // Assumed FSR2.0
-            LOG_DEBUG("Checking dispatchPattern20");
-            std::string_view dispatchPattern20("40 55 56 41 57 48 8D AC 24 ? ? ? ? B8 ? ? ? ? E8 ? ? ? ? 48 2B E0 80 "
-                                               "B9 ? ? ? ? 00 4C 8B FA 48 8B 02 48 8B F1");
-            o_ffxFsr20ContextDispatch_Pattern_Dx12 = (PFN_ffxFsr2ContextDispatch) scanner::GetAddress(
-                exeModule, dispatchPattern20, 0, (size_t) o_ffxFsr2ContextCreate_Pattern_Dx12);
+            o_ffxFsr20ContextDispatch_Pattern_Dx12 = (PFN_ffxFsr2ContextDispatch) scans[1].Address();
 
             if (o_ffxFsr20ContextDispatch_Pattern_Dx12 != nullptr)
                 DetourAttach(&(PVOID&) o_ffxFsr20ContextDispatch_Pattern_Dx12, ffxFsr20ContextDispatch_Pattern_Dx12);
@@ -1232,22 +1260,12 @@ void HookFSR2ExeInputs()
             LOG_DEBUG("ffxFsr20ContextDispatch_Pattern_Dx12: {:X}", (size_t) o_ffxFsr20ContextDispatch_Pattern_Dx12);
 
             // Lies of P
-            LOG_DEBUG("Checking dispatchPattern");
-            std::string_view dispatchPattern("40 55 53 57 48 8D AC 24 ? ? ? ? B8 ? ? ? ? E8 ? ? ? ? 48 2B E0 80 B9 ? ? "
-                                             "? ? 00 48 8B DA 48 8B 02 48 8B F9");
-            o_ffxFsr2ContextDispatch_Pattern_Dx12 = (PFN_ffxFsr2ContextDispatch) scanner::GetAddress(
-                exeModule, dispatchPattern, 0, (size_t) o_ffxFsr2ContextCreate_Pattern_Dx12);
+            o_ffxFsr2ContextDispatch_Pattern_Dx12 = (PFN_ffxFsr2ContextDispatch) scans[2].Address();
 
             // Alone in the Dark - Game is using FSR1
             // Deliver Us Mars
             if (o_ffxFsr2ContextDispatch_Pattern_Dx12 == nullptr)
-            {
-                LOG_DEBUG("Checking dispatchPatternAITD");
-                std::string_view dispatchPatternAITD("40 55 57 41 56 48 8D AC 24 ? ? ? ? B8 ? ? ? ? E8 ? ? ? ? 48 2B "
-                                                     "E0 80 B9 ? ? ? ? ? 4C 8B F2 48 8B 02 48 8B F9");
-                o_ffxFsr2ContextDispatch_Pattern_Dx12 = (PFN_ffxFsr2ContextDispatch) scanner::GetAddress(
-                    exeModule, dispatchPatternAITD, 0, (size_t) o_ffxFsr2ContextCreate_Pattern_Dx12);
-            }
+                o_ffxFsr2ContextDispatch_Pattern_Dx12 = (PFN_ffxFsr2ContextDispatch) scans[3].Address();
 
             // Witchfire
             // Game uses FSR1 as FSR2
@@ -1272,13 +1290,7 @@ void HookFSR2ExeInputs()
             // Banishers
             // RHI implementation, needs r.FidelityFX.FSR2.UseNativeDX12=1
             if (o_ffxFsr2ContextDispatch_Pattern_Dx12 == nullptr)
-            {
-                std::string_view dispatchPatternBanish(
-                    "40 55 56 57 48 8D AC 24 ? ? ? ? B8 ? ? ? ? E8 ? ? ? ? 48 2B E0 48 8B 05 ? ? ? ? 48 33 C4 48 89 85 "
-                    "? ? ? ? F7 01 ? ? ? ? 48 8B F2 48 8B F9");
-                o_ffxFsr2ContextDispatch_Pattern_Dx12 =
-                    (PFN_ffxFsr2ContextDispatch) scanner::GetAddress(exeModule, dispatchPatternBanish, 0);
-            }
+                o_ffxFsr2ContextDispatch_Pattern_Dx12 = (PFN_ffxFsr2ContextDispatch) createScans[1].Address();
 
             // AW2
             // Custom implementation
@@ -771,36 +771,48 @@ void HookFSR3ExeInputs()
 
     if (Config::Instance()->Fsr3Pattern.value_or_default())
     {
-        // Create
-        LOG_DEBUG("Checking createPattern");
-        std::string_view createPattern(
+        static const scanner::Pattern createPattern(
             "48 ? ? ? ? 57 48 83 EC 20 48 8B DA 41 B8 ? ? ? ? 33 D2 48 8B F9 E8 ? ? ? ? 48 85 FF 74 ? 48 85 DB");
-        o_ffxFsr3UpscalerContextCreate_Pattern_Dx12 =
-            (PFN_ffxFsr3UpscalerContextCreate) scanner::GetAddress(exeModule, createPattern, 0);
+
+        static const scanner::Pattern destroyPattern(
+            "40 ? ? ? ? 20 48 8B D9 48 85 C9 75 ? B8 ? ? ? ? 48 83 C4 20 5B C3 44 8B 81 ? ? ? ? 48 8D 91 ? ? ? ? 48 ? "
+            "? ? ? 48 83 C1 18 48 ? ? ? ? 48 ? ? ? ? E8 ? ? ? ? 44 8B 83");
+
+        static const scanner::Pattern dispatchPattern(
+            "48 85 C9 74 36 48 85 D2 74 31 8B 41 04 39 82 ? ? ? ? 77 20 8B 41 08 39 82 ? ? ? ? 77 15 48 83 B9 ? ? ? ? "
+            "? 75 06 B8 ? ? ? ? C3");
+
+        // Ratio from quality
+        static const scanner::Pattern rfqPattern(
+            "85 C9 74 3C 83 E9 01 74 2E 83 E9 01 74 20 83 E9 01 74 12 83 F9 01 74 04 0F 57 C0 C3");
 
         // RDR1 have duplicate methods and first found one is not used
-        if (o_ffxFsr3UpscalerContextCreate_Pattern_Dx12 != nullptr &&
-            State::Instance().gameQuirks & GameQuirk::SkipFsr3Method)
-            o_ffxFsr3UpscalerContextCreate_Pattern_Dx12 = (PFN_ffxFsr3UpscalerContextCreate) scanner::GetAddress(
-                exeModule, createPattern, 0, (size_t) o_ffxFsr3UpscalerContextCreate_Pattern_Dx12 + 2);
+        auto skipFirst = static_cast<bool>(State::Instance().gameQuirks & GameQuirk::SkipFsr3Method);
+
+        LOG_DEBUG("Checking create, destroy, dispatch and rfq patterns");
+        scanner::PatternScan scans[] = { { &createPattern, 0, skipFirst ? 2u : 1u },
+                                         { &destroyPattern },
+                                         { &dispatchPattern },
+                                         { &rfqPattern } };
+        scanner::Scan(exeModule, scans);
+
+        // Create
+        o_ffxFsr3UpscalerContextCreate_Pattern_Dx12 =
+            (PFN_ffxFsr3UpscalerContextCreate) scans[0].Address(0, skipFirst ? 1 : 0);
+
+        // Destroy and dispatch of the used create method come after it
+        if (skipFirst && o_ffxFsr3UpscalerContextCreate_Pattern_Dx12 != nullptr)
+        {
+            scans[1].startAddress = (uintptr_t) o_ffxFsr3UpscalerContextCreate_Pattern_Dx12;
+            scans[2].startAddress = (uintptr_t) o_ffxFsr3UpscalerContextCreate_Pattern_Dx12;
+            scanner::Scan(exeModule, std::span(scans + 1, 2));
+        }
 
         if (o_ffxFsr3UpscalerContextCreate_Pattern_Dx12 != nullptr)
             DetourAttach(&(PVOID&) o_ffxFsr3UpscalerContextCreate_Pattern_Dx12, ffxFsr3ContextCreate_Pattern_Dx12);
 
         // Destroy
-        LOG_DEBUG("Checking destroyPattern");
-        std::string_view destroyPattern(
-            "40 ? ? ? ? 20 48 8B D9 48 85 C9 75 ? B8 ? ? ? ? 48 83 C4 20 5B C3 44 8B 81 ? ? ? ? 48 8D 91 ? ? ? ? 48 ? "
-            "? ? ? 48 83 C1 18 48 ? ? ? ? 48 ? ? ? ? E8 ? ? ? ? 44 8B 83");
-
-        // RDR1 have duplicate methods and first found one is not used
-        if (State::Instance().gameQuirks & GameQuirk::SkipFsr3Method &&
-            o_ffxFsr3UpscalerContextCreate_Pattern_Dx12 != nullptr)
-            o_ffxFsr3UpscalerContextDestroy_Pattern_Dx12 = (PFN_ffxFsr3UpscalerContextDestroy) scanner::GetAddress(
-                exeModule, destroyPattern, 0, (size_t) o_ffxFsr3UpscalerContextCreate_Pattern_Dx12);
-        else
-            o_ffxFsr3UpscalerContextDestroy_Pattern_Dx12 =
-                (PFN_ffxFsr3UpscalerContextDestroy) scanner::GetAddress(exeModule, destroyPattern, 0);
+        o_ffxFsr3UpscalerContextDestroy_Pattern_Dx12 = (PFN_ffxFsr3UpscalerContextDestroy) scans[1].Address();
 
         if (o_ffxFsr3UpscalerContextDestroy_Pattern_Dx12 != nullptr)
             DetourAttach(&(PVOID&) o_ffxFsr3UpscalerContextDestroy_Pattern_Dx12, ffxFsr3ContextDestroy_Pattern_Dx12);
@@ -809,18 +821,7 @@ void HookFSR3ExeInputs()
                   (size_t) o_ffxFsr3UpscalerContextDestroy_Pattern_Dx12);
 
         // Dispatch
-        LOG_DEBUG("Checking dispatchPattern");
-        std::string_view dispatchPattern("48 85 C9 74 36 48 85 D2 74 31 8B 41 04 39 82 ? ? ? ? 77 20 8B 41 08 39 82 ? "
-                                         "? ? ? 77 15 48 83 B9 ? ? ? ? ? 75 06 B8 ? ? ? ? C3");
-
-        // RDR1 have duplicate methods and first found one is not used
-        if (State::Instance().gameQuirks & GameQuirk::SkipFsr3Method &&
-            o_ffxFsr3UpscalerContextCreate_Pattern_Dx12 != nullptr)
-            o_ffxFsr3UpscalerContextDispatch_Pattern_Dx12 = (PFN_ffxFsr3UpscalerContextDispatch) scanner::GetAddress(
-                exeModule, dispatchPattern, 0, (size_t) o_ffxFsr3UpscalerContextCreate_Pattern_Dx12);
-        else
-            o_ffxFsr3UpscalerContextDispatch_Pattern_Dx12 =
-                (PFN_ffxFsr3UpscalerContextDispatch) scanner::GetAddress(exeModule, dispatchPattern, 0);
+        o_ffxFsr3UpscalerContextDispatch_Pattern_Dx12 = (PFN_ffxFsr3UpscalerContextDispatch) scans[2].Address();
 
         if (o_ffxFsr3UpscalerContextDispatch_Pattern_Dx12 != nullptr)
             DetourAttach(&(PVOID&) o_ffxFsr3UpscalerContextDispatch_Pattern_Dx12, ffxFsr3ContextDispatch_Pattern_Dx12);
@@ -829,13 +830,8 @@ void HookFSR3ExeInputs()
                   (size_t) o_ffxFsr3UpscalerContextDispatch_Pattern_Dx12);
 
         // Ratio from quality
-        LOG_DEBUG("Checking dispatchPattern");
-        std::string_view rfqPattern(
-            "85 C9 74 3C 83 E9 01 74 2E 83 E9 01 74 20 83 E9 01 74 12 83 F9 01 74 04 0F 57 C0 C3");
-
-        // RDR1 have duplicate methods and first found one is not used
         o_ffxFsr3UpscalerGetUpscaleRatioFromQualityMode_Pattern_Dx12 =
-            (PFN_ffxFsr3UpscalerGetUpscaleRatioFromQualityMode) scanner::GetAddress(exeModule, rfqPattern, 0);
+            (PFN_ffxFsr3UpscalerGetUpscaleRatioFromQualityMode) scans[3].Address();
 
         if (o_ffxFsr3UpscalerGetUpscaleRatioFromQualityMode_Pattern_Dx12 != nullptr)
             DetourAttach(&(PVOID&) o_ffxFsr3UpscalerGetUpscaleRatioFromQualityMode_Pattern_Dx12,
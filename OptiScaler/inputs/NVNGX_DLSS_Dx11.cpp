@@ -11,6 +11,7 @@
 #include "proxies/NVNGX_Proxy.h"
 
 #include <upscaler_time/UpscalerTime_Dx11.h>
+#include <misc/HookProfiler.h>
 
 #include <ankerl/unordered_dense.h>
 
@@ -97,6 +98,9 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D11_Init_Ext(unsigned long long InApp
     State::Instance().currentD3D11Device = InDevice;
     State::Instance().NvngxDx11Inited = true;
 
+    if (Config::Instance()->NGXParameterCapture.value_or_default())
+        NGXParameterCapture::Start(Util::DllPath().parent_path() / L"OptiScaler_NGX.capture");
+
     UpscalerTimeDx11::Init(InDevice);
 
     return NVSDK_NGX_Result_Success;
@@ -229,6 +233,8 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D11_Shutdown()
     // Disabled for now to check if it cause any issues
     // HooksDx::UnHook();
 
+    NGXParameterCapture::Stop();
+
     shutdown = false;
     State::Instance().NvngxDx11Inited = false;
 
@@ -405,6 +411,9 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D11_CreateFeature(ID3D11DeviceContext
     auto handleId = IFeature::GetNextHandleId();
     LOG_INFO("HandleId: {0}", handleId);
 
+    NGXParameterCapture::RecordFeature(NGXCaptureOp::CreateFeature, NGXCaptureApi::Dx11, InParameters, handleId,
+                                       InFeatureID);
+
     if (InFeatureID == NVSDK_NGX_Feature_SuperSampling)
     {
         std::string upscalerChoice = "fsr22"; // Default FSR 2.2.1
@@ -478,6 +487,7 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D11_ReleaseFeature(NVSDK_NGX_Handle*
         return NVSDK_NGX_Result_Success;
 
     auto handleId = InHandle->Id;
+    NGXParameterCapture::RecordFeature(NGXCaptureOp::ReleaseFeature, NGXCaptureApi::Dx11, nullptr, handleId);
     if (handleId < DLSS_MOD_ID_OFFSET)
     {
         if (Config::Instance()->DLSSEnabled.value_or_default() && NVNGXProxy::D3D11_ReleaseFeature() != nullptr)
@@ -564,6 +574,8 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D11_EvaluateFeature(ID3D11DeviceConte
                                                                NVSDK_NGX_Parameter* InParameters,
                                                                PFN_NVSDK_NGX_ProgressCallback InCallback)
 {
+    HookProfiler::Scope profile(ProfiledHook::NGX_D3D11_EvaluateFeature);
+
     if (InFeatureHandle == nullptr)
     {
         LOG_DEBUG("InFeatureHandle is null");
@@ -581,12 +593,14 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D11_EvaluateFeature(ID3D11DeviceConte
     }
 
     auto handleId = InFeatureHandle->Id;
+    NGXParameterCapture::RecordFeature(NGXCaptureOp::EvaluateFeature, NGXCaptureApi::Dx11, InParameters, handleId);
     if (handleId < DLSS_MOD_ID_OFFSET)
     {
         if (Config::Instance()->DLSSEnabled.value_or_default() && NVNGXProxy::D3D11_EvaluateFeature() != nullptr)
         {
             LOG_DEBUG("D3D11_EvaluateFeature for ({0})", handleId);
-            auto result = NVNGXProxy::D3D11_EvaluateFeature()(InDevCtx, InFeatureHandle, InParameters, InCallback);
+            auto result = profile.Call(NVNGXProxy::D3D11_EvaluateFeature(), InDevCtx, InFeatureHandle, InParameters,
+                                       InCallback);
             LOG_INFO("D3D11_EvaluateFeature result for ({0}): {1:X}", handleId, (UINT) result);
             return result;
         }
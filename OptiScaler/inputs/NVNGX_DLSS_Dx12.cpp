@@ -13,6 +13,7 @@
 #include "FG/Upscaler_Inputs_Dx12.h"
 
 #include <upscaler_time/UpscalerTime_Dx12.h>
+#include <misc/HookProfiler.h>
 
 #include <hooks/D3D12_Hooks.h>
 
@@ -59,26 +60,30 @@ static std::shared_mutex graphSigatureMutex;
 
 static void hkSetComputeRootSignature(ID3D12GraphicsCommandList* commandList, ID3D12RootSignature* pRootSignature)
 {
+    HookProfiler::Scope profile(ProfiledHook::NGX_D3D12_SetComputeRootSignature);
+
     if (Config::Instance()->RestoreComputeSignature.value_or_default() && !contextRendering && commandList != nullptr &&
         pRootSignature != nullptr)
     {
-        std::unique_lock<std::shared_mutex> lock(computeSigatureMutex);
+        auto lock = HookProfiler::TimedLock(computeSigatureMutex);
         computeSignatures.insert_or_assign(commandList, pRootSignature);
     }
 
-    orgSetComputeRootSignature(commandList, pRootSignature);
+    profile.Call(orgSetComputeRootSignature, commandList, pRootSignature);
 }
 
 static void hkSetGraphicRootSignature(ID3D12GraphicsCommandList* commandList, ID3D12RootSignature* pRootSignature)
 {
+    HookProfiler::Scope profile(ProfiledHook::NGX_D3D12_SetGraphicsRootSignature);
+
     if (Config::Instance()->RestoreGraphicSignature.value_or_default() && !contextRendering && commandList != nullptr &&
         pRootSignature != nullptr)
     {
-        std::unique_lock<std::shared_mutex> lock(graphSigatureMutex);
+        auto lock = HookProfiler::TimedLock(graphSigatureMutex);
         graphicSignatures.insert_or_assign(commandList, pRootSignature);
     }
 
-    orgSetGraphicRootSignature(commandList, pRootSignature);
+    profile.Call(orgSetGraphicRootSignature, commandList, pRootSignature);
 }
 
 static void HookToCommandList(ID3D12GraphicsCommandList* InCmdList)
@@ -211,6 +216,9 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_Init_Ext(unsigned long long InApp
 
     State::Instance().NvngxDx12Inited = true;
 
+    if (Config::Instance()->NGXParameterCapture.value_or_default())
+        NGXParameterCapture::Start(Util::DllPath().parent_path() / L"OptiScaler_NGX.capture");
+
     UpscalerInputsDx12::Init(InDevice);
 
     return NVSDK_NGX_Result_Success;
@@ -388,6 +396,8 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_Shutdown(void)
     if (State::Instance().activeFgInput == FGInput::Nukems)
         DLSSGMod::D3D12_Shutdown();
 
+    NGXParameterCapture::Stop();
+
     State::Instance().NvngxDx12Inited = false;
 
     return NVSDK_NGX_Result_Success;
@@ -582,6 +592,9 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_CreateFeature(ID3D12GraphicsComma
     auto handleId = IFeature::GetNextHandleId();
     LOG_INFO("HandleId: {0}", handleId);
 
+    NGXParameterCapture::RecordFeature(NGXCaptureOp::CreateFeature, NGXCaptureApi::Dx12, InParameters, handleId,
+                                       InFeatureID);
+
     // Root signature restore
     if (Config::Instance()->RestoreComputeSignature.value_or_default() ||
         Config::Instance()->RestoreGraphicSignature.value_or_default())
@@ -701,6 +714,7 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_ReleaseFeature(NVSDK_NGX_Handle*
         return NVSDK_NGX_Result_Success;
 
     auto handleId = InHandle->Id;
+    NGXParameterCapture::RecordFeature(NGXCaptureOp::ReleaseFeature, NGXCaptureApi::Dx12, nullptr, handleId);
 
     State::Instance().FGchanged = true;
     if (State::Instance().currentFG != nullptr && State::Instance().activeFgInput == FGInput::Upscaler)
@@ -809,6 +823,8 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_EvaluateFeature(ID3D12GraphicsCom
                                                                NVSDK_NGX_Parameter* InParameters,
                                                                PFN_NVSDK_NGX_ProgressCallback InCallback)
 {
+    HookProfiler::Scope profile(ProfiledHook::NGX_D3D12_EvaluateFeature);
+
     if (InFeatureHandle == nullptr)
     {
         LOG_DEBUG("InFeatureHandle is null");
@@ -823,13 +839,15 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_EvaluateFeature(ID3D12GraphicsCom
 
     LOG_DEBUG("Handle: {}, CmdList: {:X}", InFeatureHandle->Id, (size_t) InCmdList);
     auto handleId = InFeatureHandle->Id;
+    NGXParameterCapture::RecordFeature(NGXCaptureOp::EvaluateFeature, NGXCaptureApi::Dx12, InParameters, handleId);
 
     if (handleId < DLSS_MOD_ID_OFFSET)
     {
         if (Config::Instance()->DLSSEnabled.value_or_default() && NVNGXProxy::D3D12_EvaluateFeature() != nullptr)
         {
             LOG_DEBUG("D3D12_EvaluateFeature for ({0})", handleId);
-            auto result = NVNGXProxy::D3D12_EvaluateFeature()(InCmdList, InFeatureHandle, InParameters, InCallback);
+            auto result = profile.Call(NVNGXProxy::D3D12_EvaluateFeature(), InCmdList, InFeatureHandle, InParameters,
+                                       InCallback);
             LOG_DEBUG("D3D12_EvaluateFeature result for ({0}): {1:X}", handleId, (UINT) result);
             return result;
         }
@@ -841,7 +859,7 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_EvaluateFeature(ID3D12GraphicsCom
     }
     else if (State::Instance().activeFgInput == FGInput::Nukems && handleId >= DLSSG_MOD_ID_OFFSET)
     {
-        return DLSSGMod::D3D12_EvaluateFeature(InCmdList, InFeatureHandle, InParameters, InCallback);
+        return profile.Call(DLSSGMod::D3D12_EvaluateFeature, InCmdList, InFeatureHandle, InParameters, InCallback);
     }
 
     if (!Dx12Contexts.contains(handleId))
@@ -876,6 +894,9 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_D3D12_EvaluateFeature(ID3D12GraphicsCom
     {
         auto* feature = deviceContext->feature.get();
 
+        // Parameters are read once here, backends use the snapshot during Evaluate
+        feature->UpdateEvaluateParams(InParameters);
+
         // FSR 3.1 supports upscaleSize that doesn't need reinit to change output resolution
         if (!(feature->Name().starts_with("FSR") && feature->Version() >= feature_version { 3, 1, 0 }) &&
             feature->UpdateOutputResolution(InParameters))
@@ -11,6 +11,7 @@
 #include "upscalers/FeatureProvider_Vk.h"
 
 #include <upscaler_time/UpscalerTime_Vk.h>
+#include <misc/HookProfiler.h>
 
 #include <vulkan/vulkan.hpp>
 #include <ankerl/unordered_dense.h>
@@ -155,6 +156,9 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_VULKAN_Init_Ext2(
 
     State::Instance().NvngxVkInited = true;
 
+    if (Config::Instance()->NGXParameterCapture.value_or_default())
+        NGXParameterCapture::Start(Util::DllPath().parent_path() / L"OptiScaler_NGX.capture");
+
     return NVSDK_NGX_Result_Success;
 }
 
@@ -690,6 +694,9 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_VULKAN_CreateFeature1(VkDevice InDevice
     auto handleId = IFeature::GetNextHandleId();
     LOG_INFO("HandleId: {0}", handleId);
 
+    NGXParameterCapture::RecordFeature(NGXCaptureOp::CreateFeature, NGXCaptureApi::Vulkan, InParameters, handleId,
+                                       InFeatureID);
+
     if (InFeatureID == NVSDK_NGX_Feature_SuperSampling)
     {
         std::string upscalerChoice = "fsr22"; // Default XeSS
@@ -780,6 +787,7 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_VULKAN_ReleaseFeature(NVSDK_NGX_Handle*
         return NVSDK_NGX_Result_Success;
 
     auto handleId = InHandle->Id;
+    NGXParameterCapture::RecordFeature(NGXCaptureOp::ReleaseFeature, NGXCaptureApi::Vulkan, nullptr, handleId);
     if (handleId < DLSS_MOD_ID_OFFSET)
     {
         if (Config::Instance()->DLSSEnabled.value_or_default() && NVNGXProxy::VULKAN_ReleaseFeature() != nullptr)
@@ -829,6 +837,8 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_VULKAN_EvaluateFeature(VkCommandBuffer
                                                                 NVSDK_NGX_Parameter* InParameters,
                                                                 PFN_NVSDK_NGX_ProgressCallback InCallback)
 {
+    HookProfiler::Scope profile(ProfiledHook::NGX_Vulkan_EvaluateFeature);
+
     if (InFeatureHandle == nullptr)
     {
         LOG_DEBUG("InFeatureHandle is null");
@@ -846,6 +856,7 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_VULKAN_EvaluateFeature(VkCommandBuffer
     }
 
     auto handleId = InFeatureHandle->Id;
+    NGXParameterCapture::RecordFeature(NGXCaptureOp::EvaluateFeature, NGXCaptureApi::Vulkan, InParameters, handleId);
     if (VkContexts[handleId].feature == nullptr) // prevent source api name flicker when dlssg is active
         State::Instance().setInputApiName = State::Instance().currentInputApiName;
 
@@ -873,7 +884,8 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_VULKAN_EvaluateFeature(VkCommandBuffer
         if (Config::Instance()->DLSSEnabled.value_or_default() && NVNGXProxy::VULKAN_EvaluateFeature() != nullptr)
         {
             LOG_DEBUG("VULKAN_EvaluateFeature for ({0})", handleId);
-            auto result = NVNGXProxy::VULKAN_EvaluateFeature()(InCmdList, InFeatureHandle, InParameters, InCallback);
+            auto result = profile.Call(NVNGXProxy::VULKAN_EvaluateFeature(), InCmdList, InFeatureHandle, InParameters,
+                                       InCallback);
             LOG_INFO("VULKAN_EvaluateFeature result for ({0}): {1:X}", handleId, (UINT) result);
             return result;
         }
@@ -884,7 +896,7 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_VULKAN_EvaluateFeature(VkCommandBuffer
     }
     else if (handleId >= DLSSG_MOD_ID_OFFSET)
     {
-        return DLSSGMod::VULKAN_EvaluateFeature(InCmdList, InFeatureHandle, InParameters, InCallback);
+        return profile.Call(DLSSGMod::VULKAN_EvaluateFeature, InCmdList, InFeatureHandle, InParameters, InCallback);
     }
 
     evalCounter++;
@@ -955,6 +967,8 @@ NVSDK_NGX_API NVSDK_NGX_Result NVSDK_NGX_VULKAN_Shutdown(void)
 
     DLSSGMod::VULKAN_Shutdown();
 
+    NGXParameterCapture::Stop();
+
     shutdown = false;
     State::Instance().NvngxVkInited = false;
 
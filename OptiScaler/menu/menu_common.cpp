@@ -12,6 +12,7 @@
 
 #include <nvapi/fakenvapi.h>
 #include <hooks/Reflex_Hooks.h>
+#include <misc/HookProfiler.h>
 
 #include <version_check.h>
 
@@ -4030,6 +4031,52 @@ bool MenuCommon::RenderMenu()
                                 ShowHelpMarker("Disable tracking of Dispatch\n"
                                                "This might help filtering of wrong Hudless resources");
 
+                                ImGui::Spacing();
+
+                                auto sampling = config->FGHudfixSampling.value_or_default();
+                                if (ImGui::Checkbox("Sampled Tracking", &sampling))
+                                {
+                                    config->FGHudfixSampling = sampling;
+                                    LOG_DEBUG("Enabled set FGHudfixSampling: {}", sampling);
+                                }
+                                ShowHelpMarker("After same Hudless is captured for Stable frames\n"
+                                               "only its binds are checked, full tracking runs\n"
+                                               "every Full Scan frames or when Hudless is lost.\n"
+                                               "Not used when Limit is higher than 1");
+
+                                ImGui::BeginDisabled(!sampling);
+                                ImGui::PushItemWidth(95.0f * config->MenuScale.value_or_default());
+
+                                int stableFrames = config->FGHudfixSamplingStableFrames.value_or_default();
+                                if (ImGui::InputInt("Stable", &stableFrames))
+                                {
+                                    if (stableFrames < 1)
+                                        stableFrames = 1;
+                                    else if (stableFrames > 999)
+                                        stableFrames = 999;
+
+                                    config->FGHudfixSamplingStableFrames = stableFrames;
+                                }
+                                ShowHelpMarker("Frames with same Hudless before sampling starts");
+
+                                ImGui::SameLine(0.0f, 16.0f);
+
+                                int fullScan = config->FGHudfixSamplingFullScanInterval.value_or_default();
+                                if (ImGui::InputInt("Full Scan", &fullScan))
+                                {
+                                    if (fullScan < 0)
+                                        fullScan = 0;
+                                    else if (fullScan > 999)
+                                        fullScan = 999;
+
+                                    config->FGHudfixSamplingFullScanInterval = fullScan;
+                                }
+                                ShowHelpMarker("Full tracking interval while sampling\n"
+                                               "0 disables periodic full tracking");
+
+                                ImGui::PopItemWidth();
+                                ImGui::EndDisabled();
+
                                 ImGui::TreePop();
                             }
 
@@ -5051,6 +5098,94 @@ bool MenuCommon::RenderMenu()
                     }
                 }
 
+                // HOOK PROFILER -----------------------------
+                ImGui::Spacing();
+                if (auto ch = ScopedCollapsingHeader("Hook Profiler"); ch.IsHeaderOpen())
+                {
+                    ScopedIndent indent {};
+                    ImGui::Spacing();
+
+                    if (bool profile = HookProfiler::IsEnabled(); ImGui::Checkbox("Profile Hooks", &profile))
+                        HookProfiler::SetEnabled(profile);
+
+                    ShowHelpMarker("Measures CPU time spent inside OptiScaler hooks\n"
+                                   "Time of original calls is not included");
+
+                    if (HookProfiler::IsEnabled())
+                    {
+                        ImGui::SameLine(0.0f, 16.0f);
+
+                        if (ImGui::Button("Dump CSV"))
+                        {
+                            auto csvPath = Util::DllPath().parent_path() / L"OptiScaler_HookProfile.csv";
+                            HookProfiler::DumpCsv(csvPath.wstring());
+                        }
+
+                        std::vector<HookProfileStats> hookStats;
+                        std::vector<HookProfileThreadStats> threadStats;
+                        HookProfiler::GetFrameStats(hookStats, threadStats);
+
+                        double frameTotal = 0.0;
+                        for (const auto& thread : threadStats)
+                            frameTotal += thread.total.selfUs;
+
+                        ImGui::Text("Last frame: %.1f us", frameTotal);
+
+                        if (ImGui::BeginTable("hookProfile", 4, ImGuiTableFlags_SizingStretchProp))
+                        {
+                            ImGui::TableSetupColumn("Hook");
+                            ImGui::TableSetupColumn("Calls");
+                            ImGui::TableSetupColumn("Self us");
+                            ImGui::TableSetupColumn("Lock us");
+                            ImGui::TableHeadersRow();
+
+                            for (size_t i = 0; i < hookStats.size(); i++)
+                            {
+                                if (hookStats[i].calls == 0)
+                                    continue;
+
+                                ImGui::TableNextRow();
+                                ImGui::TableNextColumn();
+                                ImGui::Text("%s", HookProfiler::GetName((ProfiledHook) i));
+                                ImGui::TableNextColumn();
+                                ImGui::Text("%llu", hookStats[i].calls);
+                                ImGui::TableNextColumn();
+                                ImGui::Text("%.1f", hookStats[i].selfUs);
+                                ImGui::TableNextColumn();
+                                ImGui::Text("%.1f", hookStats[i].lockUs);
+                            }
+
+                            ImGui::EndTable();
+                        }
+
+                        ImGui::Spacing();
+
+                        if (ImGui::BeginTable("hookThreads", 4, ImGuiTableFlags_SizingStretchProp))
+                        {
+                            ImGui::TableSetupColumn("Thread");
+                            ImGui::TableSetupColumn("Calls");
+                            ImGui::TableSetupColumn("Self us");
+                            ImGui::TableSetupColumn("Lock us");
+                            ImGui::TableHeadersRow();
+
+                            for (const auto& thread : threadStats)
+                            {
+                                ImGui::TableNextRow();
+                                ImGui::TableNextColumn();
+                                ImGui::Text("%u", thread.threadId);
+                                ImGui::TableNextColumn();
+                                ImGui::Text("%llu", thread.total.calls);
+                                ImGui::TableNextColumn();
+                                ImGui::Text("%.1f", thread.total.selfUs);
+                                ImGui::TableNextColumn();
+                                ImGui::Text("%.1f", thread.total.lockUs);
+                            }
+
+                            ImGui::EndTable();
+                        }
+                    }
+                }
+
                 // FPS OVERLAY -----------------------------
                 ImGui::Spacing();
                 if (auto ch = ScopedCollapsingHeader("FPS Overlay"); ch.IsHeaderOpen())
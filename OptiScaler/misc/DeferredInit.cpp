@@ -0,0 +1,46 @@
+#include "DeferredInit.h"
+
+#include <atomic>
+#include <mutex>
+
+static std::mutex _mutex;
+static std::vector<std::function<void()>> _pending;
+
+// Checked before taking the mutex, false while there is queued work
+static std::atomic<bool> _done { true };
+
+// Set while the work runs, hooks it triggers on the same thread must not wait for it
+static thread_local bool _running = false;
+
+void DeferredInit::Add(std::function<void()> work)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _pending.push_back(std::move(work));
+    _done.store(false, std::memory_order_release);
+}
+
+void DeferredInit::Run()
+{
+    if (_done.load(std::memory_order_acquire) || _running)
+        return;
+
+    // Held while the work runs, so other callers return after it's done
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_pending.empty())
+        return;
+
+    LOG_DEBUG("Running {} deferred init jobs", _pending.size());
+
+    auto pending = std::move(_pending);
+    _pending.clear();
+
+    _running = true;
+
+    for (auto& work : pending)
+        work();
+
+    _running = false;
+    _done.store(true, std::memory_order_release);
+}
@@ -0,0 +1,14 @@
+#pragma once
+#include <pch.h>
+
+#include <functional>
+
+// Init work which is too slow to run while DllMain holds the loader lock, like pattern scans of the game exe.
+// Add queues the work and Run does it once on the first call, from the device creation and library load hooks.
+// Work runs on the caller's thread, so its detour transactions don't race with the ones of the game's thread.
+class DeferredInit
+{
+  public:
+    static void Add(std::function<void()> work);
+    static void Run();
+};
@@ -0,0 +1,331 @@
+#include "HookProfiler.h"
+
+#include <fstream>
+
+constexpr size_t HOOK_COUNT = (size_t) ProfiledHook::Count;
+
+static const char* _hookNames[] = {
+    "RT CreateRenderTargetView",
+    "RT CreateShaderResourceView",
+    "RT CreateUnorderedAccessView",
+    "RT CreateDescriptorHeap",
+    "RT DescriptorHeap Release",
+    "RT CopyDescriptors",
+    "RT CopyDescriptorsSimple",
+    "RT Resource Release",
+    "RT SetGraphicsRootDescriptorTable",
+    "RT SetComputeRootDescriptorTable",
+    "RT OMSetRenderTargets",
+    "RT DrawInstanced",
+    "RT DrawIndexedInstanced",
+    "RT Dispatch",
+    "RT ExecuteBundle",
+    "RT Close",
+    "RT ExecuteCommandLists",
+    "D3D12 CreateDevice",
+    "D3D12 DeviceFactory CreateDevice",
+    "D3D12 GetInterface",
+    "D3D12 Device Release",
+    "D3D12 CreateCommittedResource",
+    "D3D12 CreatePlacedResource",
+    "D3D12 CreateSampler",
+    "D3D12 CreateRootSignature",
+    "D3D12 CheckFeatureSupport",
+    "D3D12 SerializeRootSignature",
+    "D3D12 SerializeVersionedRootSignature",
+    "FG Present",
+    "FG ResizeBuffers",
+    "NGX D3D12 EvaluateFeature",
+    "NGX D3D12 SetComputeRootSignature",
+    "NGX D3D12 SetGraphicsRootSignature",
+    "NGX D3D11 EvaluateFeature",
+    "NGX Vulkan EvaluateFeature",
+};
+
+static_assert(std::size(_hookNames) == HOOK_COUNT, "Every ProfiledHook needs a name");
+
+struct ThreadHookCounters
+{
+    uint32_t threadId = 0;
+
+    // Set by owner thread on exit, counters are final after that
+    std::atomic<bool> exited { false };
+
+    // Written only by owner thread
+    std::atomic<uint64_t> calls[HOOK_COUNT] {};
+    std::atomic<uint64_t> selfTicks[HOOK_COUNT] {};
+    std::atomic<uint64_t> lockTicks[HOOK_COUNT] {};
+
+    // Read positions of EndFrame and profiling start, guarded by _profilerMutex
+    uint64_t lastCalls[HOOK_COUNT] {};
+    uint64_t lastSelfTicks[HOOK_COUNT] {};
+    uint64_t lastLockTicks[HOOK_COUNT] {};
+    uint64_t baseCalls[HOOK_COUNT] {};
+    uint64_t baseSelfTicks[HOOK_COUNT] {};
+    uint64_t baseLockTicks[HOOK_COUNT] {};
+};
+
+// Owner thread marks its counters exited on thread exit, they are folded into _exited* and freed
+struct LocalCountersHolder
+{
+    ThreadHookCounters* counters = nullptr;
+
+    ~LocalCountersHolder()
+    {
+        if (counters != nullptr)
+            counters->exited.store(true, std::memory_order_release);
+
+        counters = nullptr;
+    }
+};
+
+static std::mutex _profilerMutex;
+static std::vector<std::unique_ptr<ThreadHookCounters>> _threadCounters;
+static uint64_t _exitedCalls[HOOK_COUNT] {};
+static uint64_t _exitedSelfTicks[HOOK_COUNT] {};
+static uint64_t _exitedLockTicks[HOOK_COUNT] {};
+static std::vector<HookProfileStats> _frameHooks(HOOK_COUNT);
+static std::vector<HookProfileThreadStats> _frameThreads;
+static uint64_t _profiledFrames = 0;
+static uint64_t _startTicks = 0;
+static LARGE_INTEGER _startQpc {};
+static double _ticksPerUs = 0.0;
+
+static thread_local LocalCountersHolder _localCounters;
+static thread_local HookProfiler::Scope* _currentScope = nullptr;
+
+// Owner thread is the only writer, a plain load/store avoids locked instructions in hooks
+static inline void Bump(std::atomic<uint64_t>& counter, uint64_t value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+// Adds totals since profiling start of an exited thread to _exited*. Caller holds _profilerMutex.
+static bool FoldIfExited(const std::unique_ptr<ThreadHookCounters>& counters)
+{
+    if (!counters->exited.load(std::memory_order_acquire))
+        return false;
+
+    for (size_t i = 0; i < HOOK_COUNT; i++)
+    {
+        _exitedCalls[i] += counters->calls[i].load(std::memory_order_relaxed) - counters->baseCalls[i];
+        _exitedSelfTicks[i] += counters->selfTicks[i].load(std::memory_order_relaxed) - counters->baseSelfTicks[i];
+        _exitedLockTicks[i] += counters->lockTicks[i].load(std::memory_order_relaxed) - counters->baseLockTicks[i];
+    }
+
+    return true;
+}
+
+// Caller holds _profilerMutex
+static void ReclaimExitedCounters() { std::erase_if(_threadCounters, FoldIfExited); }
+
+static ThreadHookCounters& LocalCounters()
+{
+    if (_localCounters.counters == nullptr)
+    {
+        auto counters = std::make_unique<ThreadHookCounters>();
+        counters->threadId = GetCurrentThreadId();
+        _localCounters.counters = counters.get();
+
+        std::lock_guard<std::mutex> lock(_profilerMutex);
+
+        // EndFrame doesn't run while profiler is disabled, games creating many short lived threads would grow the list
+        ReclaimExitedCounters();
+        _threadCounters.push_back(std::move(counters));
+    }
+
+    return *_localCounters.counters;
+}
+
+// Caller holds _profilerMutex
+static void UpdateTickRate()
+{
+    LARGE_INTEGER now {};
+    LARGE_INTEGER frequency {};
+    QueryPerformanceCounter(&now);
+    QueryPerformanceFrequency(&frequency);
+
+    auto elapsedUs = (double) (now.QuadPart - _startQpc.QuadPart) * 1000000.0 / (double) frequency.QuadPart;
+
+    if (elapsedUs > 1000.0)
+        _ticksPerUs = (double) (__rdtsc() - _startTicks) / elapsedUs;
+}
+
+static inline double TicksToUs(uint64_t ticks) { return _ticksPerUs > 0.0 ? (double) ticks / _ticksPerUs : 0.0; }
+
+HookProfiler::Scope*& HookProfiler::CurrentScope() { return _currentScope; }
+
+void HookProfiler::AddSample(ProfiledHook hook, uint64_t selfTicks)
+{
+    auto& counters = LocalCounters();
+    Bump(counters.calls[(size_t) hook], 1);
+    Bump(counters.selfTicks[(size_t) hook], selfTicks);
+}
+
+void HookProfiler::AddLockTicks(uint64_t ticks)
+{
+    if (_currentScope == nullptr)
+        return;
+
+    Bump(LocalCounters().lockTicks[(size_t) _currentScope->_hook], ticks);
+}
+
+void HookProfiler::SetEnabled(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(_profilerMutex);
+
+    if (enabled == _enabled.load(std::memory_order_relaxed))
+        return;
+
+    if (enabled)
+    {
+        ReclaimExitedCounters();
+
+        std::fill(std::begin(_exitedCalls), std::end(_exitedCalls), 0);
+        std::fill(std::begin(_exitedSelfTicks), std::end(_exitedSelfTicks), 0);
+        std::fill(std::begin(_exitedLockTicks), std::end(_exitedLockTicks), 0);
+
+        // Counters are never reset from here as owners write them without atomics, new baseline is taken instead
+        for (auto& counters : _threadCounters)
+        {
+            for (size_t i = 0; i < HOOK_COUNT; i++)
+            {
+                counters->baseCalls[i] = counters->lastCalls[i] = counters->calls[i].load(std::memory_order_relaxed);
+                counters->baseSelfTicks[i] = counters->lastSelfTicks[i] =
+                    counters->selfTicks[i].load(std::memory_order_relaxed);
+                counters->baseLockTicks[i] = counters->lastLockTicks[i] =
+                    counters->lockTicks[i].load(std::memory_order_relaxed);
+            }
+        }
+
+        _frameHooks.assign(HOOK_COUNT, {});
+        _frameThreads.clear();
+        _profiledFrames = 0;
+        _ticksPerUs = 0.0;
+
+        QueryPerformanceCounter(&_startQpc);
+        _startTicks = __rdtsc();
+    }
+
+    _enabled.store(enabled, std::memory_order_relaxed);
+    LOG_INFO("Hook profiler enabled: {}", enabled);
+}
+
+void HookProfiler::EndFrame()
+{
+    if (!IsEnabled())
+        return;
+
+    std::lock_guard<std::mutex> lock(_profilerMutex);
+
+    UpdateTickRate();
+    _profiledFrames++;
+
+    _frameHooks.assign(HOOK_COUNT, {});
+    _frameThreads.clear();
+
+    for (auto& counters : _threadCounters)
+    {
+        HookProfileThreadStats threadStats {};
+        threadStats.threadId = counters->threadId;
+
+        for (size_t i = 0; i < HOOK_COUNT; i++)
+        {
+            auto calls = counters->calls[i].load(std::memory_order_relaxed);
+            auto selfTicks = counters->selfTicks[i].load(std::memory_order_relaxed);
+            auto lockTicks = counters->lockTicks[i].load(std::memory_order_relaxed);
+
+            auto callDelta = calls - counters->lastCalls[i];
+
+            if (callDelta > 0)
+            {
+                auto selfUs = TicksToUs(selfTicks - counters->lastSelfTicks[i]);
+                auto lockUs = TicksToUs(lockTicks - counters->lastLockTicks[i]);
+
+                _frameHooks[i].calls += callDelta;
+                _frameHooks[i].selfUs += selfUs;
+                _frameHooks[i].lockUs += lockUs;
+
+                threadStats.total.calls += callDelta;
+                threadStats.total.selfUs += selfUs;
+                threadStats.total.lockUs += lockUs;
+            }
+
+            counters->lastCalls[i] = calls;
+            counters->lastSelfTicks[i] = selfTicks;
+            counters->lastLockTicks[i] = lockTicks;
+        }
+
+        if (threadStats.total.calls > 0)
+            _frameThreads.push_back(threadStats);
+    }
+
+    ReclaimExitedCounters();
+}
+
+void HookProfiler::GetFrameStats(std::vector<HookProfileStats>& hooks, std::vector<HookProfileThreadStats>& threads)
+{
+    std::lock_guard<std::mutex> lock(_profilerMutex);
+    hooks = _frameHooks;
+    threads = _frameThreads;
+}
+
+const char* HookProfiler::GetName(ProfiledHook hook)
+{
+    if (hook >= ProfiledHook::Count)
+        return "Unknown";
+
+    return _hookNames[(size_t) hook];
+}
+
+bool HookProfiler::DumpCsv(const std::wstring& fileName)
+{
+    std::lock_guard<std::mutex> lock(_profilerMutex);
+
+    std::ofstream file(fileName, std::ios::trunc);
+
+    if (!file.is_open())
+    {
+        LOG_ERROR("Can't create hook profile file: {}", wstring_to_string(fileName));
+        return false;
+    }
+
+    UpdateTickRate();
+
+    auto frames = _profiledFrames > 0 ? (double) _profiledFrames : 1.0;
+    file << "thread_id,hook,calls,self_us,lock_us,calls_per_frame,self_us_per_frame\n";
+
+    for (auto& counters : _threadCounters)
+    {
+        for (size_t i = 0; i < HOOK_COUNT; i++)
+        {
+            auto calls = counters->calls[i].load(std::memory_order_relaxed) - counters->baseCalls[i];
+
+            if (calls == 0)
+                continue;
+
+            auto selfTicks = counters->selfTicks[i].load(std::memory_order_relaxed) - counters->baseSelfTicks[i];
+            auto lockTicks = counters->lockTicks[i].load(std::memory_order_relaxed) - counters->baseLockTicks[i];
+            auto selfUs = TicksToUs(selfTicks);
+            auto lockUs = TicksToUs(lockTicks);
+
+            file << counters->threadId << "," << _hookNames[i] << "," << calls << "," << selfUs << "," << lockUs << ","
+                 << (double) calls / frames << "," << selfUs / frames << "\n";
+        }
+    }
+
+    for (size_t i = 0; i < HOOK_COUNT; i++)
+    {
+        if (_exitedCalls[i] == 0)
+            continue;
+
+        auto selfUs = TicksToUs(_exitedSelfTicks[i]);
+        auto lockUs = TicksToUs(_exitedLockTicks[i]);
+
+        file << "exited," << _hookNames[i] << "," << _exitedCalls[i] << "," << selfUs << "," << lockUs << ","
+             << (double) _exitedCalls[i] / frames << "," << selfUs / frames << "\n";
+    }
+
+    LOG_INFO("Hook profile written to {}, {} frames", wstring_to_string(fileName), _profiledFrames);
+    return true;
+}
@@ -0,0 +1,175 @@
+#pragma once
+#include <pch.h>
+
+#include <intrin.h>
+#include <mutex>
+#include <vector>
+
+// Hooks measured by HookProfiler, names are kept in HookProfiler.cpp
+enum class ProfiledHook : uint8_t
+{
+    // Resource tracking
+    RT_CreateRenderTargetView,
+    RT_CreateShaderResourceView,
+    RT_CreateUnorderedAccessView,
+    RT_CreateDescriptorHeap,
+    RT_HeapRelease,
+    RT_CopyDescriptors,
+    RT_CopyDescriptorsSimple,
+    RT_Release,
+    RT_SetGraphicsRootDescriptorTable,
+    RT_SetComputeRootDescriptorTable,
+    RT_OMSetRenderTargets,
+    RT_DrawInstanced,
+    RT_DrawIndexedInstanced,
+    RT_Dispatch,
+    RT_ExecuteBundle,
+    RT_Close,
+    RT_ExecuteCommandLists,
+
+    // D3D12 device
+    D3D12_CreateDevice,
+    D3D12_FactoryCreateDevice,
+    D3D12_GetInterface,
+    D3D12_DeviceRelease,
+    D3D12_CreateCommittedResource,
+    D3D12_CreatePlacedResource,
+    D3D12_CreateSampler,
+    D3D12_CreateRootSignature,
+    D3D12_CheckFeatureSupport,
+    D3D12_SerializeRootSignature,
+    D3D12_SerializeVersionedRootSignature,
+
+    // FG swapchain
+    FG_Present,
+    FG_ResizeBuffers,
+
+    // NGX
+    NGX_D3D12_EvaluateFeature,
+    NGX_D3D12_SetComputeRootSignature,
+    NGX_D3D12_SetGraphicsRootSignature,
+    NGX_D3D11_EvaluateFeature,
+    NGX_Vulkan_EvaluateFeature,
+
+    Count
+};
+
+struct HookProfileStats
+{
+    uint64_t calls = 0;
+    double selfUs = 0.0; // time inside hook excluding original call
+    double lockUs = 0.0; // time waited on locks inside hook
+};
+
+struct HookProfileThreadStats
+{
+    uint32_t threadId = 0;
+    HookProfileStats total;
+};
+
+// Per hook call counts and timers. Each thread only writes its own counters, EndFrame aggregates them once per
+// present. When disabled a hook only pays one relaxed atomic load.
+class HookProfiler
+{
+  public:
+    class Scope;
+
+  private:
+    inline static std::atomic<bool> _enabled { false };
+
+    static void AddSample(ProfiledHook hook, uint64_t selfTicks);
+    static void AddLockTicks(uint64_t ticks);
+    static Scope*& CurrentScope();
+
+  public:
+    static bool IsEnabled() { return _enabled.load(std::memory_order_relaxed); }
+    static void SetEnabled(bool enabled);
+
+    // Aggregates thread counters, called once per present
+    static void EndFrame();
+
+    // Last frame's per hook stats and per thread totals of last frame
+    static void GetFrameStats(std::vector<HookProfileStats>& hooks, std::vector<HookProfileThreadStats>& threads);
+    static const char* GetName(ProfiledHook hook);
+
+    // Writes accumulated per thread and per hook totals since profiler was enabled
+    static bool DumpCsv(const std::wstring& fileName);
+
+    class Scope
+    {
+        ProfiledHook _hook;
+        bool _active = false;
+        uint64_t _start = 0;
+        uint64_t _excluded = 0;
+        Scope* _parent = nullptr;
+        bool _inOriginal = false;
+
+      public:
+        explicit Scope(ProfiledHook hook) : _hook(hook), _active(IsEnabled())
+        {
+            if (!_active)
+                return;
+
+            auto& current = CurrentScope();
+            _parent = current;
+            current = this;
+            _start = __rdtsc();
+        }
+
+        ~Scope()
+        {
+            if (!_active)
+                return;
+
+            auto elapsed = __rdtsc() - _start;
+            AddSample(_hook, elapsed > _excluded ? elapsed - _excluded : 0);
+
+            // Nested hook's time belongs to itself only, time inside original calls is already excluded
+            if (_parent != nullptr && !_parent->_inOriginal)
+                _parent->_excluded += elapsed;
+
+            CurrentScope() = _parent;
+        }
+
+        // Calls original function, its time is excluded from hook time
+        template <typename F, typename... Args> decltype(auto) Call(F function, Args&&... args)
+        {
+            if (!_active)
+                return function(std::forward<Args>(args)...);
+
+            struct Exclude
+            {
+                Scope& scope;
+                uint64_t start = __rdtsc();
+
+                ~Exclude()
+                {
+                    scope._excluded += __rdtsc() - start;
+                    scope._inOriginal = false;
+                }
+            } exclude { *this };
+
+            _inOriginal = true;
+
+            return function(std::forward<Args>(args)...);
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        friend class HookProfiler;
+    };
+
+    // Locks mutex and accounts wait time to the hook running on this thread
+    template <typename M> static std::unique_lock<M> TimedLock(M& mutex)
+    {
+        if (!IsEnabled())
+            return std::unique_lock<M>(mutex);
+
+        auto start = __rdtsc();
+        std::unique_lock<M> lock(mutex);
+        AddLockTicks(__rdtsc() - start);
+
+        return lock;
+    }
+};
@@ -0,0 +1,487 @@
+#include "RootSignatureCache.h"
+
+#include <Util.h>
+#include <Config.h>
+
+#include <ankerl/unordered_dense.h>
+
+#include <fstream>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+
+#pragma region DXBC container
+
+constexpr uint32_t DXBC_MAGIC = 0x43425844; // "DXBC"
+constexpr uint32_t RTS0_FOURCC = 0x30535452; // "RTS0"
+
+// RTS0 versions, 1.0 and 1.1 share sampler layout, 1.2 adds Flags
+constexpr uint32_t RTS0_VERSION_1_0 = 1;
+constexpr uint32_t RTS0_VERSION_1_1 = 2;
+constexpr uint32_t RTS0_VERSION_1_2 = 3;
+
+struct DxbcHeader
+{
+    uint32_t magic;
+    uint8_t digest[16];
+    uint16_t majorVersion;
+    uint16_t minorVersion;
+    uint32_t containerSize;
+    uint32_t partCount;
+};
+
+struct DxbcPartHeader
+{
+    uint32_t fourCC;
+    uint32_t partSize;
+};
+
+struct Rts0Header
+{
+    uint32_t version;
+    uint32_t numParameters;
+    uint32_t parametersOffset;
+    uint32_t numStaticSamplers;
+    uint32_t staticSamplersOffset;
+    uint32_t flags;
+};
+
+// Serialized static samplers are the API structs as is
+static_assert(sizeof(D3D12_STATIC_SAMPLER_DESC) == 52, "Unexpected D3D12_STATIC_SAMPLER_DESC layout");
+static_assert(sizeof(D3D12_STATIC_SAMPLER_DESC1) == 56, "Unexpected D3D12_STATIC_SAMPLER_DESC1 layout");
+
+static inline uint32_t RotateLeft(uint32_t value, uint32_t count) { return (value << count) | (value >> (32 - count)); }
+
+static void Md5Transform(uint32_t state[4], const uint32_t x[16])
+{
+    static const uint32_t k[64] = {
+        0xD76AA478, 0xE8C7B756, 0x242070DB, 0xC1BDCEEE, 0xF57C0FAF, 0x4787C62A, 0xA8304613, 0xFD469501,
+        0x698098D8, 0x8B44F7AF, 0xFFFF5BB1, 0x895CD7BE, 0x6B901122, 0xFD987193, 0xA679438E, 0x49B40821,
+        0xF61E2562, 0xC040B340, 0x265E5A51, 0xE9B6C7AA, 0xD62F105D, 0x02441453, 0xD8A1E681, 0xE7D3FBC8,
+        0x21E1CDE6, 0xC33707D6, 0xF4D50D87, 0x455A14ED, 0xA9E3E905, 0xFCEFA3F8, 0x676F02D9, 0x8D2A4C8A,
+        0xFFFA3942, 0x8771F681, 0x6D9D6122, 0xFDE5380C, 0xA4BEEA44, 0x4BDECFA9, 0xF6BB4B60, 0xBEBFBC70,
+        0x289B7EC6, 0xEAA127FA, 0xD4EF3085, 0x04881D05, 0xD9D4D039, 0xE6DB99E5, 0x1FA27CF8, 0xC4AC5665,
+        0xF4292244, 0x432AFF97, 0xAB9423A7, 0xFC93A039, 0x655B59C3, 0x8F0CCC92, 0xFFEFF47D, 0x85845DD1,
+        0x6FA87E4F, 0xFE2CE6E0, 0xA3014314, 0x4E0811A1, 0xF7537E82, 0xBD3AF235, 0x2AD7D2BB, 0xEB86D391,
+    };
+
+    static const uint32_t r[64] = {
+        7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 5, 9,  14, 20, 5, 9,  14, 20,
+        5, 9,  14, 20, 5, 9,  14, 20, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
+        6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21, 6, 10, 15, 21,
+    };
+
+    auto a = state[0];
+    auto b = state[1];
+    auto c = state[2];
+    auto d = state[3];
+
+    for (uint32_t i = 0; i < 64; i++)
+    {
+        uint32_t f;
+        uint32_t g;
+
+        if (i < 16)
+        {
+            f = (b & c) | (~b & d);
+            g = i;
+        }
+        else if (i < 32)
+        {
+            f = (d & b) | (~d & c);
+            g = (5 * i + 1) % 16;
+        }
+        else if (i < 48)
+        {
+            f = b ^ c ^ d;
+            g = (3 * i + 5) % 16;
+        }
+        else
+        {
+            f = c ^ (b | ~d);
+            g = (7 * i) % 16;
+        }
+
+        auto temp = d;
+        d = c;
+        c = b;
+        b = b + RotateLeft(a + f + k[i] + x[g], r[i]);
+        a = temp;
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+}
+
+// DXBC checksum, MD5 over everything after the digest with container specific length padding
+static void ComputeDxbcDigest(const uint8_t* container, size_t containerSize, uint8_t digest[16])
+{
+    constexpr size_t hashStart = offsetof(DxbcHeader, majorVersion);
+
+    auto data = container + hashStart;
+    auto size = (uint32_t) (containerSize - hashStart);
+
+    uint32_t state[4] = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476 };
+    uint32_t x[16];
+
+    auto fullSize = size & ~63u;
+
+    for (uint32_t offset = 0; offset < fullSize; offset += 64)
+    {
+        memcpy(x, data + offset, 64);
+        Md5Transform(state, x);
+    }
+
+    auto leftOver = size - fullSize;
+    auto bitCount = size << 3;
+    auto tail = (uint8_t*) x;
+
+    if (leftOver < 56)
+    {
+        // Bit count goes to the start of last block instead of the end
+        memset(x, 0, sizeof(x));
+        x[0] = bitCount;
+        memcpy(tail + 4, data + fullSize, leftOver);
+        tail[4 + leftOver] = 0x80;
+    }
+    else
+    {
+        memset(x, 0, sizeof(x));
+        memcpy(tail, data + fullSize, leftOver);
+        tail[leftOver] = 0x80;
+        Md5Transform(state, x);
+
+        memset(x, 0, sizeof(x));
+        x[0] = bitCount;
+    }
+
+    x[15] = (size << 1) | 1;
+    Md5Transform(state, x);
+
+    memcpy(digest, state, 16);
+}
+
+bool RootSignatureCache::PatchStaticSamplers(const void* blob, SIZE_T size, const PatchStaticSamplerFn& patch,
+                                             const PatchStaticSampler1Fn& patch1, std::vector<uint8_t>& output)
+{
+    output.clear();
+
+    auto data = (const uint8_t*) blob;
+
+    if (data == nullptr || size < sizeof(DxbcHeader) || size > UINT32_MAX)
+        return false;
+
+    DxbcHeader header {};
+    memcpy(&header, data, sizeof(header));
+
+    if (header.magic != DXBC_MAGIC || header.containerSize != size ||
+        header.partCount > (size - sizeof(DxbcHeader)) / sizeof(uint32_t))
+    {
+        return false;
+    }
+
+    // Patched blob must be signed again, only continue if we can reproduce the original checksum
+    uint8_t digest[16];
+    ComputeDxbcDigest(data, size, digest);
+
+    if (memcmp(digest, header.digest, sizeof(digest)) != 0)
+    {
+        LOG_DEBUG("Root signature checksum mismatch");
+        return false;
+    }
+
+    for (uint32_t i = 0; i < header.partCount; i++)
+    {
+        uint32_t partOffset = 0;
+        memcpy(&partOffset, data + sizeof(DxbcHeader) + i * sizeof(uint32_t), sizeof(partOffset));
+
+        if ((UINT64) partOffset + sizeof(DxbcPartHeader) > size)
+            return false;
+
+        DxbcPartHeader part {};
+        memcpy(&part, data + partOffset, sizeof(part));
+
+        if (part.fourCC != RTS0_FOURCC)
+            continue;
+
+        auto partStart = (UINT64) partOffset + sizeof(DxbcPartHeader);
+
+        if (partStart + part.partSize > size || part.partSize < sizeof(Rts0Header))
+            return false;
+
+        Rts0Header rts0 {};
+        memcpy(&rts0, data + partStart, sizeof(rts0));
+
+        UINT64 stride = 0;
+
+        if (rts0.version == RTS0_VERSION_1_0 || rts0.version == RTS0_VERSION_1_1)
+            stride = sizeof(D3D12_STATIC_SAMPLER_DESC);
+        else if (rts0.version == RTS0_VERSION_1_2)
+            stride = sizeof(D3D12_STATIC_SAMPLER_DESC1);
+        else
+            return false;
+
+        if (rts0.numStaticSamplers == 0)
+            return true;
+
+        if ((UINT64) rts0.staticSamplersOffset + rts0.numStaticSamplers * stride > part.partSize)
+            return false;
+
+        output.assign(data, data + size);
+        auto samplers = output.data() + partStart + rts0.staticSamplersOffset;
+
+        for (uint32_t j = 0; j < rts0.numStaticSamplers; j++)
+        {
+            auto sampler = samplers + j * stride;
+
+            if (rts0.version == RTS0_VERSION_1_2)
+            {
+                D3D12_STATIC_SAMPLER_DESC1 desc {};
+                memcpy(&desc, sampler, sizeof(desc));
+                patch1(desc);
+                memcpy(sampler, &desc, sizeof(desc));
+            }
+            else
+            {
+                D3D12_STATIC_SAMPLER_DESC desc {};
+                memcpy(&desc, sampler, sizeof(desc));
+                patch(desc);
+                memcpy(sampler, &desc, sizeof(desc));
+            }
+        }
+
+        if (memcmp(output.data(), data, size) == 0)
+        {
+            output.clear();
+            return true;
+        }
+
+        ComputeDxbcDigest(output.data(), size, digest);
+        memcpy(output.data() + offsetof(DxbcHeader, digest), digest, sizeof(digest));
+
+        return true;
+    }
+
+    // No root signature part
+    return false;
+}
+
+#pragma endregion
+
+#pragma region Cache
+
+constexpr uint32_t CACHE_MAGIC = 0x43475352; // "RSGC"
+constexpr uint32_t CACHE_VERSION = 2;
+
+// Records aren't appended past this size, a file above it is started again on load
+constexpr UINT64 CACHE_FILE_LIMIT = 64ull * 1024 * 1024;
+
+struct CacheFileHeader
+{
+    uint32_t magic = CACHE_MAGIC;
+    uint32_t version = CACHE_VERSION;
+};
+
+struct CacheFileRecord
+{
+    UINT64 key = 0;
+    uint8_t inputDigest[16] {};
+    UINT64 inputSize = 0;
+    float minMipBias = 0.0f;
+    float maxMipBias = 0.0f;
+    uint32_t hasMipBias = 0;
+    uint32_t blobSize = 0;
+};
+
+static std::shared_mutex _cacheMutex;
+static ankerl::unordered_dense::map<UINT64, std::shared_ptr<const RootSignatureCacheEntry>> _cache;
+static std::once_flag _loadOnce;
+static std::ofstream _cacheFile;
+static UINT64 _cacheFileSize = 0;
+
+static void WriteRecord(UINT64 key, const RootSignatureCacheEntry& entry)
+{
+    CacheFileRecord record {};
+    record.key = key;
+    memcpy(record.inputDigest, entry.inputDigest, sizeof(record.inputDigest));
+    record.inputSize = entry.inputSize;
+    record.hasMipBias = entry.hasMipBias ? 1 : 0;
+    record.minMipBias = entry.minMipBias;
+    record.maxMipBias = entry.maxMipBias;
+    record.blobSize = (uint32_t) entry.blob.size();
+
+    _cacheFile.write((const char*) &record, sizeof(record));
+
+    if (!entry.blob.empty())
+        _cacheFile.write((const char*) entry.blob.data(), entry.blob.size());
+
+    _cacheFileSize += sizeof(record) + entry.blob.size();
+}
+
+static void LoadCacheFile()
+{
+    if (!Config::Instance()->RootSignatureDiskCache.value_or_default())
+        return;
+
+    auto fileName = Util::DllPath().parent_path() / L"OptiScaler_RootSignature.cache";
+    bool rewrite = true;
+    UINT64 fileSize = 0;
+
+    std::unique_lock lock(_cacheMutex);
+
+    if (std::ifstream file(fileName, std::ios::binary | std::ios::ate); file.is_open())
+    {
+        fileSize = (UINT64) file.tellg();
+        file.seekg(0);
+
+        CacheFileHeader header {};
+
+        if (fileSize <= CACHE_FILE_LIMIT && file.read((char*) &header, sizeof(header)) &&
+            header.magic == CACHE_MAGIC && header.version == CACHE_VERSION)
+        {
+            rewrite = false;
+            CacheFileRecord record {};
+
+            while (file.read((char*) &record, sizeof(record)))
+            {
+                auto entry = std::make_shared<RootSignatureCacheEntry>();
+                memcpy(entry->inputDigest, record.inputDigest, sizeof(entry->inputDigest));
+                entry->inputSize = record.inputSize;
+                entry->hasMipBias = record.hasMipBias != 0;
+                entry->minMipBias = record.minMipBias;
+                entry->maxMipBias = record.maxMipBias;
+
+                if (record.blobSize > fileSize)
+                {
+                    rewrite = true;
+                    break;
+                }
+
+                entry->blob.resize(record.blobSize);
+
+                if (record.blobSize > 0 && !file.read((char*) entry->blob.data(), record.blobSize))
+                {
+                    rewrite = true;
+                    break;
+                }
+
+                // Later records replace colliding ones, same as in memory
+                _cache[record.key] = std::move(entry);
+            }
+
+            // Partial record from an interrupted write
+            if (!file.eof() || file.gcount() != 0)
+                rewrite = true;
+        }
+    }
+
+    if (rewrite)
+    {
+        _cacheFile.open(fileName, std::ios::binary | std::ios::trunc);
+
+        if (_cacheFile.is_open())
+        {
+            CacheFileHeader header {};
+            _cacheFile.write((const char*) &header, sizeof(header));
+            _cacheFileSize = sizeof(header);
+
+            for (const auto& [key, entry] : _cache)
+                WriteRecord(key, *entry);
+
+            _cacheFile.flush();
+        }
+    }
+    else
+    {
+        _cacheFile.open(fileName, std::ios::binary | std::ios::app);
+        _cacheFileSize = fileSize;
+    }
+
+    if (!_cacheFile.is_open())
+        LOG_WARN("Can't open root signature cache file: {}", wstring_to_string(fileName.wstring()));
+
+    LOG_INFO("Loaded {} root signatures from cache", _cache.size());
+}
+
+UINT64 RootSignatureCache::GetKey(const void* blob, SIZE_T size, UINT64 settingsHash)
+{
+    auto hash = ankerl::unordered_dense::hash<std::string_view> {}(std::string_view((const char*) blob, size));
+    return hash ^ (settingsHash + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2));
+}
+
+static bool SameInput(const RootSignatureCacheEntry& a, const RootSignatureCacheEntry& b)
+{
+    return a.inputSize == b.inputSize && memcmp(a.inputDigest, b.inputDigest, sizeof(a.inputDigest)) == 0;
+}
+
+void RootSignatureCache::SetInput(RootSignatureCacheEntry& entry, const void* blob, SIZE_T size)
+{
+    memset(entry.inputDigest, 0, sizeof(entry.inputDigest));
+    entry.inputSize = size;
+
+    if (blob == nullptr || size < sizeof(DxbcHeader))
+        return;
+
+    DxbcHeader header {};
+    memcpy(&header, blob, sizeof(header));
+
+    if (header.magic == DXBC_MAGIC)
+        memcpy(entry.inputDigest, header.digest, sizeof(entry.inputDigest));
+}
+
+std::shared_ptr<const RootSignatureCacheEntry> RootSignatureCache::Get(UINT64 key, const void* blob, SIZE_T size)
+{
+    std::call_once(_loadOnce, LoadCacheFile);
+
+    RootSignatureCacheEntry input {};
+    SetInput(input, blob, size);
+
+    std::shared_lock lock(_cacheMutex);
+
+    if (auto it = _cache.find(key); it != _cache.end() && SameInput(*it->second, input))
+        return it->second;
+
+    return nullptr;
+}
+
+std::shared_ptr<const RootSignatureCacheEntry> RootSignatureCache::Put(UINT64 key, RootSignatureCacheEntry&& entry)
+{
+    std::call_once(_loadOnce, LoadCacheFile);
+
+    auto shared = std::make_shared<const RootSignatureCacheEntry>(std::move(entry));
+
+    std::unique_lock lock(_cacheMutex);
+
+    auto [it, inserted] = _cache.try_emplace(key, shared);
+
+    if (!inserted)
+    {
+        if (SameInput(*it->second, *shared))
+            return it->second;
+
+        // Key collision with another blob, newer one is kept
+        LOG_DEBUG("Root signature cache key collision: {:X}", key);
+        it->second = shared;
+    }
+
+    if (_cacheFile.is_open())
+    {
+        // Stop persisting instead of growing a file which would be dropped on next load
+        if (_cacheFileSize + sizeof(CacheFileRecord) + shared->blob.size() > CACHE_FILE_LIMIT)
+        {
+            LOG_INFO("Root signature cache file reached {} bytes, not adding new records", _cacheFileSize);
+            _cacheFile.close();
+        }
+        else
+        {
+            WriteRecord(key, *shared);
+            _cacheFile.flush();
+        }
+    }
+
+    return shared;
+}
+
+#pragma endregion
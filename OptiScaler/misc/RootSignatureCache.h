@@ -0,0 +1,47 @@
+#pragma once
+#include <pch.h>
+
+#include <d3d12.h>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+struct RootSignatureCacheEntry
+{
+    // Identity of input blob next to the key, DXBC container digest (zero if blob isn't a container) and size
+    uint8_t inputDigest[16] {};
+    UINT64 inputSize = 0;
+
+    // Lowest and highest overridden mip bias, replayed to menu stats on cache hits
+    bool hasMipBias = false;
+    float minMipBias = 0.0f;
+    float maxMipBias = 0.0f;
+
+    // Empty when original blob doesn't need any changes
+    std::vector<uint8_t> blob;
+};
+
+typedef std::function<void(D3D12_STATIC_SAMPLER_DESC& samplerDesc)> PatchStaticSamplerFn;
+typedef std::function<void(D3D12_STATIC_SAMPLER_DESC1& samplerDesc)> PatchStaticSampler1Fn;
+
+// Root signatures rewritten for sampler overrides, keyed by input blob and override settings.
+// Entries are appended to OptiScaler_RootSignature.cache next to OptiScaler so later runs skip rewriting too.
+class RootSignatureCache
+{
+  public:
+    static UINT64 GetKey(const void* blob, SIZE_T size, UINT64 settingsHash);
+
+    // Fills inputDigest and inputSize of entry from the input blob
+    static void SetInput(RootSignatureCacheEntry& entry, const void* blob, SIZE_T size);
+
+    // Entry is only returned if it was made from a blob with the same digest and size
+    static std::shared_ptr<const RootSignatureCacheEntry> Get(UINT64 key, const void* blob, SIZE_T size);
+    static std::shared_ptr<const RootSignatureCacheEntry> Put(UINT64 key, RootSignatureCacheEntry&& entry);
+
+    // Patches static sampler table of a serialized root signature (DXBC container with RTS0 part) in a copy of
+    // the blob and signs it again. Returns false when layout is not recognized or container checksum can't be
+    // reproduced, caller should use deserializer then. On success output is empty if nothing was changed.
+    static bool PatchStaticSamplers(const void* blob, SIZE_T size, const PatchStaticSamplerFn& patch,
+                                    const PatchStaticSampler1Fn& patch1, std::vector<uint8_t>& output);
+};
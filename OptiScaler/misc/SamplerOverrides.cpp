@@ -0,0 +1,135 @@
+#include "SamplerOverrides.h"
+
+#include <Config.h>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+static std::mutex _policyMutex;
+
+// Old policies are kept as hooks might still be using them, they only change with user actions
+static std::vector<std::unique_ptr<SamplerOverridePolicy>> _policies;
+
+// Every setting sampler overrides depend on
+static UINT64 ComputeSettingsHash()
+{
+    auto config = Config::Instance();
+    UINT64 hash = 0xCBF29CE484222325;
+
+    auto combine = [&hash](UINT64 value) { hash = (hash ^ value) * 0x100000001B3; };
+
+    uint32_t mipBias = 0;
+    if (config->MipmapBiasOverride.has_value())
+    {
+        auto value = config->MipmapBiasOverride.value();
+        std::memcpy(&mipBias, &value, sizeof(mipBias));
+    }
+
+    combine(config->MipmapBiasOverride.has_value());
+    combine(mipBias);
+    combine(config->MipmapBiasFixedOverride.value_or_default());
+    combine(config->MipmapBiasScaleOverride.value_or_default());
+    combine(config->MipmapBiasOverrideAll.value_or_default());
+    combine(config->AnisotropyOverride.has_value());
+    combine(config->AnisotropyOverride.has_value() ? config->AnisotropyOverride.value() : 0);
+    combine(config->AnisotropySkipPointFilter.value_or_default());
+    combine(config->AnisotropyModifyComp.value_or_default());
+    combine(config->AnisotropyModifyMinMax.value_or_default());
+
+    return hash;
+}
+
+static D3D12_FILTER UpgradeToAF(D3D12_FILTER f, bool skipPoint, bool modifyComp, bool modifyMinMax)
+{
+    // Skip point filter
+    const auto minF = D3D12_DECODE_MIN_FILTER(f);
+    const auto magF = D3D12_DECODE_MAG_FILTER(f);
+    const auto mipF = D3D12_DECODE_MIP_FILTER(f);
+    if (skipPoint &&
+        ((mipF == D3D12_FILTER_TYPE_POINT) || (minF == D3D12_FILTER_TYPE_POINT && magF == D3D12_FILTER_TYPE_POINT)))
+    {
+        return f;
+    }
+
+    const auto reduction = D3D12_DECODE_FILTER_REDUCTION(f);
+
+    if (reduction == D3D12_FILTER_REDUCTION_TYPE_COMPARISON)
+    {
+        if (modifyComp)
+            return D3D12_ENCODE_ANISOTROPIC_FILTER(D3D12_FILTER_REDUCTION_TYPE_COMPARISON);
+
+        return f;
+    }
+
+    if (reduction == D3D12_FILTER_REDUCTION_TYPE_MINIMUM)
+    {
+        if (modifyMinMax)
+            return D3D12_ENCODE_ANISOTROPIC_FILTER(D3D12_FILTER_REDUCTION_TYPE_MINIMUM);
+
+        return f;
+    }
+
+    if (reduction == D3D12_FILTER_REDUCTION_TYPE_MAXIMUM)
+    {
+        if (modifyMinMax)
+            return D3D12_ENCODE_ANISOTROPIC_FILTER(D3D12_FILTER_REDUCTION_TYPE_MAXIMUM);
+
+        return f;
+    }
+
+    return D3D12_ENCODE_ANISOTROPIC_FILTER(D3D12_FILTER_REDUCTION_TYPE_STANDARD);
+}
+
+const SamplerOverridePolicy* SamplerOverrides::Build()
+{
+    auto config = Config::Instance();
+    auto settingsHash = ComputeSettingsHash();
+
+    std::lock_guard<std::mutex> lock(_policyMutex);
+
+    // Another thread might have built it already
+    auto current = _policy.load(std::memory_order_acquire);
+    if (current != nullptr && current->settingsHash == settingsHash)
+        return current;
+
+    auto policy = std::make_unique<SamplerOverridePolicy>();
+    policy->settingsHash = settingsHash;
+
+    policy->mipBiasEnabled = config->MipmapBiasOverride.has_value();
+    policy->mipBiasAll = config->MipmapBiasOverrideAll.value_or_default();
+    policy->mipBias = config->MipmapBiasOverride.value_or(0.0f);
+
+    if (config->MipmapBiasFixedOverride.value_or_default())
+        policy->mipBiasMode = MipBiasMode::Fixed;
+    else if (config->MipmapBiasScaleOverride.value_or_default())
+        policy->mipBiasMode = MipBiasMode::Scale;
+
+    policy->anisotropyEnabled = config->AnisotropyOverride.has_value();
+    policy->anisotropy = config->AnisotropyOverride.value_or(1);
+
+    auto skipPoint = config->AnisotropySkipPointFilter.value_or_default();
+    auto modifyComp = config->AnisotropyModifyComp.value_or_default();
+    auto modifyMinMax = config->AnisotropyModifyMinMax.value_or_default();
+
+    for (UINT i = 0; i < SamplerOverridePolicy::FILTER_COUNT; i++)
+        policy->filterRemap[i] = (uint16_t) UpgradeToAF((D3D12_FILTER) i, skipPoint, modifyComp, modifyMinMax);
+
+    LOG_INFO("Sampler overrides, mip bias: {} ({}, mode: {}, all: {}), anisotropy: {} ({})", policy->mipBiasEnabled,
+             policy->mipBias, (UINT) policy->mipBiasMode, policy->mipBiasAll, policy->anisotropyEnabled,
+             policy->anisotropy);
+
+    auto result = policy.get();
+    _policies.push_back(std::move(policy));
+    _policy.store(result, std::memory_order_release);
+
+    return result;
+}
+
+void SamplerOverrides::Refresh()
+{
+    auto current = _policy.load(std::memory_order_acquire);
+
+    if (current == nullptr || current->settingsHash != ComputeSettingsHash())
+        Build();
+}
@@ -0,0 +1,77 @@
+#pragma once
+#include <pch.h>
+
+#include <d3d12.h>
+
+#include <atomic>
+
+enum class MipBiasMode : uint8_t
+{
+    Add,
+    Fixed,
+    Scale
+};
+
+// Dx12 sampler override settings compiled from config, never modified after creation
+struct SamplerOverridePolicy
+{
+    // Every D3D12_FILTER value fits in 9 bits
+    static constexpr size_t FILTER_COUNT = 0x200;
+
+    UINT64 settingsHash = 0;
+
+    bool mipBiasEnabled = false;
+    bool mipBiasAll = false;
+    MipBiasMode mipBiasMode = MipBiasMode::Add;
+    float mipBias = 0.0f;
+
+    bool anisotropyEnabled = false;
+    UINT anisotropy = 1;
+
+    // Filter after anisotropic upgrade, indexed by original filter
+    uint16_t filterRemap[FILTER_COUNT] {};
+
+    bool IsActive() const { return mipBiasEnabled || anisotropyEnabled; }
+
+    D3D12_FILTER UpgradeFilter(D3D12_FILTER filter) const
+    {
+        if ((UINT) filter >= FILTER_COUNT)
+            return filter;
+
+        return (D3D12_FILTER) filterRemap[(UINT) filter];
+    }
+
+    float ApplyMipBias(float mipBias) const
+    {
+        switch (mipBiasMode)
+        {
+        case MipBiasMode::Fixed:
+            return this->mipBias;
+
+        case MipBiasMode::Scale:
+            return mipBias * this->mipBias;
+
+        default:
+            return mipBias + this->mipBias;
+        }
+    }
+};
+
+class SamplerOverrides
+{
+    inline static std::atomic<const SamplerOverridePolicy*> _policy { nullptr };
+
+    static const SamplerOverridePolicy* Build();
+
+  public:
+    // Current policy, stays valid for the lifetime of the process
+    static const SamplerOverridePolicy& Policy()
+    {
+        auto policy = _policy.load(std::memory_order_acquire);
+        return policy != nullptr ? *policy : *Build();
+    }
+
+    // Compiles a new policy if related config values are changed.
+    // Called when hooks are installed, after config reload and once per present.
+    static void Refresh();
+};
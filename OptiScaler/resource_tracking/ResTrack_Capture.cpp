@@ -0,0 +1,151 @@
+#include <pch.h>
+
+#include "ResTrack_Capture.h"
+
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Records written to file in one go by each thread
+constexpr size_t CAPTURE_BLOCK_SIZE = 4096;
+
+struct CaptureThreadBuffer
+{
+    // Only contended while Stop is flushing other threads' buffers
+    std::mutex mutex;
+    std::vector<ResTrackRecord> records;
+    uint32_t threadId = 0;
+};
+
+static std::mutex _captureMutex;
+static std::ofstream _captureFile;
+static std::vector<std::shared_ptr<CaptureThreadBuffer>> _captureBuffers;
+static uint64_t _capturedRecords = 0;
+
+// Caller holds buffer mutex
+static void WriteBlock(CaptureThreadBuffer& buffer)
+{
+    if (buffer.records.empty())
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(_captureMutex);
+
+        if (_captureFile.is_open())
+        {
+            _captureFile.write((const char*) buffer.records.data(), buffer.records.size() * sizeof(ResTrackRecord));
+            _capturedRecords += buffer.records.size();
+        }
+    }
+
+    buffer.records.clear();
+}
+
+struct CaptureThreadHolder
+{
+    std::shared_ptr<CaptureThreadBuffer> buffer;
+
+    CaptureThreadHolder() : buffer(std::make_shared<CaptureThreadBuffer>())
+    {
+        buffer->threadId = GetCurrentThreadId();
+        buffer->records.reserve(CAPTURE_BLOCK_SIZE);
+
+        std::lock_guard<std::mutex> lock(_captureMutex);
+        _captureBuffers.push_back(buffer);
+    }
+
+    ~CaptureThreadHolder()
+    {
+        {
+            std::lock_guard<std::mutex> lock(buffer->mutex);
+            WriteBlock(*buffer);
+        }
+
+        std::lock_guard<std::mutex> lock(_captureMutex);
+        std::erase(_captureBuffers, buffer);
+    }
+};
+
+bool ResTrack_Capture::Start(const std::wstring& fileName)
+{
+    if (IsActive())
+        return true;
+
+    LARGE_INTEGER frequency {};
+    QueryPerformanceFrequency(&frequency);
+
+    {
+        std::lock_guard<std::mutex> lock(_captureMutex);
+
+        _captureFile.open(fileName, std::ios::binary | std::ios::trunc);
+
+        if (!_captureFile.is_open())
+        {
+            LOG_ERROR("Can't create capture file: {}", wstring_to_string(fileName));
+            return false;
+        }
+
+        ResTrackCaptureHeader header {};
+        header.timerFrequency = (uint64_t) frequency.QuadPart;
+        _captureFile.write((const char*) &header, sizeof(header));
+        _capturedRecords = 0;
+    }
+
+    _active.store(true, std::memory_order_release);
+    LOG_INFO("Resource tracking capture started: {}", wstring_to_string(fileName));
+
+    return true;
+}
+
+void ResTrack_Capture::Stop()
+{
+    if (!_active.exchange(false, std::memory_order_acq_rel))
+        return;
+
+    std::vector<std::shared_ptr<CaptureThreadBuffer>> buffers;
+
+    {
+        std::lock_guard<std::mutex> lock(_captureMutex);
+        buffers = _captureBuffers;
+    }
+
+    for (auto& buffer : buffers)
+    {
+        std::lock_guard<std::mutex> lock(buffer->mutex);
+        WriteBlock(*buffer);
+    }
+
+    std::lock_guard<std::mutex> lock(_captureMutex);
+    _captureFile.close();
+
+    LOG_INFO("Resource tracking capture stopped, {} records", _capturedRecords);
+}
+
+void ResTrack_Capture::Record(ResTrackOp op, uint64_t arg0, uint64_t arg1, uint64_t arg2, uint64_t arg3,
+                              uint8_t heapType)
+{
+    if (!IsActive())
+        return;
+
+    static thread_local CaptureThreadHolder holder;
+    auto& buffer = *holder.buffer;
+
+    LARGE_INTEGER now {};
+    QueryPerformanceCounter(&now);
+
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+
+    auto& record = buffer.records.emplace_back();
+    record.op = op;
+    record.heapType = heapType;
+    record.threadId = buffer.threadId;
+    record.timestamp = (uint64_t) now.QuadPart;
+    record.args[0] = arg0;
+    record.args[1] = arg1;
+    record.args[2] = arg2;
+    record.args[3] = arg3;
+
+    if (buffer.records.size() >= CAPTURE_BLOCK_SIZE)
+        WriteBlock(buffer);
+}
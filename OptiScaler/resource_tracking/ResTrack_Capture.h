@@ -0,0 +1,79 @@
+#pragma once
+
+// Binary capture of the resource tracking hook stream, for inspecting the hook load of a game offline.
+//
+// File layout: ResTrackCaptureHeader followed by ResTrackRecord entries. Each thread buffers its records and
+// writes them as blocks, so records are ordered per thread but not globally. Sort by timestamp when needed.
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+enum class ResTrackOp : uint8_t
+{
+    None = 0,
+    HeapCreate,
+    HeapRelease,
+    CreateRTV,
+    CreateSRV,
+    CreateUAV,
+    CopyDescriptors,
+    SetGraphicsRootTable,
+    SetComputeRootTable,
+    OMSetRenderTarget,
+    DrawInstanced,
+    DrawIndexedInstanced,
+    Dispatch,
+    ExecuteCommandLists,
+    Release,
+    Count
+};
+
+// Argument layout of each op
+//   HeapCreate            heap, cpuStart, gpuStart, numDescriptors | increment << 32      heapType set
+//   HeapRelease           heap
+//   CreateRTV/SRV/UAV     resource (0 when slot is cleared), cpuHandle, width, height | format << 32 | flags << 48
+//   CopyDescriptors       destCpuHandle, srcCpuHandle, count                              heapType set
+//   Set*RootTable         cmdList, gpuHandle, rootParameterIndex
+//   OMSetRenderTarget     cmdList, cpuHandle, renderTargetIndex
+//   Draw*/Dispatch        cmdList
+//   ExecuteCommandLists   queue, numCommandLists
+//   Release               resource
+struct ResTrackRecord
+{
+    ResTrackOp op = ResTrackOp::None;
+    uint8_t heapType = 0;
+    uint16_t reserved = 0;
+    uint32_t threadId = 0;
+    uint64_t timestamp = 0;
+    uint64_t args[4] = {};
+};
+
+static_assert(sizeof(ResTrackRecord) == 48, "ResTrackRecord layout is part of the capture format");
+
+struct ResTrackCaptureHeader
+{
+    static constexpr uint32_t Magic = 0x43545452; // "RTTC"
+    static constexpr uint32_t CurrentVersion = 1;
+
+    uint32_t magic = Magic;
+    uint32_t version = CurrentVersion;
+    uint32_t recordSize = sizeof(ResTrackRecord);
+    uint32_t reserved = 0;
+    uint64_t timerFrequency = 0;
+};
+
+class ResTrack_Capture
+{
+    inline static std::atomic<bool> _active { false };
+
+  public:
+    static bool IsActive() { return _active.load(std::memory_order_relaxed); }
+
+    static bool Start(const std::wstring& fileName);
+    static void Stop();
+
+    // Appends to calling thread's buffer, buffers are written to file when full, on thread exit and on Stop
+    static void Record(ResTrackOp op, uint64_t arg0, uint64_t arg1 = 0, uint64_t arg2 = 0, uint64_t arg3 = 0,
+                       uint8_t heapType = 0);
+};
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// Lock-free membership filter for resources the tracker holds state for (descriptor slots or captured hudless list).
+// Counting bloom filter with two counters per resource, false positives only send a Release call to the slow path.
+// Counters saturate and stay saturated, so a missing Remove can never make a tracked resource look untracked.
+class TrackedResourceFilter
+{
+    inline static constexpr size_t COUNTER_COUNT = 1 << 16;
+    inline static constexpr uint16_t SATURATED = UINT16_MAX;
+
+    inline static std::atomic<uint16_t> _counters[COUNTER_COUNT] {};
+
+    static void GetIndexes(const void* resource, size_t& first, size_t& second)
+    {
+        // Fibonacci hashing, takes two independent 16 bit windows from the high bits
+        auto hash = ((uint64_t) resource >> 4) * 0x9E3779B97F4A7C15ull;
+        first = (size_t) (hash >> 48);
+        second = (size_t) (hash >> 32) & (COUNTER_COUNT - 1);
+    }
+
+    static void Increment(std::atomic<uint16_t>& counter)
+    {
+        auto value = counter.load(std::memory_order_relaxed);
+
+        while (value != SATURATED && !counter.compare_exchange_weak(value, (uint16_t) (value + 1),
+                                                                    std::memory_order_release,
+                                                                    std::memory_order_relaxed))
+        {
+        }
+    }
+
+    static void Decrement(std::atomic<uint16_t>& counter)
+    {
+        auto value = counter.load(std::memory_order_relaxed);
+
+        while (value != SATURATED && value != 0 &&
+               !counter.compare_exchange_weak(value, (uint16_t) (value - 1), std::memory_order_release,
+                                              std::memory_order_relaxed))
+        {
+        }
+    }
+
+  public:
+    static void Add(const void* resource)
+    {
+        size_t first, second;
+        GetIndexes(resource, first, second);
+        Increment(_counters[first]);
+        Increment(_counters[second]);
+    }
+
+    static void Remove(const void* resource)
+    {
+        size_t first, second;
+        GetIndexes(resource, first, second);
+        Decrement(_counters[first]);
+        Decrement(_counters[second]);
+    }
+
+    static bool MayContain(const void* resource)
+    {
+        size_t first, second;
+        GetIndexes(resource, first, second);
+        return _counters[first].load(std::memory_order_acquire) != 0 &&
+               _counters[second].load(std::memory_order_acquire) != 0;
+    }
+};
@@ -1,10 +1,12 @@
 #include "ResTrack_dx12.h"
+#include "ResTrack_Capture.h"
 
 #include <Config.h>
 #include <State.h>
 #include <Util.h>
 
 #include <menu/menu_overlay_dx.h>
+#include <misc/HookProfiler.h>
 
 #include <algorithm>
 #include <future>
@@ -109,10 +111,44 @@ static PFN_OMSetRenderTargets o_OMSetRenderTargets = nullptr;
 static PFN_SetGraphicsRootDescriptorTable o_SetGraphicsRootDescriptorTable = nullptr;
 static PFN_SetComputeRootDescriptorTable o_SetComputeRootDescriptorTable = nullptr;
 
-static std::mutex _hudlessTrackMutex;
-static ankerl::unordered_dense::map<ID3D12GraphicsCommandList*,
-                                    ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo>>
-    fgPossibleHudless[BUFFER_COUNT];
+// Hudless candidates are appended to a per thread log for each frame slot and consumed by the
+// draw/dispatch hooks on the same thread. Command lists are recorded by one thread at a time, so
+// no locking or hash map inserts are needed while recording. Draws only mark their records consumed,
+// the log is never compacted while recording. ClearPossibleHudless bumps the slot epoch which drops
+// all threads' logs for that slot, with records of lists that never drew, on their next access.
+struct HudlessCandidate
+{
+    // nullptr once consumed by a draw
+    ID3D12GraphicsCommandList* cmdList = nullptr;
+    ResourceInfo info {};
+};
+
+struct HudlessCandidateLog
+{
+    UINT64 epoch = 0;
+
+    // Every record before this index is consumed
+    size_t consumed = 0;
+    std::vector<HudlessCandidate> records;
+};
+
+static std::atomic<UINT64> _hudlessLogEpoch[BUFFER_COUNT] = {};
+static thread_local HudlessCandidateLog _hudlessLogs[BUFFER_COUNT];
+
+static HudlessCandidateLog& GetHudlessLog(size_t fIndex)
+{
+    auto& log = _hudlessLogs[fIndex];
+    auto epoch = _hudlessLogEpoch[fIndex].load(std::memory_order_acquire);
+
+    if (log.epoch != epoch)
+    {
+        log.records.clear();
+        log.consumed = 0;
+        log.epoch = epoch;
+    }
+
+    return log;
+}
 
 // heaps section
 
@@ -133,7 +169,6 @@ struct HeapCacheTLS
 {
     unsigned genSeen = 0;
     HeapInfo* heapPtr = nullptr;
-    uint64_t heapVersion = 0;
 };
 
 static thread_local HeapCacheTLS cache;
@@ -146,6 +181,56 @@ static std::atomic<unsigned> gHeapGeneration { 1 };
 static thread_local HeapCacheTLS cacheGR;
 static thread_local HeapCacheTLS cacheCR;
 
+// Published heap range index, swapped as a whole under _heapCreationMutex
+static std::atomic<std::shared_ptr<const HeapRangeIndex>> _heapIndex { std::make_shared<HeapRangeIndex>() };
+
+// Per thread reference to the published index, refreshed when gHeapGeneration changes
+static thread_local std::shared_ptr<const HeapRangeIndex> _heapIndexTLS;
+static thread_local unsigned _heapIndexGenTLS = 0;
+
+static inline size_t HeapIndexSlot(UINT type) { return type == D3D12_DESCRIPTOR_HEAP_TYPE_RTV ? 1 : 0; }
+
+// Must be called while holding _heapCreationMutex
+static void RebuildHeapIndex()
+{
+    auto index = std::make_shared<HeapRangeIndex>();
+    index->byHeap.reserve(fgHeaps.size());
+
+    for (const auto& up : fgHeaps)
+    {
+        if (up == nullptr || !up->active)
+            continue;
+
+        index->cpu[HeapIndexSlot(up->type)].push_back({ up->cpuStart, up->cpuEnd, up.get() });
+
+        if (up->gpuStart != NULL)
+            index->gpu.push_back({ up->gpuStart, up->gpuEnd, up.get() });
+
+        index->byHeap[up->heap] = up.get();
+    }
+
+    auto byStart = [](const HeapRange& a, const HeapRange& b) { return a.start < b.start; };
+    std::sort(index->cpu[0].begin(), index->cpu[0].end(), byStart);
+    std::sort(index->cpu[1].begin(), index->cpu[1].end(), byStart);
+    std::sort(index->gpu.begin(), index->gpu.end(), byStart);
+
+    _heapIndex.store(std::move(index), std::memory_order_release);
+
+    // invalidate caches
+    gHeapGeneration.fetch_add(1, std::memory_order_release);
+}
+
+static const HeapRangeIndex* GetHeapIndex(unsigned currentGen)
+{
+    if (_heapIndexGenTLS != currentGen || _heapIndexTLS == nullptr)
+    {
+        _heapIndexTLS = _heapIndex.load(std::memory_order_acquire);
+        _heapIndexGenTLS = currentGen;
+    }
+
+    return _heapIndexTLS.get();
+}
+
 bool ResTrack_Dx12::CheckResource(ID3D12Resource* resource)
 {
     if (State::Instance().isShuttingDown)
@@ -259,187 +344,135 @@ void ResTrack_Dx12::ResourceBarrier(ID3D12GraphicsCommandList* InCommandList, ID
 
 #pragma endregion
 
+#pragma region Capture helpers
+
+static void CaptureCreateView(ResTrackOp op, ID3D12Resource* resource, SIZE_T cpuHandle)
+{
+    if (!ResTrack_Capture::IsActive())
+        return;
+
+    if (resource == nullptr)
+    {
+        ResTrack_Capture::Record(op, 0, cpuHandle);
+        return;
+    }
+
+    auto desc = resource->GetDesc();
+    auto packed = (uint64_t) desc.Height | ((uint64_t) desc.Format << 32) | ((uint64_t) desc.Flags << 48);
+    ResTrack_Capture::Record(op, (uint64_t) resource, cpuHandle, desc.Width, packed);
+}
+
+#pragma endregion
+
 #pragma region Heap helpers
 
 SIZE_T ResTrack_Dx12::GetGPUHandle(ID3D12Device* This, SIZE_T cpuHandle, D3D12_DESCRIPTOR_HEAP_TYPE type)
 {
-    size_t count = fgHeaps.size();
-    for (size_t i = 0; i < count; i++)
-    {
-        auto val = fgHeaps[i].get();
-        if (fgHeaps[i] != nullptr && val->active && val->cpuStart <= cpuHandle && val->cpuEnd > cpuHandle &&
-            val->gpuStart != 0)
-        {
-            auto incSize = This->GetDescriptorHandleIncrementSize(type);
-            auto addr = cpuHandle - val->cpuStart;
-            auto index = addr / incSize;
-            auto gpuAddr = val->gpuStart + (index * incSize);
+    HeapReclaimer::Guard guard;
+    auto index = GetHeapIndex(gHeapGeneration.load(std::memory_order_acquire));
+    auto val = HeapRangeIndex::Find(index->cpu[HeapIndexSlot(type)], cpuHandle);
 
-            return gpuAddr;
-        }
-    }
+    if (val == nullptr || val->gpuStart == 0)
+        return NULL;
+
+    auto incSize = This->GetDescriptorHandleIncrementSize(type);
+    auto addr = cpuHandle - val->cpuStart;
+    auto slot = addr / incSize;
 
-    return NULL;
+    return val->gpuStart + (slot * incSize);
 }
 
 SIZE_T ResTrack_Dx12::GetCPUHandle(ID3D12Device* This, SIZE_T gpuHandle, D3D12_DESCRIPTOR_HEAP_TYPE type)
 {
-    size_t count = fgHeaps.size();
-    for (size_t i = 0; i < count; i++)
-    {
-        auto val = fgHeaps[i].get();
-        if (fgHeaps[i] != nullptr && val->active && val->gpuStart <= gpuHandle && val->gpuEnd > gpuHandle &&
-            val->cpuStart != 0)
-        {
-            auto incSize = This->GetDescriptorHandleIncrementSize(type);
-            auto addr = gpuHandle - val->gpuStart;
-            auto index = addr / incSize;
-            auto cpuAddr = val->cpuStart + (index * incSize);
+    HeapReclaimer::Guard guard;
+    auto index = GetHeapIndex(gHeapGeneration.load(std::memory_order_acquire));
+    auto val = HeapRangeIndex::Find(index->gpu, gpuHandle);
 
-            return cpuAddr;
-        }
+    if (val == nullptr || val->cpuStart == 0)
+        return NULL;
+
+    auto incSize = This->GetDescriptorHandleIncrementSize(type);
+    auto addr = gpuHandle - val->gpuStart;
+    auto slot = addr / incSize;
+
+    return val->cpuStart + (slot * incSize);
+}
+
+// Heaps are only unlinked together with a generation bump and freed after every reader left its epoch,
+// so a cached heap from the current generation is always alive and active while inside a HeapReclaimer::Guard
+static inline bool IsCpuCacheHit(const HeapCacheTLS& tls, unsigned currentGen, SIZE_T cpuHandle)
+{
+    return tls.genSeen == currentGen && tls.heapPtr != nullptr && tls.heapPtr->cpuStart <= cpuHandle &&
+           cpuHandle < tls.heapPtr->cpuEnd;
+}
+
+static inline bool IsGpuCacheHit(const HeapCacheTLS& tls, unsigned currentGen, SIZE_T gpuHandle)
+{
+    return tls.genSeen == currentGen && tls.heapPtr != nullptr && tls.heapPtr->gpuStart <= gpuHandle &&
+           gpuHandle < tls.heapPtr->gpuEnd;
+}
+
+static inline HeapInfo* UpdateCache(HeapCacheTLS& tls, unsigned currentGen, HeapInfo* heap)
+{
+    if (heap == nullptr)
+    {
+        tls.heapPtr = nullptr;
+        return nullptr;
     }
 
-    return NULL;
+    tls.genSeen = currentGen;
+    tls.heapPtr = heap;
+    return heap;
 }
 
 HeapInfo* ResTrack_Dx12::GetHeapByCpuHandleCBV(SIZE_T cpuHandle)
 {
     unsigned currentGen = gHeapGeneration.load(std::memory_order_acquire);
-    if (cacheCBV.genSeen == currentGen && cacheCBV.heapPtr != nullptr &&
-        cacheCBV.heapPtr->version == cacheCBV.heapVersion && cacheCBV.heapPtr->active &&
-        cacheCBV.heapPtr->cpuStart <= cpuHandle && cpuHandle < cacheCBV.heapPtr->cpuEnd)
-    {
+    if (IsCpuCacheHit(cacheCBV, currentGen, cpuHandle))
         return cacheCBV.heapPtr;
-    }
-
-    size_t count = fgHeaps.size();
-    for (size_t i = 0; i < count; i++)
-    {
-        if (fgHeaps[i] != nullptr && fgHeaps[i]->active && fgHeaps[i]->cpuStart <= cpuHandle &&
-            cpuHandle < fgHeaps[i]->cpuEnd)
-        {
-            cacheCBV.genSeen = currentGen;
-            cacheCBV.heapPtr = fgHeaps[i].get();
-            cacheCBV.heapVersion = cacheCBV.heapPtr->version;
-            return cacheCBV.heapPtr;
-        }
-    }
 
-    cacheCBV.heapVersion = 0;
-    cacheCBV.heapPtr = nullptr;
-    return nullptr;
+    auto index = GetHeapIndex(currentGen);
+    return UpdateCache(cacheCBV, currentGen, HeapRangeIndex::Find(index->cpu[0], cpuHandle));
 }
 
 HeapInfo* ResTrack_Dx12::GetHeapByCpuHandleRTV(SIZE_T cpuHandle)
 {
     unsigned currentGen = gHeapGeneration.load(std::memory_order_acquire);
-    if (cacheRTV.genSeen == currentGen && cacheRTV.heapPtr != nullptr &&
-        cacheRTV.heapPtr->version == cacheRTV.heapVersion && cacheRTV.heapPtr->active &&
-        cacheRTV.heapPtr->cpuStart <= cpuHandle && cpuHandle < cacheRTV.heapPtr->cpuEnd)
-    {
+    if (IsCpuCacheHit(cacheRTV, currentGen, cpuHandle))
         return cacheRTV.heapPtr;
-    }
 
-    size_t count = fgHeaps.size();
-    for (size_t i = 0; i < count; i++)
-    {
-        if (fgHeaps[i] != nullptr && fgHeaps[i]->active && fgHeaps[i]->cpuStart <= cpuHandle &&
-            cpuHandle < fgHeaps[i]->cpuEnd)
-        {
-            cacheRTV.genSeen = currentGen;
-            cacheRTV.heapPtr = fgHeaps[i].get();
-            cacheRTV.heapVersion = cacheRTV.heapPtr->version;
-            return cacheRTV.heapPtr;
-        }
-    }
-
-    cacheRTV.heapVersion = 0;
-    cacheRTV.heapPtr = nullptr;
-    return nullptr;
+    auto index = GetHeapIndex(currentGen);
+    return UpdateCache(cacheRTV, currentGen, HeapRangeIndex::Find(index->cpu[1], cpuHandle));
 }
 
 HeapInfo* ResTrack_Dx12::GetHeapByCpuHandleSRV(SIZE_T cpuHandle)
 {
     unsigned currentGen = gHeapGeneration.load(std::memory_order_acquire);
-    if (cacheSRV.genSeen == currentGen && cacheSRV.heapPtr != nullptr &&
-        cacheSRV.heapPtr->version == cacheSRV.heapVersion && cacheSRV.heapPtr->active &&
-        cacheSRV.heapPtr->cpuStart <= cpuHandle && cpuHandle < cacheSRV.heapPtr->cpuEnd)
-    {
+    if (IsCpuCacheHit(cacheSRV, currentGen, cpuHandle))
         return cacheSRV.heapPtr;
-    }
-
-    size_t count = fgHeaps.size();
-    for (size_t i = 0; i < count; i++)
-    {
-        if (fgHeaps[i] != nullptr && fgHeaps[i]->active && fgHeaps[i]->cpuStart <= cpuHandle &&
-            cpuHandle < fgHeaps[i]->cpuEnd)
-        {
-            cacheSRV.genSeen = currentGen;
-            cacheSRV.heapPtr = fgHeaps[i].get();
-            cacheSRV.heapVersion = cacheSRV.heapPtr->version;
-            return cacheSRV.heapPtr;
-        }
-    }
 
-    cacheSRV.heapVersion = 0;
-    cacheSRV.heapPtr = nullptr;
-    return nullptr;
+    auto index = GetHeapIndex(currentGen);
+    return UpdateCache(cacheSRV, currentGen, HeapRangeIndex::Find(index->cpu[0], cpuHandle));
 }
 
 HeapInfo* ResTrack_Dx12::GetHeapByCpuHandleUAV(SIZE_T cpuHandle)
 {
     unsigned currentGen = gHeapGeneration.load(std::memory_order_acquire);
-    if (cacheUAV.genSeen == currentGen && cacheUAV.heapPtr != nullptr &&
-        cacheUAV.heapPtr->version == cacheUAV.heapVersion && cacheUAV.heapPtr->active &&
-        cacheUAV.heapPtr->cpuStart <= cpuHandle && cpuHandle < cacheUAV.heapPtr->cpuEnd)
-    {
+    if (IsCpuCacheHit(cacheUAV, currentGen, cpuHandle))
         return cacheUAV.heapPtr;
-    }
-
-    size_t count = fgHeaps.size();
-    for (size_t i = 0; i < count; i++)
-    {
-        if (fgHeaps[i] != nullptr && fgHeaps[i]->active && fgHeaps[i]->cpuStart <= cpuHandle &&
-            cpuHandle < fgHeaps[i]->cpuEnd)
-        {
-            cacheUAV.genSeen = currentGen;
-            cacheUAV.heapPtr = fgHeaps[i].get();
-            cacheUAV.heapVersion = cacheUAV.heapPtr->version;
-            return cacheUAV.heapPtr;
-        }
-    }
 
-    cacheUAV.heapVersion = 0;
-    cacheUAV.heapPtr = nullptr;
-    return nullptr;
+    auto index = GetHeapIndex(currentGen);
+    return UpdateCache(cacheUAV, currentGen, HeapRangeIndex::Find(index->cpu[0], cpuHandle));
 }
 
 HeapInfo* ResTrack_Dx12::GetHeapByCpuHandle(SIZE_T cpuHandle)
 {
     unsigned currentGen = gHeapGeneration.load(std::memory_order_acquire);
-    if (cache.genSeen == currentGen && cache.heapPtr != nullptr && cache.heapPtr->version == cache.heapVersion &&
-        cache.heapPtr->active && cache.heapPtr->cpuStart <= cpuHandle && cpuHandle < cache.heapPtr->cpuEnd)
-    {
+    if (IsCpuCacheHit(cache, currentGen, cpuHandle))
         return cache.heapPtr;
-    }
-
-    size_t count = fgHeaps.size();
-    for (size_t i = 0; i < count; i++)
-    {
-        if (fgHeaps[i] != nullptr && fgHeaps[i]->active && fgHeaps[i]->cpuStart <= cpuHandle &&
-            cpuHandle < fgHeaps[i]->cpuEnd)
-        {
-            cache.genSeen = currentGen;
-            cache.heapPtr = fgHeaps[i].get();
-            cache.heapVersion = cache.heapPtr->version;
-            return cache.heapPtr;
-        }
-    }
 
-    cache.heapVersion = 0;
-    cache.heapPtr = nullptr;
-    return nullptr;
+    auto index = GetHeapIndex(currentGen);
+    return UpdateCache(cache, currentGen, index->FindByCpuHandle(cpuHandle));
 }
 
 HeapInfo* ResTrack_Dx12::GetHeapByGpuHandleGR(SIZE_T gpuHandle)
@@ -448,29 +481,11 @@ HeapInfo* ResTrack_Dx12::GetHeapByGpuHandleGR(SIZE_T gpuHandle)
         return nullptr;
 
     unsigned currentGen = gHeapGeneration.load(std::memory_order_acquire);
-    if (cacheGR.genSeen == currentGen && cacheGR.heapPtr != nullptr &&
-        cacheGR.heapPtr->version == cacheGR.heapVersion && cacheGR.heapPtr->active &&
-        cacheGR.heapPtr->gpuStart <= gpuHandle && gpuHandle < cacheGR.heapPtr->gpuEnd)
-    {
+    if (IsGpuCacheHit(cacheGR, currentGen, gpuHandle))
         return cacheGR.heapPtr;
-    }
-
-    size_t count = fgHeaps.size();
-    for (size_t i = 0; i < count; i++)
-    {
-        if (fgHeaps[i] != nullptr && fgHeaps[i]->active && fgHeaps[i]->gpuStart <= gpuHandle &&
-            gpuHandle < fgHeaps[i]->gpuEnd)
-        {
-            cacheGR.genSeen = currentGen;
-            cacheGR.heapPtr = fgHeaps[i].get();
-            cacheGR.heapVersion = cacheGR.heapPtr->version;
-            return cacheGR.heapPtr;
-        }
-    }
 
-    cacheGR.heapVersion = 0;
-    cacheGR.heapPtr = nullptr;
-    return nullptr;
+    auto index = GetHeapIndex(currentGen);
+    return UpdateCache(cacheGR, currentGen, HeapRangeIndex::Find(index->gpu, gpuHandle));
 }
 
 HeapInfo* ResTrack_Dx12::GetHeapByGpuHandleCR(SIZE_T gpuHandle)
@@ -479,29 +494,11 @@ HeapInfo* ResTrack_Dx12::GetHeapByGpuHandleCR(SIZE_T gpuHandle)
         return nullptr;
 
     unsigned currentGen = gHeapGeneration.load(std::memory_order_acquire);
-    if (cacheCR.genSeen == currentGen && cacheCR.heapPtr != nullptr &&
-        cacheCR.heapPtr->version == cacheCR.heapVersion && cacheCR.heapPtr->active &&
-        cacheCR.heapPtr->gpuStart <= gpuHandle && gpuHandle < cacheCR.heapPtr->gpuEnd)
-    {
+    if (IsGpuCacheHit(cacheCR, currentGen, gpuHandle))
         return cacheCR.heapPtr;
-    }
-
-    size_t count = fgHeaps.size();
-    for (size_t i = 0; i < count; i++)
-    {
-        if (fgHeaps[i] != nullptr && fgHeaps[i]->active && fgHeaps[i]->gpuStart <= gpuHandle &&
-            gpuHandle < fgHeaps[i]->gpuEnd)
-        {
-            cacheCR.genSeen = currentGen;
-            cacheCR.heapPtr = fgHeaps[i].get();
-            cacheCR.heapVersion = cacheCR.heapPtr->version;
-            return cacheCR.heapPtr;
-        }
-    }
 
-    cacheCR.heapVersion = 0;
-    cacheCR.heapPtr = nullptr;
-    return nullptr;
+    auto index = GetHeapIndex(currentGen);
+    return UpdateCache(cacheCR, currentGen, HeapRangeIndex::Find(index->gpu, gpuHandle));
 }
 
 #pragma endregion
@@ -562,6 +559,78 @@ bool ResTrack_Dx12::IsHudFixActive()
     return true;
 }
 
+void ResTrack_Dx12::AddHudlessCandidate(ID3D12GraphicsCommandList* cmdList, ResourceInfo* resource)
+{
+    auto fIndex = Hudfix_Dx12::ActivePresentFrame() % BUFFER_COUNT;
+    auto& log = GetHudlessLog(fIndex);
+
+    if (log.records.capacity() == 0)
+        log.records.reserve(256);
+
+    log.records.push_back({ cmdList, *resource });
+}
+
+void ResTrack_Dx12::CheckHudlessCandidates(ID3D12GraphicsCommandList* cmdList, UINT dispatcher, bool skipChecks)
+{
+    static thread_local std::vector<ResourceInfo> pending;
+
+    auto fIndex = Hudfix_Dx12::ActivePresentFrame() % BUFFER_COUNT;
+    auto& log = GetHudlessLog(fIndex);
+
+    auto& records = log.records;
+
+    // if can't find output skip
+    if (log.consumed == records.size())
+    {
+        LOG_DEBUG_ONLY("Early exit");
+        return;
+    }
+
+    // Take out this command list's records, later binds of the same resource win
+    pending.clear();
+
+    for (size_t i = log.consumed; i < records.size(); i++)
+    {
+        if (records[i].cmdList != cmdList)
+            continue;
+
+        records[i].cmdList = nullptr;
+
+        auto buffer = records[i].info.buffer;
+        auto it = std::find_if(pending.begin(), pending.end(),
+                               [buffer](const ResourceInfo& val) { return val.buffer == buffer; });
+
+        if (it != pending.end())
+            *it = records[i].info;
+        else
+            pending.push_back(records[i].info);
+    }
+
+    // Only records of lists still recording on this thread stay in front of the next scan
+    while (log.consumed < records.size() && records[log.consumed].cmdList == nullptr)
+        log.consumed++;
+
+    if (log.consumed == records.size())
+    {
+        records.clear();
+        log.consumed = 0;
+    }
+
+    // if this command list does not have entries skip
+    if (pending.empty() || skipChecks || cmdList == MenuOverlayDx::MenuCommandList())
+        return;
+
+    for (auto& val : pending)
+    {
+        auto lock = HookProfiler::TimedLock(_drawMutex);
+
+        val.captureInfo |= dispatcher;
+
+        if (Hudfix_Dx12::CheckForHudless(cmdList, &val, val.state))
+            break;
+    }
+}
+
 #pragma endregion
 
 #pragma region Resource input hooks
@@ -570,6 +639,8 @@ void ResTrack_Dx12::hkCreateRenderTargetView(ID3D12Device* This, ID3D12Resource*
                                              D3D12_RENDER_TARGET_VIEW_DESC* pDesc,
                                              D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor)
 {
+    HookProfiler::Scope profile(ProfiledHook::RT_CreateRenderTargetView);
+
     // force hdr for swapchain buffer
     if (pResource != nullptr && pDesc != nullptr && Config::Instance()->ForceHDR.value_or_default())
     {
@@ -587,14 +658,18 @@ void ResTrack_Dx12::hkCreateRenderTargetView(ID3D12Device* This, ID3D12Resource*
         }
     }
 
-    o_CreateRenderTargetView(This, pResource, pDesc, DestDescriptor);
+    profile.Call(o_CreateRenderTargetView, This, pResource, pDesc, DestDescriptor);
 
     if (Config::Instance()->FGHudfixDisableRTV.value_or_default())
         return;
 
+    HeapReclaimer::Guard guard;
+
     if (pResource == nullptr || pDesc == nullptr || pDesc->ViewDimension != D3D12_RTV_DIMENSION_TEXTURE2D ||
         !CheckResource(pResource))
     {
+        CaptureCreateView(ResTrackOp::CreateRTV, nullptr, DestDescriptor.ptr);
+
         auto heap = GetHeapByCpuHandleRTV(DestDescriptor.ptr);
 
         if (heap != nullptr)
@@ -606,6 +681,8 @@ void ResTrack_Dx12::hkCreateRenderTargetView(ID3D12Device* This, ID3D12Resource*
     // if (!CheckResource(pResource))
     //     return;
 
+    CaptureCreateView(ResTrackOp::CreateRTV, pResource, DestDescriptor.ptr);
+
     auto heap = GetHeapByCpuHandleRTV(DestDescriptor.ptr);
     if (heap != nullptr)
     {
@@ -625,6 +702,8 @@ void ResTrack_Dx12::hkCreateShaderResourceView(ID3D12Device* This, ID3D12Resourc
                                                D3D12_SHADER_RESOURCE_VIEW_DESC* pDesc,
                                                D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor)
 {
+    HookProfiler::Scope profile(ProfiledHook::RT_CreateShaderResourceView);
+
     // force hdr for swapchain buffer
     if (pResource != nullptr && pDesc != nullptr && Config::Instance()->ForceHDR.value_or_default())
     {
@@ -642,14 +721,18 @@ void ResTrack_Dx12::hkCreateShaderResourceView(ID3D12Device* This, ID3D12Resourc
         }
     }
 
-    o_CreateShaderResourceView(This, pResource, pDesc, DestDescriptor);
+    profile.Call(o_CreateShaderResourceView, This, pResource, pDesc, DestDescriptor);
 
     if (Config::Instance()->FGHudfixDisableSRV.value_or_default())
         return;
 
+    HeapReclaimer::Guard guard;
+
     if (pResource == nullptr || pDesc == nullptr || pDesc->ViewDimension != D3D12_SRV_DIMENSION_TEXTURE2D ||
         !CheckResource(pResource))
     {
+        CaptureCreateView(ResTrackOp::CreateSRV, nullptr, DestDescriptor.ptr);
+
         auto heap = GetHeapByCpuHandleSRV(DestDescriptor.ptr);
 
         if (heap != nullptr)
@@ -661,6 +744,8 @@ void ResTrack_Dx12::hkCreateShaderResourceView(ID3D12Device* This, ID3D12Resourc
     // if (!CheckResource(pResource))
     //     return;
 
+    CaptureCreateView(ResTrackOp::CreateSRV, pResource, DestDescriptor.ptr);
+
     auto heap = GetHeapByCpuHandleSRV(DestDescriptor.ptr);
     if (heap != nullptr)
     {
@@ -681,6 +766,8 @@ void ResTrack_Dx12::hkCreateUnorderedAccessView(ID3D12Device* This, ID3D12Resour
                                                 D3D12_UNORDERED_ACCESS_VIEW_DESC* pDesc,
                                                 D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor)
 {
+    HookProfiler::Scope profile(ProfiledHook::RT_CreateUnorderedAccessView);
+
     if (pResource != nullptr && pDesc != nullptr && Config::Instance()->ForceHDR.value_or_default())
     {
         for (size_t i = 0; i < State::Instance().SCbuffers.size(); i++)
@@ -697,14 +784,18 @@ void ResTrack_Dx12::hkCreateUnorderedAccessView(ID3D12Device* This, ID3D12Resour
         }
     }
 
-    o_CreateUnorderedAccessView(This, pResource, pCounterResource, pDesc, DestDescriptor);
+    profile.Call(o_CreateUnorderedAccessView, This, pResource, pCounterResource, pDesc, DestDescriptor);
 
     if (Config::Instance()->FGHudfixDisableUAV.value_or_default())
         return;
 
+    HeapReclaimer::Guard guard;
+
     if (pResource == nullptr || pDesc == nullptr || pDesc->ViewDimension != D3D12_UAV_DIMENSION_TEXTURE2D ||
         !CheckResource(pResource))
     {
+        CaptureCreateView(ResTrackOp::CreateUAV, nullptr, DestDescriptor.ptr);
+
         auto heap = GetHeapByCpuHandleUAV(DestDescriptor.ptr);
 
         if (heap != nullptr)
@@ -716,6 +807,8 @@ void ResTrack_Dx12::hkCreateUnorderedAccessView(ID3D12Device* This, ID3D12Resour
     // if (!CheckResource(pResource))
     //     return;
 
+    CaptureCreateView(ResTrackOp::CreateUAV, pResource, DestDescriptor.ptr);
+
     auto heap = GetHeapByCpuHandleUAV(DestDescriptor.ptr);
     if (heap != nullptr)
     {
@@ -736,8 +829,17 @@ void ResTrack_Dx12::hkCreateUnorderedAccessView(ID3D12Device* This, ID3D12Resour
 void ResTrack_Dx12::hkExecuteCommandLists(ID3D12CommandQueue* This, UINT NumCommandLists,
                                           ID3D12CommandList* const* ppCommandLists)
 {
+    HookProfiler::Scope profile(ProfiledHook::RT_ExecuteCommandLists);
+
+    if (ResTrack_Capture::IsActive())
+        ResTrack_Capture::Record(ResTrackOp::ExecuteCommandLists, (uint64_t) This, NumCommandLists);
+
     auto fg = State::Instance().currentFG;
 
+    // Sources the snapshot queue transitioned can't be used before their copies are done
+    if (fg != nullptr)
+        fg->WaitForSnapshots(This);
+
     if (fg != nullptr && fg->IsActive() && !fg->IsPaused())
     {
         LOG_TRACK("NumCommandLists: {}", NumCommandLists);
@@ -747,7 +849,7 @@ void ResTrack_Dx12::hkExecuteCommandLists(ID3D12CommandQueue* This, UINT NumComm
 
         do
         {
-            std::lock_guard<std::mutex> lock2(_resourceCommandListMutex);
+            auto lock2 = HookProfiler::TimedLock(_resourceCommandListMutex);
 
             if (!_notFoundCmdLists.empty())
             {
@@ -792,87 +894,102 @@ void ResTrack_Dx12::hkExecuteCommandLists(ID3D12CommandQueue* This, UINT NumComm
 
         if (!found.empty())
         {
-            o_ExecuteCommandLists(This, NumCommandLists, ppCommandLists);
+            profile.Call(o_ExecuteCommandLists, This, NumCommandLists, ppCommandLists);
 
             for (size_t i = 0; i < found.size(); i++)
             {
                 fg->SetCommandQueue(found[i], This);
             }
 
+            fg->SubmitSnapshots(This, NumCommandLists, ppCommandLists);
             return;
         }
     }
 
     LOG_TRACK("Done NumCommandLists: {}", NumCommandLists);
 
-    o_ExecuteCommandLists(This, NumCommandLists, ppCommandLists);
+    profile.Call(o_ExecuteCommandLists, This, NumCommandLists, ppCommandLists);
+
+    if (fg != nullptr)
+        fg->SubmitSnapshots(This, NumCommandLists, ppCommandLists);
 }
 
 #pragma region Heap hooks
 
 static ULONG STDMETHODCALLTYPE hkHeapRelease(ID3D12DescriptorHeap* This)
 {
+    HookProfiler::Scope profile(ProfiledHook::RT_HeapRelease);
+
     if (State::Instance().isShuttingDown)
-        return o_HeapRelease(This);
+        return profile.Call(o_HeapRelease, This);
 
-    size_t count = fgHeaps.size();
-    for (size_t i = 0; i < count; i++)
-    {
-        auto& up = fgHeaps[i];
+    HeapReclaimer::Guard guard;
+    auto index = GetHeapIndex(gHeapGeneration.load(std::memory_order_acquire));
+    auto found = index->byHeap.find(This);
 
-        if (up == nullptr || up->heap != This || !up->active)
-            continue;
+    if (found != index->byHeap.end())
+    {
+        auto up = found->second;
 
         This->AddRef();
-        if (o_HeapRelease(This) <= 1)
+        if (profile.Call(o_HeapRelease, This) <= 1)
         {
-#ifdef USE_SPINLOCK_MUTEX_FOR_HEAP_CREATION
-            std::lock_guard<SpinLock> lock(_heapCreationMutex);
-#else
-            std::lock_guard<std::mutex> lock(_heapCreationMutex);
-#endif
+            auto lock = HookProfiler::TimedLock(_heapCreationMutex);
+
+            if (!up->active)
+                return profile.Call(o_HeapRelease, This);
 
             up->active = false;
 
+            if (ResTrack_Capture::IsActive())
+                ResTrack_Capture::Record(ResTrackOp::HeapRelease, (uint64_t) This);
+
             LOG_INFO("Heap released: {:X}", (size_t) This);
 
             // detach all slots from _trackedResources
+            for (UINT j = 0; j < up->numDescriptors; ++j)
             {
-                std::scoped_lock lk(_trackedResourcesMutex);
+                auto& slot = up->buffers[j];
 
-                for (UINT j = 0; j < up->numDescriptors; ++j)
-                {
-                    auto& slot = up->info[j];
+                if (slot == nullptr)
+                    continue;
 
-                    if (slot.buffer == nullptr)
-                        continue;
+                _trackedResources.Detach(slot, &slot, &up->owners[j]);
 
-                    if (auto it = _trackedResources.find(slot.buffer); it != _trackedResources.end())
-                    {
-                        auto& vec = it->second;
-                        vec.erase(std::remove(vec.begin(), vec.end(), &slot), vec.end());
-                        if (vec.empty())
-                            _trackedResources.erase(it);
-                    }
+                slot = nullptr;
+            }
 
-                    slot.buffer = nullptr;
-                    slot.lastUsedFrame = 0;
-                }
+            // Unlink from owner list and published index, then hand over to reclaimer
+            auto owner = std::find_if(fgHeaps.begin(), fgHeaps.end(),
+                                      [up](const std::unique_ptr<HeapInfo>& heap) { return heap.get() == up; });
+
+            if (owner != fgHeaps.end())
+            {
+                auto retired = std::move(*owner);
+                *owner = std::move(fgHeaps.back());
+                fgHeaps.pop_back();
+
+                RebuildHeapIndex();
+                HeapReclaimer::Retire(std::move(retired));
+            }
+            else
+            {
+                RebuildHeapIndex();
             }
 
-            gHeapGeneration.fetch_add(1, std::memory_order_release); // invalidate caches
+            HeapReclaimer::Collect();
         }
-
-        break;
     }
 
-    return o_HeapRelease(This);
+    return profile.Call(o_HeapRelease, This);
 }
 
 HRESULT ResTrack_Dx12::hkCreateDescriptorHeap(ID3D12Device* This, D3D12_DESCRIPTOR_HEAP_DESC* pDescriptorHeapDesc,
                                               REFIID riid, void** ppvHeap)
 {
-    auto result = o_CreateDescriptorHeap(This, pDescriptorHeapDesc, riid, ppvHeap);
+    HookProfiler::Scope profile(ProfiledHook::RT_CreateDescriptorHeap);
+
+    auto result = profile.Call(o_CreateDescriptorHeap, This, pDescriptorHeapDesc, riid, ppvHeap);
 
     if (State::Instance().skipHeapCapture)
         return result;
@@ -904,41 +1021,24 @@ HRESULT ResTrack_Dx12::hkCreateDescriptorHeap(ID3D12Device* This, D3D12_DESCRIPT
         LOG_TRACE("Heap: {:X}, Heap type: {}, Cpu: {}-{}, Gpu: {}-{}, Desc count: {}", (size_t) *ppvHeap, type,
                   cpuStart, cpuEnd, gpuStart, gpuEnd, numDescriptors);
         {
-#ifdef USE_SPINLOCK_MUTEX_FOR_HEAP_CREATION
-            std::lock_guard<SpinLock> lock(_heapCreationMutex);
-#else
-            std::lock_guard<std::mutex> lock(_heapCreationMutex);
-#endif
-            size_t count = fgHeaps.size();
-            bool foundEmpty = false;
-            for (size_t i = 0; i < count; i++)
-            {
-                if (fgHeaps[i] != nullptr && !fgHeaps[i]->active)
-                {
+            auto lock = HookProfiler::TimedLock(_heapCreationMutex);
+            // Released heaps are removed from fgHeaps, so it only holds live heaps
+            if (fgHeaps.capacity() == fgHeaps.size())
+                fgHeaps.reserve(fgHeaps.size() + 65536);
 
-                    fgHeaps[i].reset();
-                    fgHeaps[i] = std::make_unique<HeapInfo>(heap, cpuStart, cpuEnd, gpuStart, gpuEnd, numDescriptors,
-                                                            increment, type);
+            fgHeaps.push_back(std::make_unique<HeapInfo>(heap, cpuStart, cpuEnd, gpuStart, gpuEnd, numDescriptors,
+                                                         increment, type));
 
-                    gHeapGeneration.fetch_add(1, std::memory_order_release);
-                    foundEmpty = true;
-                    LOG_DEBUG("Reusing empty heap slot: {}", i);
-                    break;
-                }
-            }
+            RebuildHeapIndex();
+            HeapReclaimer::Collect();
 
-            if (!foundEmpty)
+            if (ResTrack_Capture::IsActive())
             {
-                // Reallocate vector if needed
-                if (fgHeaps.capacity() == fgHeaps.size())
-                    fgHeaps.reserve(fgHeaps.size() + 65536);
-
-                fgHeaps.push_back(std::make_unique<HeapInfo>(heap, cpuStart, cpuEnd, gpuStart, gpuEnd, numDescriptors,
-                                                             increment, type));
-
-                gHeapGeneration.fetch_add(1, std::memory_order_release);
-                LOG_DEBUG("Adding new heap slot: {}", fgHeaps.size() - 1);
+                ResTrack_Capture::Record(ResTrackOp::HeapCreate, (uint64_t) heap, cpuStart, gpuStart,
+                                         numDescriptors | ((uint64_t) increment << 32), 0, (uint8_t) type);
             }
+
+            LOG_DEBUG("Added heap, live: {}, waiting reclaim: {}", fgHeaps.size(), HeapReclaimer::RetiredCount());
         }
     }
     else
@@ -956,35 +1056,46 @@ HRESULT ResTrack_Dx12::hkCreateDescriptorHeap(ID3D12Device* This, D3D12_DESCRIPT
 
 ULONG ResTrack_Dx12::hkRelease(ID3D12Resource* This)
 {
+    HookProfiler::Scope profile(ProfiledHook::RT_Release);
+
     if (State::Instance().isShuttingDown)
-        return o_Release(This);
+        return profile.Call(o_Release, This);
 
-    std::vector<ResourceInfo*> toClean;
+    // Most releases are for resources which were never tracked, skip locking and map lookups for them
+    if (!TrackedResourceFilter::MayContain(This))
+        return profile.Call(o_Release, This);
+
+    // Slots point into HeapInfo buffers, keep their heaps alive until cleanup is done
+    HeapReclaimer::Guard guard;
+
+    std::vector<ID3D12Resource**> toClean;
     {
-        std::lock_guard lock(_trackedResourcesMutex);
+        auto& shard = _trackedResources.GetShard(This);
+        auto lock = HookProfiler::TimedLock(shard.mutex);
 
         This->AddRef();
-        auto refCount = o_Release(This);
+        auto refCount = profile.Call(o_Release, This);
 
-        if (refCount <= 1 && _trackedResources.contains(This))
+        if (refCount <= 1)
         {
-            toClean = _trackedResources[This]; // Copy vector
-            _trackedResources.erase(This);
+            if (ResTrack_Capture::IsActive())
+                ResTrack_Capture::Record(ResTrackOp::Release, (uint64_t) This);
+
+            TrackedResourceIndex::TakeLocked(shard, This, toClean);
         }
     }
 
     // Clean up outside lock
-    for (auto* info : toClean)
+    for (auto* slot : toClean)
     {
-        if (info->buffer == This)
-        {
-            info->buffer = nullptr;
-            info->lastUsedFrame = 0;
-        }
+        if (*slot == This)
+            *slot = nullptr;
     }
 
-    State::Instance().CapturedHudlesses.erase(This);
-    return o_Release(This);
+    if (State::Instance().CapturedHudlesses.erase(This) > 0)
+        TrackedResourceFilter::Remove(This);
+
+    return profile.Call(o_Release, This);
 }
 
 void ResTrack_Dx12::hkCopyDescriptors(ID3D12Device* This, UINT NumDestDescriptorRanges,
@@ -993,8 +1104,11 @@ void ResTrack_Dx12::hkCopyDescriptors(ID3D12Device* This, UINT NumDestDescriptor
                                       D3D12_CPU_DESCRIPTOR_HANDLE* pSrcDescriptorRangeStarts,
                                       UINT* pSrcDescriptorRangeSizes, D3D12_DESCRIPTOR_HEAP_TYPE DescriptorHeapsType)
 {
-    o_CopyDescriptors(This, NumDestDescriptorRanges, pDestDescriptorRangeStarts, pDestDescriptorRangeSizes,
-                      NumSrcDescriptorRanges, pSrcDescriptorRangeStarts, pSrcDescriptorRangeSizes, DescriptorHeapsType);
+    HookProfiler::Scope profile(ProfiledHook::RT_CopyDescriptors);
+
+    profile.Call(o_CopyDescriptors, This, NumDestDescriptorRanges, pDestDescriptorRangeStarts,
+                 pDestDescriptorRangeSizes, NumSrcDescriptorRanges, pSrcDescriptorRangeStarts, pSrcDescriptorRangeSizes,
+                 DescriptorHeapsType);
 
     // Early exit conditions - consistent validation
     if (DescriptorHeapsType != D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV &&
@@ -1007,6 +1121,7 @@ void ResTrack_Dx12::hkCopyDescriptors(ID3D12Device* This, UINT NumDestDescriptor
     if (!Config::Instance()->FGAlwaysTrackHeaps.value_or_default() && !IsHudFixActive())
         return;
 
+    HeapReclaimer::Guard guard;
     const UINT inc = This->GetDescriptorHandleIncrementSize(DescriptorHeapsType);
 
     // Validate that we have source descriptors to copy
@@ -1018,79 +1133,61 @@ void ResTrack_Dx12::hkCopyDescriptors(ID3D12Device* This, UINT NumDestDescriptor
     UINT destRangeIndex = 0;
     UINT destOffsetInRange = 0;
 
-    // Cache for heap lookups to avoid repeated lookups within the same range
-    HeapInfo* cachedDestHeap = nullptr;
-    SIZE_T cachedDestRangeStart = 0;
-    UINT cachedDestRangeSize = 0;
-    HeapInfo* cachedSrcHeap = nullptr;
-    SIZE_T cachedSrcRangeStart = 0;
-    UINT cachedSrcRangeSize = 0;
-
-    // Process all destination descriptors
+    // Walk both range lists together and copy the overlapping runs as blocks
     while (destRangeIndex < NumDestDescriptorRanges)
     {
-        // Update destination heap cache if we've moved to a new range
-        if (destOffsetInRange == 0)
+        const SIZE_T destRangeStart = pDestDescriptorRangeStarts[destRangeIndex].ptr;
+        const UINT destRangeSize =
+            (pDestDescriptorRangeSizes == nullptr) ? 1 : pDestDescriptorRangeSizes[destRangeIndex];
+
+        if (destOffsetInRange >= destRangeSize)
         {
-            cachedDestRangeStart = pDestDescriptorRangeStarts[destRangeIndex].ptr;
-            cachedDestRangeSize =
-                (pDestDescriptorRangeSizes == nullptr) ? 1 : pDestDescriptorRangeSizes[destRangeIndex];
-            cachedDestHeap = GetHeapByCpuHandle(cachedDestRangeStart);
+            destOffsetInRange = 0;
+            destRangeIndex++;
+            continue;
         }
 
-        // Calculate current destination handle
-        const SIZE_T destHandle = cachedDestRangeStart + (static_cast<SIZE_T>(destOffsetInRange) * inc);
+        UINT runLength = destRangeSize - destOffsetInRange;
+        HeapInfo* srcHeap = nullptr;
+        SIZE_T srcHandle = 0;
 
-        // Get or update source information
-        ResourceInfo* srcInfo = nullptr;
         if (haveSources && srcRangeIndex < NumSrcDescriptorRanges)
         {
-            // Update source heap cache if we've moved to a new range
-            if (srcOffsetInRange == 0)
-            {
-                cachedSrcRangeStart = pSrcDescriptorRangeStarts[srcRangeIndex].ptr;
-                cachedSrcRangeSize =
-                    (pSrcDescriptorRangeSizes == nullptr) ? 1 : pSrcDescriptorRangeSizes[srcRangeIndex];
-                cachedSrcHeap = GetHeapByCpuHandle(cachedSrcRangeStart);
-            }
+            const UINT srcRangeSize =
+                (pSrcDescriptorRangeSizes == nullptr) ? 1 : pSrcDescriptorRangeSizes[srcRangeIndex];
 
-            // Calculate current source handle
-            const SIZE_T srcHandle = cachedSrcRangeStart + (static_cast<SIZE_T>(srcOffsetInRange) * inc);
-
-            // Get source resource info with proper synchronization
-            if (cachedSrcHeap != nullptr)
-            {
-                // Access to heap info is synchronized through HeapInfo's const methods
-                // which use _trackedResourcesMutex internally
-                srcInfo = cachedSrcHeap->GetByCpuHandle(srcHandle);
-            }
-
-            // Advance source position
-            srcOffsetInRange++;
-            if (srcOffsetInRange >= cachedSrcRangeSize)
+            if (srcOffsetInRange >= srcRangeSize)
             {
                 srcOffsetInRange = 0;
                 srcRangeIndex++;
+                continue;
             }
+
+            runLength = std::min(runLength, srcRangeSize - srcOffsetInRange);
+            srcHandle = pSrcDescriptorRangeStarts[srcRangeIndex].ptr + (static_cast<SIZE_T>(srcOffsetInRange) * inc);
+            srcHeap = GetHeapByCpuHandle(srcHandle);
+
+            srcOffsetInRange += runLength;
         }
 
-        // Update destination heap tracking with proper synchronization
-        if (cachedDestHeap != nullptr)
+        const SIZE_T destHandle = destRangeStart + (static_cast<SIZE_T>(destOffsetInRange) * inc);
+
+        if (ResTrack_Capture::IsActive())
         {
-            // HeapInfo's Set/Clear methods use _trackedResourcesMutex internally
-            if (srcInfo != nullptr && srcInfo->buffer != nullptr)
-                cachedDestHeap->SetByCpuHandle(destHandle, *srcInfo);
-            else
-                cachedDestHeap->ClearByCpuHandle(destHandle);
+            ResTrack_Capture::Record(ResTrackOp::CopyDescriptors, destHandle, srcHandle, runLength, 0,
+                                     (uint8_t) DescriptorHeapsType);
         }
 
-        // Advance destination position
-        destOffsetInRange++;
-        if (destOffsetInRange >= cachedDestRangeSize)
+        auto destHeap = GetHeapByCpuHandle(destHandle);
+
+        // HeapInfo::CopyRange locks the _trackedResources shards internally
+        if (destHeap != nullptr)
         {
-            destOffsetInRange = 0;
-            destRangeIndex++;
+            destHeap->CopyRange(srcHeap, srcHeap != nullptr ? srcHeap->GetIndexByCpuHandle(srcHandle) : 0,
+                                destHeap->GetIndexByCpuHandle(destHandle), runLength);
         }
+
+        destOffsetInRange += runLength;
     }
 }
 
@@ -1099,8 +1196,10 @@ void ResTrack_Dx12::hkCopyDescriptorsSimple(ID3D12Device* This, UINT NumDescript
                                             D3D12_CPU_DESCRIPTOR_HANDLE SrcDescriptorRangeStart,
                                             D3D12_DESCRIPTOR_HEAP_TYPE DescriptorHeapsType)
 {
-    o_CopyDescriptorsSimple(This, NumDescriptors, DestDescriptorRangeStart, SrcDescriptorRangeStart,
-                            DescriptorHeapsType);
+    HookProfiler::Scope profile(ProfiledHook::RT_CopyDescriptorsSimple);
+
+    profile.Call(o_CopyDescriptorsSimple, This, NumDescriptors, DestDescriptorRangeStart, SrcDescriptorRangeStart,
+                 DescriptorHeapsType);
 
     if (DescriptorHeapsType != D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV &&
         DescriptorHeapsType != D3D12_DESCRIPTOR_HEAP_TYPE_RTV)
@@ -1109,52 +1208,40 @@ void ResTrack_Dx12::hkCopyDescriptorsSimple(ID3D12Device* This, UINT NumDescript
     if (!Config::Instance()->FGAlwaysTrackHeaps.value_or_default() && !IsHudFixActive())
         return;
 
-    auto size = This->GetDescriptorHandleIncrementSize(DescriptorHeapsType);
+    if (NumDescriptors == 0)
+        return;
 
-    for (size_t i = 0; i < NumDescriptors; i++)
+    if (ResTrack_Capture::IsActive())
     {
-        HeapInfo* srcHeap = nullptr;
-        SIZE_T srcHandle = 0;
+        ResTrack_Capture::Record(ResTrackOp::CopyDescriptors, DestDescriptorRangeStart.ptr,
+                                 SrcDescriptorRangeStart.ptr, NumDescriptors, 0, (uint8_t) DescriptorHeapsType);
+    }
 
-        // source
-        if (SrcDescriptorRangeStart.ptr != 0)
-        {
-            srcHandle = SrcDescriptorRangeStart.ptr + i * size;
-            srcHeap = GetHeapByCpuHandle(srcHandle);
-        }
+    HeapReclaimer::Guard guard;
+    auto dstHeap = GetHeapByCpuHandle(DestDescriptorRangeStart.ptr);
 
-        auto destHandle = DestDescriptorRangeStart.ptr + i * size;
-        auto dstHeap = GetHeapByCpuHandle(destHandle);
+    // destination
+    if (dstHeap == nullptr)
+        return;
 
-        // destination
-        if (dstHeap == nullptr)
-            continue;
+    // source
+    HeapInfo* srcHeap = nullptr;
+    if (SrcDescriptorRangeStart.ptr != 0)
+        srcHeap = GetHeapByCpuHandle(SrcDescriptorRangeStart.ptr);
 
-        if (srcHeap == nullptr)
-        {
-            dstHeap->ClearByCpuHandle(destHandle);
-            continue;
-        }
+    dstHeap->CopyRange(srcHeap, srcHeap != nullptr ? srcHeap->GetIndexByCpuHandle(SrcDescriptorRangeStart.ptr) : 0,
+                       dstHeap->GetIndexByCpuHandle(DestDescriptorRangeStart.ptr), NumDescriptors);
+}
 
-        auto buffer = srcHeap->GetByCpuHandle(srcHandle);
-
-        if (buffer == nullptr)
-        {
-            dstHeap->ClearByCpuHandle(destHandle);
-            continue;
-        }
-
-        dstHeap->SetByCpuHandle(destHandle, *buffer);
-    }
-}
-
-#pragma endregion
+#pragma endregion
 
 #pragma region Shader input hooks
 
 void ResTrack_Dx12::hkSetGraphicsRootDescriptorTable(ID3D12GraphicsCommandList* This, UINT RootParameterIndex,
                                                      D3D12_GPU_DESCRIPTOR_HANDLE BaseDescriptor)
 {
+    HookProfiler::Scope profile(ProfiledHook::RT_SetGraphicsRootDescriptorTable);
+
     // Consistent early exit - always call original function
     auto shouldTrack = !Config::Instance()->FGHudfixDisableSGR.value_or_default() && BaseDescriptor.ptr != 0 &&
                        IsHudFixActive() && !Hudfix_Dx12::SkipHudlessChecks() &&
@@ -1162,27 +1249,44 @@ void ResTrack_Dx12::hkSetGraphicsRootDescriptorTable(ID3D12GraphicsCommandList*
 
     if (!shouldTrack)
     {
-        o_SetGraphicsRootDescriptorTable(This, RootParameterIndex, BaseDescriptor);
+        profile.Call(o_SetGraphicsRootDescriptorTable, This, RootParameterIndex, BaseDescriptor);
         return;
     }
 
+    if (ResTrack_Capture::IsActive())
+    {
+        ResTrack_Capture::Record(ResTrackOp::SetGraphicsRootTable, (uint64_t) This, BaseDescriptor.ptr,
+                                 RootParameterIndex);
+    }
+
+    HeapReclaimer::Guard guard;
     auto heap = GetHeapByGpuHandleGR(BaseDescriptor.ptr);
     if (heap == nullptr)
     {
         LOG_DEBUG_ONLY("No heap for handle: {:X}", BaseDescriptor.ptr);
-        o_SetGraphicsRootDescriptorTable(This, RootParameterIndex, BaseDescriptor);
+        profile.Call(o_SetGraphicsRootDescriptorTable, This, RootParameterIndex, BaseDescriptor);
         return;
     }
 
-    auto capturedBuffer = heap->GetByGpuHandle(BaseDescriptor.ptr);
-    if (capturedBuffer == nullptr || capturedBuffer->buffer == nullptr)
+    ResourceInfo slotInfo {};
+    if (!heap->GetByGpuHandle(BaseDescriptor.ptr, &slotInfo))
     {
         LOG_DEBUG_ONLY("No resource at RootParameterIndex: {}, CommandList: {:X}, gpuHandle: {:X}", RootParameterIndex,
                        (SIZE_T) This, BaseDescriptor.ptr);
-        o_SetGraphicsRootDescriptorTable(This, RootParameterIndex, BaseDescriptor);
+        profile.Call(o_SetGraphicsRootDescriptorTable, This, RootParameterIndex, BaseDescriptor);
         return;
     }
 
+    // Sampled frame, only stable hudless is checked
+    auto sampled = Hudfix_Dx12::SampledResource();
+    if (sampled != nullptr && slotInfo.buffer != sampled)
+    {
+        profile.Call(o_SetGraphicsRootDescriptorTable, This, RootParameterIndex, BaseDescriptor);
+        return;
+    }
+
+    auto capturedBuffer = &slotInfo;
+
     LOG_DEBUG_ONLY("CommandList: {:X}, Resource: {:X}", (size_t) This, (size_t) capturedBuffer->buffer);
 
     // Only proceed with tracking if we have a valid buffer
@@ -1198,48 +1302,13 @@ void ResTrack_Dx12::hkSetGraphicsRootDescriptorTable(ID3D12GraphicsCommandList*
 
     if (!capturedImmediately)
     {
-        auto fIndex = Hudfix_Dx12::ActivePresentFrame() % BUFFER_COUNT;
-
-        if (!_useShards)
-        {
-            std::lock_guard<std::mutex> lock(_hudlessTrackMutex);
-
-            if (!fgPossibleHudless[fIndex].contains(This))
-            {
-                ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> newMap;
-                newMap.reserve(32);
-                fgPossibleHudless[fIndex].insert_or_assign(This, std::move(newMap));
-            }
-
-            LOG_TRACK("Tracking Resource: {:X}, Desc: {:X}", (size_t) capturedBuffer->buffer, BaseDescriptor.ptr);
-            fgPossibleHudless[fIndex][This].insert_or_assign(capturedBuffer->buffer, *capturedBuffer);
-        }
-        else
-        {
-            size_t shardIdx = GetShardIndex(This);
-            auto& shard = _hudlessShards[fIndex][shardIdx];
+        LOG_TRACK("CmdList: {:X}, Tracking Resource: {:X}, Desc: {:X}, Format: {}", (size_t) This,
+                  (size_t) capturedBuffer->buffer, BaseDescriptor.ptr, (UINT) capturedBuffer->format);
 
-#ifdef USE_SPINLOCK_MUTEX
-            std::lock_guard<SpinLock> lock(shard.mutex);
-#else
-            std::lock_guard<std::mutex> lock(shard.mutex);
-#endif
-
-            if (!shard.map.contains(This))
-            {
-                ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> newMap;
-                newMap.reserve(32);
-                shard.map.insert_or_assign(This, std::move(newMap));
-            }
-
-            LOG_TRACK("CmdList: {:X}, Tracking Resource: {:X}, Desc: {:X}, Format: {}", (size_t) This,
-                      (size_t) capturedBuffer->buffer, BaseDescriptor.ptr, (UINT) capturedBuffer->format);
-
-            shard.map[This].insert_or_assign(capturedBuffer->buffer, *capturedBuffer);
-        }
+        AddHudlessCandidate(This, capturedBuffer);
     }
 
-    o_SetGraphicsRootDescriptorTable(This, RootParameterIndex, BaseDescriptor);
+    profile.Call(o_SetGraphicsRootDescriptorTable, This, RootParameterIndex, BaseDescriptor);
 }
 
 #pragma endregion
@@ -1251,6 +1320,8 @@ void ResTrack_Dx12::hkOMSetRenderTargets(ID3D12GraphicsCommandList* This, UINT N
                                          BOOL RTsSingleHandleToDescriptorRange,
                                          D3D12_CPU_DESCRIPTOR_HANDLE* pDepthStencilDescriptor)
 {
+    HookProfiler::Scope profile(ProfiledHook::RT_OMSetRenderTargets);
+
     // Consistent early exit validation
     auto shouldTrack = !Config::Instance()->FGHudfixDisableOM.value_or_default() && NumRenderTargetDescriptors > 0 &&
                        pRenderTargetDescriptors != nullptr && IsHudFixActive() && !Hudfix_Dx12::SkipHudlessChecks() &&
@@ -1258,15 +1329,17 @@ void ResTrack_Dx12::hkOMSetRenderTargets(ID3D12GraphicsCommandList* This, UINT N
 
     if (!shouldTrack)
     {
-        o_OMSetRenderTargets(This, NumRenderTargetDescriptors, pRenderTargetDescriptors,
-                             RTsSingleHandleToDescriptorRange, pDepthStencilDescriptor);
+        profile.Call(o_OMSetRenderTargets, This, NumRenderTargetDescriptors, pRenderTargetDescriptors,
+                     RTsSingleHandleToDescriptorRange, pDepthStencilDescriptor);
         return;
     }
 
-    LOG_DEBUG_ONLY("NumRenderTargetDescriptors: {}", NumRenderTargetDescriptors);
+    HeapReclaimer::Guard guard;
 
-    auto fIndex = Hudfix_Dx12::ActivePresentFrame() % BUFFER_COUNT;
-    bool anyResourceTracked = false;
+    // Sampled frame, only stable hudless is checked
+    auto sampled = Hudfix_Dx12::SampledResource();
+
+    LOG_DEBUG_ONLY("NumRenderTargetDescriptors: {}", NumRenderTargetDescriptors);
 
     // Process render targets
     for (size_t i = 0; i < NumRenderTargetDescriptors; i++)
@@ -1297,13 +1370,21 @@ void ResTrack_Dx12::hkOMSetRenderTargets(ID3D12GraphicsCommandList* This, UINT N
             }
         }
 
-        auto capturedBuffer = heap->GetByCpuHandle(handle.ptr);
-        if (capturedBuffer == nullptr || capturedBuffer->buffer == nullptr)
+        if (ResTrack_Capture::IsActive())
+            ResTrack_Capture::Record(ResTrackOp::OMSetRenderTarget, (uint64_t) This, handle.ptr, i);
+
+        ResourceInfo slotInfo {};
+        if (!heap->GetByCpuHandle(handle.ptr, &slotInfo))
         {
             LOG_DEBUG_ONLY("No resource at index: {}, cpu: {:X}", i, handle.ptr);
             continue;
         }
 
+        if (sampled != nullptr && slotInfo.buffer != sampled)
+            continue;
+
+        auto capturedBuffer = &slotInfo;
+
         // Valid resource found, update state
         capturedBuffer->state = D3D12_RESOURCE_STATE_RENDER_TARGET;
         capturedBuffer->captureInfo = CaptureInfo::OMSetRTV;
@@ -1320,50 +1401,15 @@ void ResTrack_Dx12::hkOMSetRenderTargets(ID3D12GraphicsCommandList* This, UINT N
         // Track for later processing
         if (!capturedImmediately)
         {
-            if (!_useShards)
-            {
-                std::lock_guard<std::mutex> lock(_hudlessTrackMutex);
-
-                if (!fgPossibleHudless[fIndex].contains(This))
-                {
-                    ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> newMap;
-                    newMap.reserve(32);
-                    fgPossibleHudless[fIndex].insert_or_assign(This, std::move(newMap));
-                }
-
-                LOG_TRACK("Tracking Resource: {:X}, Desc: {:X}", (size_t) capturedBuffer->buffer, handle.ptr);
-                fgPossibleHudless[fIndex][This].insert_or_assign(capturedBuffer->buffer, *capturedBuffer);
-                anyResourceTracked = true;
-            }
-            else
-            {
-                size_t shardIdx = GetShardIndex(This);
-                auto& shard = _hudlessShards[fIndex][shardIdx];
-
-#ifdef USE_SPINLOCK_MUTEX
-                std::lock_guard<SpinLock> lock(shard.mutex);
-#else
-                std::lock_guard<std::mutex> lock(shard.mutex);
-#endif
-
-                if (!shard.map.contains(This))
-                {
-                    ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> newMap;
-                    newMap.reserve(32);
-                    shard.map.insert_or_assign(This, std::move(newMap));
-                }
-
-                LOG_TRACK("CmdList: {:X}, Tracking Resource: {:X}, Desc: {:X}, Format: {}", (size_t) This,
-                          (size_t) capturedBuffer->buffer, handle.ptr, (UINT) capturedBuffer->format);
+            LOG_TRACK("CmdList: {:X}, Tracking Resource: {:X}, Desc: {:X}, Format: {}", (size_t) This,
+                      (size_t) capturedBuffer->buffer, handle.ptr, (UINT) capturedBuffer->format);
 
-                shard.map[This].insert_or_assign(capturedBuffer->buffer, *capturedBuffer);
-                anyResourceTracked = true;
-            }
+            AddHudlessCandidate(This, capturedBuffer);
         }
     }
 
-    o_OMSetRenderTargets(This, NumRenderTargetDescriptors, pRenderTargetDescriptors, RTsSingleHandleToDescriptorRange,
-                         pDepthStencilDescriptor);
+    profile.Call(o_OMSetRenderTargets, This, NumRenderTargetDescriptors, pRenderTargetDescriptors,
+                 RTsSingleHandleToDescriptorRange, pDepthStencilDescriptor);
 }
 
 #pragma endregion
@@ -1373,6 +1419,8 @@ void ResTrack_Dx12::hkOMSetRenderTargets(ID3D12GraphicsCommandList* This, UINT N
 void ResTrack_Dx12::hkSetComputeRootDescriptorTable(ID3D12GraphicsCommandList* This, UINT RootParameterIndex,
                                                     D3D12_GPU_DESCRIPTOR_HANDLE BaseDescriptor)
 {
+    HookProfiler::Scope profile(ProfiledHook::RT_SetComputeRootDescriptorTable);
+
     // Consistent early exit - always call original function
     auto shouldTrack = !Config::Instance()->FGHudfixDisableSCR.value_or_default() && BaseDescriptor.ptr != 0 &&
                        IsHudFixActive() && !Hudfix_Dx12::SkipHudlessChecks() &&
@@ -1380,27 +1428,44 @@ void ResTrack_Dx12::hkSetComputeRootDescriptorTable(ID3D12GraphicsCommandList* T
 
     if (!shouldTrack)
     {
-        o_SetComputeRootDescriptorTable(This, RootParameterIndex, BaseDescriptor);
+        profile.Call(o_SetComputeRootDescriptorTable, This, RootParameterIndex, BaseDescriptor);
         return;
     }
 
+    if (ResTrack_Capture::IsActive())
+    {
+        ResTrack_Capture::Record(ResTrackOp::SetComputeRootTable, (uint64_t) This, BaseDescriptor.ptr,
+                                 RootParameterIndex);
+    }
+
+    HeapReclaimer::Guard guard;
     auto heap = GetHeapByGpuHandleCR(BaseDescriptor.ptr);
     if (heap == nullptr)
     {
         LOG_DEBUG_ONLY("No heap for handle: {:X}", BaseDescriptor.ptr);
-        o_SetComputeRootDescriptorTable(This, RootParameterIndex, BaseDescriptor);
+        profile.Call(o_SetComputeRootDescriptorTable, This, RootParameterIndex, BaseDescriptor);
         return;
     }
 
-    auto capturedBuffer = heap->GetByGpuHandle(BaseDescriptor.ptr);
-    if (capturedBuffer == nullptr || capturedBuffer->buffer == nullptr)
+    ResourceInfo slotInfo {};
+    if (!heap->GetByGpuHandle(BaseDescriptor.ptr, &slotInfo))
     {
         LOG_DEBUG_ONLY("No resource at RootParameterIndex: {}, CommandList: {:X}, gpuHandle: {:X}", RootParameterIndex,
                        (SIZE_T) This, BaseDescriptor.ptr);
-        o_SetComputeRootDescriptorTable(This, RootParameterIndex, BaseDescriptor);
+        profile.Call(o_SetComputeRootDescriptorTable, This, RootParameterIndex, BaseDescriptor);
+        return;
+    }
+
+    // Sampled frame, only stable hudless is checked
+    auto sampled = Hudfix_Dx12::SampledResource();
+    if (sampled != nullptr && slotInfo.buffer != sampled)
+    {
+        profile.Call(o_SetComputeRootDescriptorTable, This, RootParameterIndex, BaseDescriptor);
         return;
     }
 
+    auto capturedBuffer = &slotInfo;
+
     LOG_DEBUG_ONLY("CommandList: {:X}, Resource: {:X}", (size_t) This, (size_t) capturedBuffer->buffer);
 
     // Only proceed with tracking if we have a valid buffer
@@ -1420,48 +1485,13 @@ void ResTrack_Dx12::hkSetComputeRootDescriptorTable(ID3D12GraphicsCommandList* T
 
     if (!capturedImmediately)
     {
-        auto fIndex = Hudfix_Dx12::ActivePresentFrame() % BUFFER_COUNT;
-
-        if (!_useShards)
-        {
-            std::lock_guard<std::mutex> lock(_hudlessTrackMutex);
-
-            if (!fgPossibleHudless[fIndex].contains(This))
-            {
-                ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> newMap;
-                newMap.reserve(32);
-                fgPossibleHudless[fIndex].insert_or_assign(This, std::move(newMap));
-            }
-
-            LOG_TRACK("Tracking Resource: {:X}, Desc: {:X}", (size_t) capturedBuffer->buffer, BaseDescriptor.ptr);
-            fgPossibleHudless[fIndex][This].insert_or_assign(capturedBuffer->buffer, *capturedBuffer);
-        }
-        else
-        {
-            size_t shardIdx = GetShardIndex(This);
-            auto& shard = _hudlessShards[fIndex][shardIdx];
-
-#ifdef USE_SPINLOCK_MUTEX
-            std::lock_guard<SpinLock> lock(shard.mutex);
-#else
-            std::lock_guard<std::mutex> lock(shard.mutex);
-#endif
-
-            if (!shard.map.contains(This))
-            {
-                ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> newMap;
-                newMap.reserve(32);
-                shard.map.insert_or_assign(This, std::move(newMap));
-            }
-
-            LOG_TRACK("CmdList: {:X}, Tracking Resource: {:X}, Desc: {:X}, Format: {}", (size_t) This,
-                      (size_t) capturedBuffer->buffer, BaseDescriptor.ptr, (UINT) capturedBuffer->format);
+        LOG_TRACK("CmdList: {:X}, Tracking Resource: {:X}, Desc: {:X}, Format: {}", (size_t) This,
+                  (size_t) capturedBuffer->buffer, BaseDescriptor.ptr, (UINT) capturedBuffer->format);
 
-            shard.map[This].insert_or_assign(capturedBuffer->buffer, *capturedBuffer);
-        }
+        AddHudlessCandidate(This, capturedBuffer);
     }
 
-    o_SetComputeRootDescriptorTable(This, RootParameterIndex, BaseDescriptor);
+    profile.Call(o_SetComputeRootDescriptorTable, This, RootParameterIndex, BaseDescriptor);
 }
 
 #pragma endregion
@@ -1472,7 +1502,13 @@ void ResTrack_Dx12::hkSetComputeRootDescriptorTable(ID3D12GraphicsCommandList* T
 void ResTrack_Dx12::hkDrawInstanced(ID3D12GraphicsCommandList* This, UINT VertexCountPerInstance, UINT InstanceCount,
                                     UINT StartVertexLocation, UINT StartInstanceLocation)
 {
-    o_DrawInstanced(This, VertexCountPerInstance, InstanceCount, StartVertexLocation, StartInstanceLocation);
+    HookProfiler::Scope profile(ProfiledHook::RT_DrawInstanced);
+
+    profile.Call(o_DrawInstanced, This, VertexCountPerInstance, InstanceCount, StartVertexLocation,
+                 StartInstanceLocation);
+
+    if (ResTrack_Capture::IsActive())
+        ResTrack_Capture::Record(ResTrackOp::DrawInstanced, (uint64_t) This);
 
     if (!IsHudFixActive())
     {
@@ -1482,121 +1518,20 @@ void ResTrack_Dx12::hkDrawInstanced(ID3D12GraphicsCommandList* This, UINT Vertex
 
     LOG_TRACK("CmdList: {:X}", (size_t) This);
 
-    auto fIndex = Hudfix_Dx12::ActivePresentFrame() % BUFFER_COUNT;
-
-    if (!_useShards)
-    {
-        if (This == MenuOverlayDx::MenuCommandList())
-        {
-            std::lock_guard<std::mutex> lock(_hudlessTrackMutex);
-            fgPossibleHudless[fIndex].erase(This);
-            return;
-        }
-
-        if (fgPossibleHudless[fIndex].size() == 0)
-            return;
-
-        ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> val0;
-        {
-            std::lock_guard<std::mutex> lock(_hudlessTrackMutex);
-
-            if (!fgPossibleHudless[fIndex].contains(This))
-                return;
-
-            val0 = std::move(fgPossibleHudless[fIndex][This]);
-            fgPossibleHudless[fIndex].erase(This);
-        }
-
-        do
-        {
-            // if this command list does not have entries skip
-            if (val0.size() == 0)
-                break;
-
-            if (Config::Instance()->FGHudfixDisableDI.value_or_default())
-                break;
-
-            for (auto& [key, val] : val0)
-            {
-                std::lock_guard<std::mutex> lock(_drawMutex);
-
-                val.captureInfo |= CaptureInfo::DrawInstanced;
-
-                if (Hudfix_Dx12::CheckForHudless(This, &val, val.state))
-                    break;
-            }
-
-        } while (false);
-    }
-    else
-    {
-        size_t shardIdx = GetShardIndex(This);
-        auto& shard = _hudlessShards[fIndex][shardIdx];
-
-        if (This == MenuOverlayDx::MenuCommandList() && shard.map.contains(This))
-        {
-#ifdef USE_SPINLOCK_MUTEX
-            std::lock_guard<SpinLock> lock(shard.mutex);
-#else
-            std::lock_guard<std::mutex> lock(shard.mutex);
-#endif
-
-            shard.map.erase(This);
-            return;
-        }
-
-        // if can't find output skip
-        if (shard.map.size() == 0)
-        {
-            LOG_DEBUG_ONLY("Early exit");
-            return;
-        }
-
-        ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> val0;
-        {
-
-#ifdef USE_SPINLOCK_MUTEX
-            std::lock_guard<SpinLock> lock(shard.mutex);
-#else
-            std::lock_guard<std::mutex> lock(shard.mutex);
-#endif
-
-            if (!shard.map.contains(This))
-                return;
-
-            val0 = std::move(shard.map[This]);
-            shard.map.erase(This);
-        }
-
-        do
-        {
-            // if this command list does not have entries skip
-            if (val0.size() == 0)
-                break;
-
-            if (Config::Instance()->FGHudfixDisableDI.value_or_default())
-                break;
-
-            for (auto& [key, val] : val0)
-            {
-                std::lock_guard<std::mutex> lock(_drawMutex);
-
-                val.captureInfo |= CaptureInfo::DrawInstanced;
-
-                if (Hudfix_Dx12::CheckForHudless(This, &val, val.state))
-                    break;
-            }
-
-        } while (false);
-    }
+    CheckHudlessCandidates(This, CaptureInfo::DrawInstanced, Config::Instance()->FGHudfixDisableDI.value_or_default());
 }
 
 void ResTrack_Dx12::hkDrawIndexedInstanced(ID3D12GraphicsCommandList* This, UINT IndexCountPerInstance,
                                            UINT InstanceCount, UINT StartIndexLocation, INT BaseVertexLocation,
                                            UINT StartInstanceLocation)
 {
-    o_DrawIndexedInstanced(This, IndexCountPerInstance, InstanceCount, StartIndexLocation, BaseVertexLocation,
-                           StartInstanceLocation);
+    HookProfiler::Scope profile(ProfiledHook::RT_DrawIndexedInstanced);
+
+    profile.Call(o_DrawIndexedInstanced, This, IndexCountPerInstance, InstanceCount, StartIndexLocation,
+                 BaseVertexLocation, StartInstanceLocation);
+
+    if (ResTrack_Capture::IsActive())
+        ResTrack_Capture::Record(ResTrackOp::DrawIndexedInstanced, (uint64_t) This);
 
     if (!IsHudFixActive())
     {
@@ -1606,126 +1541,21 @@ void ResTrack_Dx12::hkDrawIndexedInstanced(ID3D12GraphicsCommandList* This, UINT
 
     LOG_TRACK("CmdList: {:X}", (size_t) This);
 
-    auto fIndex = Hudfix_Dx12::ActivePresentFrame() % BUFFER_COUNT;
-
-    if (!_useShards)
-    {
-        if (This == MenuOverlayDx::MenuCommandList())
-        {
-            std::lock_guard<std::mutex> lock(_hudlessTrackMutex);
-            fgPossibleHudless[fIndex].erase(This);
-            return;
-        }
-
-        if (fgPossibleHudless[fIndex].size() == 0)
-            return;
-
-        ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> val0;
-        {
-            std::lock_guard<std::mutex> lock(_hudlessTrackMutex);
-
-            if (!fgPossibleHudless[fIndex].contains(This))
-                return;
-
-            val0 = std::move(fgPossibleHudless[fIndex][This]);
-            fgPossibleHudless[fIndex].erase(This);
-        }
-
-        do
-        {
-            // if this command list does not have entries skip
-            if (val0.size() == 0)
-                break;
-
-            if (Config::Instance()->FGHudfixDisableDII.value_or_default())
-                break;
-
-            for (auto& [key, val] : val0)
-            {
-                // LOG_DEBUG("Waiting _drawMutex {:X}", (size_t)val.buffer);
-                std::lock_guard<std::mutex> lock(_drawMutex);
-
-                val.captureInfo |= CaptureInfo::DrawIndexedInstanced;
-
-                if (Hudfix_Dx12::CheckForHudless(This, &val, val.state))
-                    break;
-            }
-
-        } while (false);
-    }
-    else
-    {
-        size_t shardIdx = GetShardIndex(This);
-        auto& shard = _hudlessShards[fIndex][shardIdx];
-
-        if (This == MenuOverlayDx::MenuCommandList() && shard.map.contains(This))
-        {
-#ifdef USE_SPINLOCK_MUTEX
-            std::lock_guard<SpinLock> lock(shard.mutex);
-#else
-            std::lock_guard<std::mutex> lock(shard.mutex);
-#endif
-
-            shard.map.erase(This);
-            return;
-        }
-
-        // if can't find output skip
-        if (shard.map.size() == 0)
-        {
-            LOG_DEBUG_ONLY("Early exit");
-            return;
-        }
-
-        ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> val0;
-        {
-
-#ifdef USE_SPINLOCK_MUTEX
-            std::lock_guard<SpinLock> lock(shard.mutex);
-#else
-            std::lock_guard<std::mutex> lock(shard.mutex);
-#endif
-
-            if (!shard.map.contains(This))
-                return;
-
-            val0 = std::move(shard.map[This]);
-            shard.map.erase(This);
-        }
-
-        do
-        {
-            // if this command list does not have entries skip
-            if (val0.size() == 0)
-                break;
-
-            if (Config::Instance()->FGHudfixDisableDII.value_or_default())
-                break;
-
-            for (auto& [key, val] : val0)
-            {
-                // LOG_DEBUG("Waiting _drawMutex {:X}", (size_t)val.buffer);
-                std::lock_guard<std::mutex> lock(_drawMutex);
-
-                val.captureInfo |= CaptureInfo::DrawIndexedInstanced;
-
-                if (Hudfix_Dx12::CheckForHudless(This, &val, val.state))
-                    break;
-            }
-
-        } while (false);
-    }
+    CheckHudlessCandidates(This, CaptureInfo::DrawIndexedInstanced,
+                           Config::Instance()->FGHudfixDisableDII.value_or_default());
 }
 
 void ResTrack_Dx12::hkExecuteBundle(ID3D12GraphicsCommandList* This, ID3D12GraphicsCommandList* pCommandList)
 {
+    HookProfiler::Scope profile(ProfiledHook::RT_ExecuteBundle);
+
     LOG_WARN();
 
     IFGFeature_Dx12* fg = State::Instance().currentFG;
     auto index = fg != nullptr ? fg->GetIndex() : 0;
 
     {
-        std::lock_guard<std::mutex> lock(_resourceCommandListMutex);
+        auto lock = HookProfiler::TimedLock(_resourceCommandListMutex);
 
         if (fg != nullptr && fg->IsActive() && (_resourceCommandList[index].size() > 0 || !_resCmdList[index].empty()))
         {
@@ -1749,11 +1579,13 @@ void ResTrack_Dx12::hkExecuteBundle(ID3D12GraphicsCommandList* This, ID3D12Graph
         }
     }
 
-    o_ExecuteBundle(This, pCommandList);
+    profile.Call(o_ExecuteBundle, This, pCommandList);
 }
 
 HRESULT ResTrack_Dx12::hkClose(ID3D12GraphicsCommandList* This)
 {
+    HookProfiler::Scope profile(ProfiledHook::RT_Close);
+
     auto fg = State::Instance().currentFG;
     auto index = fg != nullptr ? fg->GetIndex() : 0;
 
@@ -1761,7 +1593,7 @@ HRESULT ResTrack_Dx12::hkClose(ID3D12GraphicsCommandList* This)
     {
         LOG_TRACK("CmdList: {:X}", (size_t) This);
 
-        std::lock_guard<std::mutex> lock(_resourceCommandListMutex);
+        auto lock = HookProfiler::TimedLock(_resourceCommandListMutex);
 
         if (_notFoundCmdLists.contains(This))
             LOG_WARN("Found last frames cmdList: {:X}", (size_t) This);
@@ -1787,13 +1619,18 @@ HRESULT ResTrack_Dx12::hkClose(ID3D12GraphicsCommandList* This)
         }
     }
 
-    return o_Close(This);
+    return profile.Call(o_Close, This);
 }
 
 void ResTrack_Dx12::hkDispatch(ID3D12GraphicsCommandList* This, UINT ThreadGroupCountX, UINT ThreadGroupCountY,
                                UINT ThreadGroupCountZ)
 {
-    o_Dispatch(This, ThreadGroupCountX, ThreadGroupCountY, ThreadGroupCountZ);
+    HookProfiler::Scope profile(ProfiledHook::RT_Dispatch);
+
+    profile.Call(o_Dispatch, This, ThreadGroupCountX, ThreadGroupCountY, ThreadGroupCountZ);
+
+    if (ResTrack_Capture::IsActive())
+        ResTrack_Capture::Record(ResTrackOp::Dispatch, (uint64_t) This);
 
     if (!IsHudFixActive())
     {
@@ -1803,115 +1640,7 @@ void ResTrack_Dx12::hkDispatch(ID3D12GraphicsCommandList* This, UINT ThreadGroup
 
     LOG_TRACK("CmdList: {:X}", (size_t) This);
 
-    auto fIndex = Hudfix_Dx12::ActivePresentFrame() % BUFFER_COUNT;
-
-    if (!_useShards)
-    {
-        if (This == MenuOverlayDx::MenuCommandList())
-        {
-            std::lock_guard<std::mutex> lock(_hudlessTrackMutex);
-            fgPossibleHudless[fIndex].erase(This);
-            return;
-        }
-
-        if (fgPossibleHudless[fIndex].size() == 0)
-            return;
-
-        ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> val0;
-        {
-            std::lock_guard<std::mutex> lock(_hudlessTrackMutex);
-
-            if (!fgPossibleHudless[fIndex].contains(This))
-                return;
-
-            val0 = std::move(fgPossibleHudless[fIndex][This]);
-            fgPossibleHudless[fIndex].erase(This);
-        }
-
-        do
-        {
-            // if this command list does not have entries skip
-            if (val0.size() == 0)
-                break;
-
-            if (Config::Instance()->FGHudfixDisableDispatch.value_or_default())
-                break;
-
-            for (auto& [key, val] : val0)
-            {
-                // LOG_DEBUG("Waiting _drawMutex {:X}", (size_t)val.buffer);
-                std::lock_guard<std::mutex> lock(_drawMutex);
-
-                val.captureInfo |= CaptureInfo::Dispatch;
-                if (Hudfix_Dx12::CheckForHudless(This, &val, val.state))
-                {
-                    break;
-                }
-            }
-        } while (false);
-    }
-    else
-    {
-        size_t shardIdx = GetShardIndex(This);
-        auto& shard = _hudlessShards[fIndex][shardIdx];
-
-        if (This == MenuOverlayDx::MenuCommandList() && shard.map.contains(This))
-        {
-#ifdef USE_SPINLOCK_MUTEX
-            std::lock_guard<SpinLock> lock(shard.mutex);
-#else
-            std::lock_guard<std::mutex> lock(shard.mutex);
-#endif
-
-            shard.map.erase(This);
-            return;
-        }
-
-        // if can't find output skip
-        if (shard.map.size() == 0)
-        {
-            LOG_DEBUG_ONLY("Early exit");
-            return;
-        }
-
-        ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo> val0;
-        {
-
-#ifdef USE_SPINLOCK_MUTEX
-            std::lock_guard<SpinLock> lock(shard.mutex);
-#else
-            std::lock_guard<std::mutex> lock(shard.mutex);
-#endif
-
-            if (!shard.map.contains(This))
-                return;
-
-            val0 = std::move(shard.map[This]);
-            shard.map.erase(This);
-        }
-
-        do
-        {
-            // if this command list does not have entries skip
-            if (val0.size() == 0)
-                break;
-
-            if (Config::Instance()->FGHudfixDisableDispatch.value_or_default())
-                break;
-
-            for (auto& [key, val] : val0)
-            {
-                // LOG_DEBUG("Waiting _drawMutex {:X}", (size_t)val.buffer);
-                std::lock_guard<std::mutex> lock(_drawMutex);
-
-                val.captureInfo |= CaptureInfo::Dispatch;
-                if (Hudfix_Dx12::CheckForHudless(This, &val, val.state))
-                {
-                    break;
-                }
-            }
-        } while (false);
-    }
+    CheckHudlessCandidates(This, CaptureInfo::Dispatch, Config::Instance()->FGHudfixDisableDispatch.value_or_default());
 }
 
 #pragma endregion
@@ -2076,13 +1805,16 @@ void ResTrack_Dx12::HookDevice(ID3D12Device* device)
 
     if (fgHeaps.capacity() < 65536)
     {
-        _useShards = Config::Instance()->FGUseShards.value_or_default();
-        _trackedResources.reserve(1024);
+        _trackedResources.Reserve(1024);
         fgHeaps.reserve(65536);
     }
 
     LOG_FUNC();
 
+    // Start before any heap is created so captures can be replayed from an empty state
+    if (Config::Instance()->FGResourceTrackingCapture.value_or_default())
+        ResTrack_Capture::Start((Util::DllPath().parent_path() / L"OptiScaler_ResTrack.capture").wstring());
+
     ID3D12Device* realDevice = nullptr;
     if (!CheckForRealObject(__FUNCTION__, device, (IUnknown**) &realDevice))
         realDevice = device;
@@ -2224,6 +1956,8 @@ void ResTrack_Dx12::ReleaseHooks()
 {
     LOG_DEBUG("");
 
+    ResTrack_Capture::Stop();
+
     DetourTransactionBegin();
     DetourUpdateThread(GetCurrentThread());
 
@@ -2304,26 +2038,8 @@ void ResTrack_Dx12::ClearPossibleHudless()
 
     auto hfIndex = Hudfix_Dx12::ActivePresentFrame() % BUFFER_COUNT;
 
-    if (!_useShards)
-    {
-        std::lock_guard<std::mutex> lock(_hudlessTrackMutex);
-        fgPossibleHudless[hfIndex].clear();
-    }
-    else
-    {
-        for (size_t i = 0; i < SHARD_COUNT; i++)
-        {
-            auto& shard = _hudlessShards[hfIndex][i];
-
-#ifdef USE_SPINLOCK_MUTEX
-            std::lock_guard<SpinLock> lock(shard.mutex);
-#else
-            std::lock_guard<std::mutex> lock(shard.mutex);
-#endif
-
-            shard.map.clear();
-        }
-    }
+    // Drops every thread's candidate log for this frame slot
+    _hudlessLogEpoch[hfIndex].fetch_add(1, std::memory_order_release);
 
     std::lock_guard<std::mutex> lock2(_resourceCommandListMutex);
 
@@ -3,11 +3,14 @@
 #include <pch.h>
 
 #include <hudfix/Hudfix_Dx12.h>
+#include <resource_tracking/ResTrack_Filter.h>
 #include <framegen/IFGFeature_Dx12.h>
 
 #include <ankerl/unordered_dense.h>
 
 #include <new>
+#include <vector>
+#include <algorithm>
 #include <mutex>
 #include <atomic>
 #include <shared_mutex>
@@ -120,12 +123,361 @@ struct SpinLock
 #endif
 #endif
 
-static ankerl::unordered_dense::map<ID3D12Resource*, std::vector<ResourceInfo*>> _trackedResources;
+// Reverse index from resources to the descriptor slots (HeapInfo::buffers entries) pointing at them.
+// Sharded by resource address so descriptor writes and releases on different threads don't serialize
+// on a single lock. Never hold more than one shard lock at a time.
+// Each slot has an owner record (HeapInfo::owners entry) with the resource it's listed under, so a slot that is
+// attached without a matching detach is removed from the shard of its previous resource first.
+class TrackedResourceIndex
+{
+  public:
+    inline static constexpr size_t SHARD_COUNT = 64;
+
+    // Where a slot is listed, index into the slot vector of its resource
+    struct SlotPosition
+    {
+        ID3D12Resource* resource = nullptr;
+        UINT index = 0;
+    };
+
+    struct alignas(CACHE_LINE_SIZE) Shard
+    {
+#ifdef USE_SPINLOCK_MUTEX
+        SpinLock mutex;
+#else
+        std::mutex mutex;
+#endif
+        ankerl::unordered_dense::map<ID3D12Resource*, std::vector<ID3D12Resource**>> map;
+
+        // Back index of the slots listed in map, keeps attach and detach constant time
+        ankerl::unordered_dense::map<ID3D12Resource**, SlotPosition> positions;
+    };
+
+    using SlotOwner = std::atomic<ID3D12Resource*>;
+
+    struct SlotChange
+    {
+        ID3D12Resource* resource = nullptr;
+        ID3D12Resource** slot = nullptr;
+        SlotOwner* owner = nullptr;
+        bool attach = false;
+    };
+
+  private:
+    Shard _shards[SHARD_COUNT];
+
+    static size_t GetShardIndex(ID3D12Resource* resource)
+    {
+        // Resources are heap allocated, low bits carry little entropy
+        auto addr = (UINT64) resource;
+        return ((addr >> 4) ^ (addr >> 12)) % SHARD_COUNT;
+    }
+
+    // Swap erases a slot from the vector of its resource, the caller drops its position
+    static void RemoveLocked(Shard& shard, SlotPosition position)
+    {
+        auto it = shard.map.find(position.resource);
+        auto& vec = it->second;
+
+        auto moved = vec.back();
+        vec[position.index] = moved;
+        vec.pop_back();
+
+        if (position.index < vec.size())
+        {
+            shard.positions.find(moved)->second.index = position.index;
+        }
+        else if (vec.empty())
+        {
+            shard.map.erase(it);
+            TrackedResourceFilter::Remove(position.resource);
+        }
+    }
+
+    static void AttachLocked(Shard& shard, ID3D12Resource* resource, ID3D12Resource** slot)
+    {
+        auto [pos, added] = shard.positions.try_emplace(slot);
+
+        if (!added)
+        {
+            if (pos->second.resource == resource)
+                return;
+
+            // Slot is still listed under a resource it no longer points to
+            RemoveLocked(shard, pos->second);
+        }
+
+        auto [it, inserted] = shard.map.try_emplace(resource);
+        if (inserted)
+            TrackedResourceFilter::Add(resource);
+
+        pos->second = { resource, (UINT) it->second.size() };
+        it->second.push_back(slot);
+    }
+
+    static void DetachLocked(Shard& shard, ID3D12Resource* resource, ID3D12Resource** slot)
+    {
+        auto pos = shard.positions.find(slot);
+        if (pos == shard.positions.end() || pos->second.resource != resource)
+            return;
+
+        auto position = pos->second;
+        shard.positions.erase(pos);
+        RemoveLocked(shard, position);
+    }
+
+  public:
+    Shard& GetShard(ID3D12Resource* resource) { return _shards[GetShardIndex(resource)]; }
+
+    // Drops a released resource from the index and moves its slots to the caller, shard must be locked
+    static bool TakeLocked(Shard& shard, ID3D12Resource* resource, std::vector<ID3D12Resource**>& slots)
+    {
+        auto it = shard.map.find(resource);
+        if (it == shard.map.end())
+            return false;
+
+        slots = std::move(it->second);
+        shard.map.erase(it);
+
+        for (auto slot : slots)
+            shard.positions.erase(slot);
+
+        TrackedResourceFilter::Remove(resource);
+        return true;
+    }
+
+    void Attach(ID3D12Resource* resource, ID3D12Resource** slot, SlotOwner* owner)
+    {
+        auto previous = owner->exchange(resource, std::memory_order_acq_rel);
+
+        // Slot is still listed under a resource it no longer points to, which can be in another shard
+        if (previous != nullptr && previous != resource)
+        {
+            auto& previousShard = GetShard(previous);
+            std::scoped_lock lock(previousShard.mutex);
+            DetachLocked(previousShard, previous, slot);
+        }
+
+        auto& shard = GetShard(resource);
+        std::scoped_lock lock(shard.mutex);
+        AttachLocked(shard, resource, slot);
+    }
+
+    void Detach(ID3D12Resource* resource, ID3D12Resource** slot, SlotOwner* owner)
+    {
+        // Keep the record when the slot was attached to another resource meanwhile
+        auto expected = resource;
+        owner->compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel);
+
+        auto& shard = GetShard(resource);
+        std::scoped_lock lock(shard.mutex);
+        DetachLocked(shard, resource, slot);
+    }
+
+    // Applies a batch of attach/detach operations, taking every shard lock at most once
+    void Apply(const std::vector<SlotChange>& changes)
+    {
+        if (changes.empty())
+            return;
+
+        // Grouping doesn't pay off for a single descriptor
+        if (changes.size() <= 2)
+        {
+            for (const auto& change : changes)
+            {
+                if (change.attach)
+                    Attach(change.resource, change.slot, change.owner);
+                else
+                    Detach(change.resource, change.slot, change.owner);
+            }
+
+            return;
+        }
+
+        static thread_local std::vector<SlotChange> resolved;
+        static thread_local std::vector<SlotChange> grouped;
+        resolved.clear();
+
+        // Owner records are updated in order before grouping, attaches of slots still listed under another
+        // resource get a detach from that resource's shard
+        for (const auto& change : changes)
+        {
+            if (change.attach)
+            {
+                auto previous = change.owner->exchange(change.resource, std::memory_order_acq_rel);
+
+                if (previous != nullptr && previous != change.resource)
+                    resolved.push_back({ previous, change.slot, change.owner, false });
+            }
+            else
+            {
+                auto expected = change.resource;
+                change.owner->compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel);
+            }
+
+            resolved.push_back(change);
+        }
+
+        size_t offsets[SHARD_COUNT + 1] = {};
+
+        // Counting sort by shard, keeps the order of changes within a shard
+        for (const auto& change : resolved)
+            offsets[GetShardIndex(change.resource) + 1]++;
+
+        for (size_t i = 1; i <= SHARD_COUNT; i++)
+            offsets[i] += offsets[i - 1];
+
+        grouped.resize(resolved.size());
+
+        size_t next[SHARD_COUNT];
+        std::copy(offsets, offsets + SHARD_COUNT, next);
+
+        for (const auto& change : resolved)
+            grouped[next[GetShardIndex(change.resource)]++] = change;
+
+        for (size_t shardIndex = 0; shardIndex < SHARD_COUNT; shardIndex++)
+        {
+            if (offsets[shardIndex] == offsets[shardIndex + 1])
+                continue;
+
+            auto& shard = _shards[shardIndex];
+            std::scoped_lock lock(shard.mutex);
+
+            for (size_t i = offsets[shardIndex]; i < offsets[shardIndex + 1]; i++)
+            {
+                if (grouped[i].attach)
+                    AttachLocked(shard, grouped[i].resource, grouped[i].slot);
+                else
+                    DetachLocked(shard, grouped[i].resource, grouped[i].slot);
+            }
+        }
+    }
+
+    void Reserve(size_t count)
+    {
+        for (auto& shard : _shards)
+        {
+            std::scoped_lock lock(shard.mutex);
+            shard.map.reserve(count / SHARD_COUNT + 1);
+            shard.positions.reserve(count / SHARD_COUNT + 1);
+        }
+    }
+};
+
+// One instance for all TUs which include this header
+inline TrackedResourceIndex _trackedResources;
+
+// Cold resource properties of a descriptor slot
+struct ResourceDesc
+{
+    UINT64 width = 0;
+    UINT height = 0;
+    DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
+    D3D12_RESOURCE_FLAGS flags = D3D12_RESOURCE_FLAG_NONE;
+
+    bool operator==(const ResourceDesc& other) const = default;
+};
+
+struct ResourceDescHash
+{
+    using is_avalanching = void;
+
+    uint64_t operator()(const ResourceDesc& desc) const noexcept
+    {
+        auto packed = ((UINT64) desc.height << 32) | ((UINT64) desc.format << 8) | (UINT64) desc.flags;
+        return ankerl::unordered_dense::hash<UINT64> {}(desc.width ^ (packed * 0x9E3779B97F4A7C15ull));
+    }
+};
+
+// Interns resource descriptions by value, heap slots only keep a 32 bit id.
+// Entries are never removed, the number of distinct descriptions in a game is small.
+class ResourceDescTable
+{
+    inline static constexpr UINT CHUNK_BITS = 10;
+    inline static constexpr UINT CHUNK_SIZE = 1 << CHUNK_BITS;
+    inline static constexpr UINT MAX_CHUNKS = 1024;
+
 #ifdef USE_SPINLOCK_MUTEX
-static SpinLock _trackedResourcesMutex;
+    SpinLock _mutex;
 #else
-static std::mutex _trackedResourcesMutex;
+    std::mutex _mutex;
 #endif
+    ankerl::unordered_dense::map<ResourceDesc, UINT, ResourceDescHash> _ids;
+    std::atomic<ResourceDesc*> _chunks[MAX_CHUNKS] = {};
+
+    // Id 0 is the empty description
+    UINT _count = 1;
+    bool _saturated = false;
+
+  public:
+    UINT Intern(const ResourceDesc& desc)
+    {
+        // Views of the same resource are usually created back to back
+        static thread_local ResourceDesc lastDesc {};
+        static thread_local UINT lastId = 0;
+
+        if (lastId != 0 && lastDesc == desc)
+            return lastId;
+
+        std::scoped_lock lock(_mutex);
+
+        UINT id = 0;
+
+        if (auto it = _ids.find(desc); it != _ids.end())
+        {
+            id = it->second;
+        }
+        else
+        {
+            if (_count >= CHUNK_SIZE * MAX_CHUNKS)
+            {
+                if (!_saturated)
+                {
+                    LOG_ERROR("Resource desc table is full ({} descs), new views are tracked without a desc",
+                              CHUNK_SIZE * MAX_CHUNKS);
+                    _saturated = true;
+                }
+
+                return 0;
+            }
+
+            auto chunk = _chunks[_count >> CHUNK_BITS].load(std::memory_order_relaxed);
+            if (chunk == nullptr)
+            {
+                chunk = new ResourceDesc[CHUNK_SIZE];
+                _chunks[_count >> CHUNK_BITS].store(chunk, std::memory_order_release);
+            }
+
+            id = _count++;
+            chunk[id & (CHUNK_SIZE - 1)] = desc;
+            _ids[desc] = id;
+        }
+
+        lastDesc = desc;
+        lastId = id;
+        return id;
+    }
+
+    const ResourceDesc& Get(UINT id) const
+    {
+        static const ResourceDesc empty {};
+
+        if (id == 0)
+            return empty;
+
+        return _chunks[id >> CHUNK_BITS].load(std::memory_order_acquire)[id & (CHUNK_SIZE - 1)];
+    }
+};
+
+// Shared like _trackedResources, desc IDs are only valid in this table
+inline ResourceDescTable _resourceDescs;
+
+struct DescriptorSlotMeta
+{
+    UINT descId = 0;
+    UINT8 type = SRV;
+    UINT8 captureInfo = 0;
+};
 
 struct HeapInfo
 {
@@ -139,89 +491,105 @@ struct HeapInfo
     UINT numDescriptors = 0;
     UINT increment = 0;
     UINT type = 0;
-    std::shared_ptr<ResourceInfo[]> info;
+
+    // Hot: resource pointer per descriptor, the only array touched by empty slot lookups
+    std::unique_ptr<ID3D12Resource*[]> buffers;
+
+    // Packed metadata per descriptor, resource properties are interned in _resourceDescs
+    std::unique_ptr<DescriptorSlotMeta[]> meta;
+
+    // Resource each descriptor is listed under in _trackedResources
+    std::unique_ptr<TrackedResourceIndex::SlotOwner[]> owners;
+
     UINT lastOffset = 0;
     bool active = true;
-    std::atomic<uint64_t> version { 0 };
 
     HeapInfo(ID3D12DescriptorHeap* heap, SIZE_T cpuStart, SIZE_T cpuEnd, SIZE_T gpuStart, SIZE_T gpuEnd,
              UINT numResources, UINT increment, UINT type)
         : cpuStart(cpuStart), cpuEnd(cpuEnd), gpuStart(gpuStart), gpuEnd(gpuEnd), numDescriptors(numResources),
-          increment(increment), info(new ResourceInfo[numResources]), type(type), heap(heap)
+          increment(increment), buffers(new ID3D12Resource*[numResources]()),
+          meta(new DescriptorSlotMeta[numResources]), owners(new TrackedResourceIndex::SlotOwner[numResources]()),
+          type(type), heap(heap)
     {
-        static std::atomic<uint64_t> globalHeapVersion { 1 };
-        version.store(globalHeapVersion.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
-
-        for (size_t i = 0; i < numDescriptors; i++)
-        {
-            info[i].buffer = nullptr;
-        }
     }
 
     void DetachFromOldResource(SIZE_T index) const
     {
-        if (info[index].buffer == nullptr)
+        if (buffers[index] == nullptr)
             return;
 
-        std::scoped_lock lock(_trackedResourcesMutex);
-        LOG_TRACK("Heap: {:X}, Index: {}, Resource: {:X}, Res: {}x{}, Format: {}", (size_t) this, index,
-                  (size_t) info[index].buffer, info[index].width, info[index].height, (UINT) info[index].format);
-        auto it = _trackedResources.find(info[index].buffer);
-        if (it != _trackedResources.end())
-        {
-            auto& vec = it->second;
-            vec.erase(std::remove(vec.begin(), vec.end(), &info[index]), vec.end());
-            if (vec.empty())
-                _trackedResources.erase(it);
-        }
+        LOG_TRACK("Heap: {:X}, Index: {}, Resource: {:X}", (size_t) this, index, (size_t) buffers[index]);
+        _trackedResources.Detach(buffers[index], &buffers[index], &owners[index]);
     }
 
     void AttachToNewResource(SIZE_T index) const
     {
-        std::scoped_lock lock(_trackedResourcesMutex);
-        LOG_TRACK("Heap: {:X}, Index: {}, Resource: {:X}, Res: {}x{}, Format: {}", (size_t) this, index,
-                  (size_t) info[index].buffer, info[index].width, info[index].height, (UINT) info[index].format);
-        auto& vec = _trackedResources[info[index].buffer];
-        if (std::find(vec.begin(), vec.end(), &info[index]) == vec.end())
-            vec.push_back(&info[index]);
+        LOG_TRACK("Heap: {:X}, Index: {}, Resource: {:X}", (size_t) this, index, (size_t) buffers[index]);
+        _trackedResources.Attach(buffers[index], &buffers[index], &owners[index]);
     }
 
-    ResourceInfo* GetByCpuHandle(SIZE_T cpuHandle) const
+    void FillSlotInfo(SIZE_T index, ResourceInfo* outInfo) const
+    {
+        const auto& slotMeta = meta[index];
+        const auto& desc = _resourceDescs.Get(slotMeta.descId);
+
+        outInfo->buffer = buffers[index];
+        outInfo->width = desc.width;
+        outInfo->height = desc.height;
+        outInfo->format = desc.format;
+        outInfo->flags = desc.flags;
+        outInfo->type = (ResourceType) slotMeta.type;
+        outInfo->captureInfo = slotMeta.captureInfo;
+    }
+
+    void WriteSlot(SIZE_T index, const ResourceInfo& setInfo) const
+    {
+        buffers[index] = setInfo.buffer;
+        meta[index].descId = _resourceDescs.Intern({ setInfo.width, setInfo.height, setInfo.format, setInfo.flags });
+        meta[index].type = (UINT8) setInfo.type;
+        meta[index].captureInfo = (UINT8) setInfo.captureInfo;
+    }
+
+    bool GetByCpuHandle(SIZE_T cpuHandle, ResourceInfo* outInfo) const
     {
         auto index = (cpuHandle - cpuStart) / increment;
 
         if (index >= numDescriptors)
-            return nullptr;
+            return false;
 
         // std::shared_lock<std::shared_mutex> lock(mutex);
 
-        if (info[index].buffer == nullptr)
-            return nullptr;
+        if (buffers[index] == nullptr)
+            return false;
+
+        FillSlotInfo(index, outInfo);
 
 #ifdef DEBUG_TRACKING
-        TestResource(&info[index]);
+        TestResource(outInfo);
 #endif
 
-        return &info[index];
+        return true;
     }
 
-    ResourceInfo* GetByGpuHandle(SIZE_T gpuHandle) const
+    bool GetByGpuHandle(SIZE_T gpuHandle, ResourceInfo* outInfo) const
     {
         auto index = (gpuHandle - gpuStart) / increment;
 
         if (index >= numDescriptors)
-            return nullptr;
+            return false;
 
         // std::shared_lock<std::shared_mutex> lock(mutex);
 
-        if (info[index].buffer == nullptr)
-            return nullptr;
+        if (buffers[index] == nullptr)
+            return false;
+
+        FillSlotInfo(index, outInfo);
 
 #ifdef DEBUG_TRACKING
-        TestResource(&info[index]);
+        TestResource(outInfo);
 #endif
 
-        return &info[index];
+        return true;
     }
 
     void SetByCpuHandle(SIZE_T cpuHandle, ResourceInfo setInfo) const
@@ -236,10 +604,10 @@ struct HeapInfo
 #ifdef DEBUG_TRACKING
         TestResource(&setInfo);
 #endif
-        if (info[index].buffer != setInfo.buffer)
+        if (buffers[index] != setInfo.buffer)
         {
             DetachFromOldResource(index);
-            info[index] = setInfo;
+            WriteSlot(index, setInfo);
             AttachToNewResource(index);
         }
     }
@@ -257,14 +625,68 @@ struct HeapInfo
         TestResource(&setInfo);
 #endif
 
-        if (info[index].buffer != setInfo.buffer)
+        if (buffers[index] != setInfo.buffer)
         {
             DetachFromOldResource(index);
-            info[index] = setInfo;
+            WriteSlot(index, setInfo);
             AttachToNewResource(index);
         }
     }
 
+    SIZE_T GetIndexByCpuHandle(SIZE_T cpuHandle) const { return (cpuHandle - cpuStart) / increment; }
+
+    // Copies count slots starting at srcIndex of src into this heap starting at destIndex.
+    // Slots are written as a block and the reverse index is updated with one batch.
+    // If src is nullptr destination slots are cleared.
+    void CopyRange(const HeapInfo* src, SIZE_T srcIndex, SIZE_T destIndex, SIZE_T count) const
+    {
+        static thread_local std::vector<ID3D12Resource*> srcBuffers;
+        static thread_local std::vector<DescriptorSlotMeta> srcMeta;
+        static thread_local std::vector<TrackedResourceIndex::SlotChange> changes;
+
+        if (destIndex >= numDescriptors)
+            return;
+
+        count = std::min<SIZE_T>(count, numDescriptors - destIndex);
+
+        SIZE_T srcCount = 0;
+        if (src != nullptr && srcIndex < src->numDescriptors)
+            srcCount = std::min<SIZE_T>(count, src->numDescriptors - srcIndex);
+
+        // Snapshot source first, ranges of the same heap might overlap
+        srcBuffers.clear();
+        srcMeta.clear();
+        if (srcCount != 0)
+        {
+            srcBuffers.assign(&src->buffers[srcIndex], &src->buffers[srcIndex] + srcCount);
+            srcMeta.assign(&src->meta[srcIndex], &src->meta[srcIndex] + srcCount);
+        }
+
+        changes.clear();
+
+        for (SIZE_T i = 0; i < count; i++)
+        {
+            auto& slot = buffers[destIndex + i];
+            ID3D12Resource* newBuffer = i < srcCount ? srcBuffers[i] : nullptr;
+
+            if (slot == newBuffer)
+                continue;
+
+            if (slot != nullptr)
+                changes.push_back({ slot, &slot, &owners[destIndex + i], false });
+
+            slot = newBuffer;
+
+            if (newBuffer != nullptr)
+            {
+                meta[destIndex + i] = srcMeta[i];
+                changes.push_back({ newBuffer, &slot, &owners[destIndex + i], true });
+            }
+        }
+
+        _trackedResources.Apply(changes);
+    }
+
     void ClearByCpuHandle(SIZE_T cpuHandle) const
     {
         auto index = (cpuHandle - cpuStart) / increment;
@@ -274,16 +696,13 @@ struct HeapInfo
 
         // std::unique_lock<std::shared_mutex> lock(mutex);
 
-        if (info[index].buffer != nullptr)
+        if (buffers[index] != nullptr)
         {
-            LOG_TRACK("Resource: {:X}, Res: {}x{}, Format: {}", (size_t) info[index].buffer, info[index].width,
-                      info[index].height, (UINT) info[index].format);
-
+            LOG_TRACK("Resource: {:X}", (size_t) buffers[index]);
             DetachFromOldResource(index);
         }
 
-        info[index].buffer = nullptr;
-        info[index].lastUsedFrame = 0;
+        buffers[index] = nullptr;
     }
 
     void ClearByGpuHandle(SIZE_T gpuHandle) const
@@ -295,16 +714,13 @@ struct HeapInfo
 
         // std::unique_lock<std::shared_mutex> lock(mutex);
 
-        if (info[index].buffer != nullptr)
+        if (buffers[index] != nullptr)
         {
-            LOG_TRACK("Resource: {:X}, Res: {}x{}, Format: {}", (size_t) info[index].buffer, info[index].width,
-                      info[index].height, (UINT) info[index].format);
-
+            LOG_TRACK("Resource: {:X}", (size_t) buffers[index]);
             DetachFromOldResource(index);
         }
 
-        info[index].buffer = nullptr;
-        info[index].lastUsedFrame = 0;
+        buffers[index] = nullptr;
     }
 };
 
@@ -314,35 +730,178 @@ struct ResourceHeapInfo
     SIZE_T gpuStart = NULL;
 };
 
-#ifdef USE_SPINLOCK_MUTEX
-// Force each struct to start on a new cache line
-struct alignas(CACHE_LINE_SIZE) CommandListShard
+struct HeapRange
 {
-    SpinLock mutex;
-    ankerl::unordered_dense::map<ID3D12GraphicsCommandList*,
-                                 ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo>>
-        map;
+    SIZE_T start = NULL;
+    SIZE_T end = NULL;
+    HeapInfo* heap = nullptr;
+};
+
+// Immutable snapshot of active heap ranges, sorted by start address.
+// Rebuilt on heap creation/release and published atomically, readers never lock.
+struct HeapRangeIndex
+{
+    // CPU ranges, [0] CBV_SRV_UAV, [1] RTV
+    std::vector<HeapRange> cpu[2];
+
+    // GPU ranges of shader visible heaps
+    std::vector<HeapRange> gpu;
 
-    char padding[CACHE_LINE_SIZE - (sizeof(SpinLock) + sizeof(void*) % CACHE_LINE_SIZE)] = {};
+    ankerl::unordered_dense::map<ID3D12DescriptorHeap*, HeapInfo*> byHeap;
+
+    static HeapInfo* Find(const std::vector<HeapRange>& ranges, SIZE_T handle)
+    {
+        auto it = std::upper_bound(ranges.begin(), ranges.end(), handle,
+                                   [](SIZE_T value, const HeapRange& range) { return value < range.start; });
+
+        if (it == ranges.begin())
+            return nullptr;
+
+        --it;
+
+        if (handle >= it->end)
+            return nullptr;
+
+        return it->heap;
+    }
+
+    HeapInfo* FindByCpuHandle(SIZE_T cpuHandle) const
+    {
+        auto result = Find(cpu[0], cpuHandle);
+
+        if (result == nullptr)
+            result = Find(cpu[1], cpuHandle);
+
+        return result;
+    }
 };
-#else
-struct alignas(CACHE_LINE_SIZE) CommandListShard
+
+// Epoch based reclamation for HeapInfo.
+// Hooks reading heaps run inside a Guard which publishes the global epoch they started in. Released heaps are
+// retired with the epoch they were unlinked at and deleted once no thread is still inside that or an older epoch.
+// Entering and leaving a guard is wait-free, nested guards on the same thread are allowed.
+class HeapReclaimer
 {
-    std::mutex mutex;
-    ankerl::unordered_dense::map<ID3D12GraphicsCommandList*,
-                                 ankerl::unordered_dense::map<ID3D12Resource*, ResourceInfo>>
-        map;
+    struct alignas(CACHE_LINE_SIZE) ThreadRecord
+    {
+        // 0 when thread is not inside a guard
+        std::atomic<uint64_t> epoch { 0 };
+        std::atomic<bool> inUse { false };
+        UINT depth = 0;
+        ThreadRecord* next = nullptr;
+    };
+
+    struct RetiredHeap
+    {
+        uint64_t epoch = 0;
+        std::unique_ptr<HeapInfo> heap;
+    };
+
+    inline static std::atomic<uint64_t> _globalEpoch { 1 };
+    inline static std::atomic<ThreadRecord*> _records { nullptr };
+
+    // Only accessed while holding the heap creation mutex
+    inline static std::vector<RetiredHeap> _retired;
+
+    static ThreadRecord* AcquireRecord()
+    {
+        // Reuse a record of an exited thread first
+        for (auto record = _records.load(std::memory_order_acquire); record != nullptr; record = record->next)
+        {
+            bool expected = false;
+            if (!record->inUse.load(std::memory_order_relaxed) &&
+                record->inUse.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+            {
+                return record;
+            }
+        }
+
+        auto record = new ThreadRecord();
+        record->inUse.store(true, std::memory_order_relaxed);
+
+        auto head = _records.load(std::memory_order_relaxed);
+        do
+        {
+            record->next = head;
+        } while (!_records.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+
+        return record;
+    }
+
+    struct RecordHolder
+    {
+        ThreadRecord* record = AcquireRecord();
 
-    char padding[CACHE_LINE_SIZE - (sizeof(std::mutex) + sizeof(void*) % CACHE_LINE_SIZE)] = {};
+        ~RecordHolder()
+        {
+            record->epoch.store(0, std::memory_order_release);
+            record->depth = 0;
+            record->inUse.store(false, std::memory_order_release);
+        }
+    };
+
+    static ThreadRecord& LocalRecord()
+    {
+        static thread_local RecordHolder holder;
+        return *holder.record;
+    }
+
+  public:
+    class Guard
+    {
+        ThreadRecord& _record;
+
+      public:
+        Guard() : _record(LocalRecord())
+        {
+            if (_record.depth++ == 0)
+                _record.epoch.store(_globalEpoch.load(std::memory_order_relaxed), std::memory_order_seq_cst);
+        }
+
+        ~Guard()
+        {
+            if (--_record.depth == 0)
+                _record.epoch.store(0, std::memory_order_release);
+        }
+
+        Guard(const Guard&) = delete;
+        Guard& operator=(const Guard&) = delete;
+    };
+
+    // Heap must already be unlinked from the published index. Caller holds the heap creation mutex.
+    static void Retire(std::unique_ptr<HeapInfo> heap)
+    {
+        auto epoch = _globalEpoch.fetch_add(1, std::memory_order_seq_cst);
+        _retired.push_back({ epoch, std::move(heap) });
+    }
+
+    // Deletes retired heaps no thread can still be reading. Caller holds the heap creation mutex.
+    static void Collect()
+    {
+        if (_retired.empty())
+            return;
+
+        auto minEpoch = UINT64_MAX;
+
+        for (auto record = _records.load(std::memory_order_acquire); record != nullptr; record = record->next)
+        {
+            auto epoch = record->epoch.load(std::memory_order_seq_cst);
+
+            if (epoch != 0 && epoch < minEpoch)
+                minEpoch = epoch;
+        }
+
+        std::erase_if(_retired, [minEpoch](const RetiredHeap& retired) { return retired.epoch < minEpoch; });
+    }
+
+    static size_t RetiredCount() { return _retired.size(); }
 };
-#endif
 
 class ResTrack_Dx12
 {
   private:
     inline static bool _presentDone = true;
     inline static std::mutex _drawMutex;
-    inline static bool _useShards = false;
 
     inline static std::mutex _resourceCommandListMutex;
     inline static std::unordered_map<FG_ResourceType, ID3D12GraphicsCommandList*> _resourceCommandList[BUFFER_COUNT];
@@ -430,15 +989,11 @@ class ResTrack_Dx12
 
     static void FillResourceInfo(ID3D12Resource* resource, ResourceInfo* info);
 
-    // Sharding
-    inline static constexpr size_t SHARD_COUNT = 16;
-    inline static CommandListShard _hudlessShards[BUFFER_COUNT][SHARD_COUNT];
+    // Append resource to this thread's hudless candidate log
+    static void AddHudlessCandidate(ID3D12GraphicsCommandList* cmdList, ResourceInfo* resource);
 
-    inline static size_t GetShardIndex(ID3D12GraphicsCommandList* ptr)
-    {
-        auto addr = (UINT64) ptr;
-        return (addr >> 4) % SHARD_COUNT;
-    }
+    // Consume cmdList's candidates from this thread's log and check them for hudless
+    static void CheckHudlessCandidates(ID3D12GraphicsCommandList* cmdList, UINT dispatcher, bool skipChecks);
 
   public:
     static void HookDevice(ID3D12Device* device);
@@ -0,0 +1,201 @@
+#include "ScanCache.h"
+
+#include <Util.h>
+#include <Config.h>
+
+#include <ankerl/unordered_dense.h>
+
+#include <fstream>
+#include <mutex>
+#include <string_view>
+
+constexpr uint32_t CACHE_MAGIC = 0x43534E53; // "SNSC"
+constexpr uint32_t CACHE_VERSION = 1;
+
+// Cache file is started again when it grows above this
+constexpr UINT64 CACHE_FILE_LIMIT = 4ull * 1024 * 1024;
+
+// Longer match lists are not cached
+constexpr uint32_t MAX_CACHED_MATCHES = 16;
+
+struct CacheFileHeader
+{
+    uint32_t magic = CACHE_MAGIC;
+    uint32_t version = CACHE_VERSION;
+};
+
+struct CacheFileRecord
+{
+    UINT64 key = 0;
+    uint32_t matchCount = 0;
+    uint32_t reserved = 0;
+};
+
+static std::mutex _cacheMutex;
+static ankerl::unordered_dense::map<UINT64, std::vector<uint32_t>> _cache;
+static std::once_flag _loadOnce;
+static std::ofstream _cacheFile;
+
+static inline UINT64 Combine(UINT64 hash, UINT64 value)
+{
+    return hash ^ (value + 0x9E3779B97F4A7C15ull + (hash << 6) + (hash >> 2));
+}
+
+static inline UINT64 HashBytes(const void* data, size_t size)
+{
+    return ankerl::unordered_dense::hash<std::string_view> {}(std::string_view((const char*) data, size));
+}
+
+static void WriteRecord(UINT64 key, const std::vector<uint32_t>& rvas)
+{
+    CacheFileRecord record {};
+    record.key = key;
+    record.matchCount = (uint32_t) rvas.size();
+
+    _cacheFile.write((const char*) &record, sizeof(record));
+
+    if (!rvas.empty())
+        _cacheFile.write((const char*) rvas.data(), rvas.size() * sizeof(uint32_t));
+}
+
+static void LoadCacheFile()
+{
+    auto fileName = Util::DllPath().parent_path() / L"OptiScaler_Scan.cache";
+    bool rewrite = true;
+
+    std::lock_guard<std::mutex> lock(_cacheMutex);
+
+    if (std::ifstream file(fileName, std::ios::binary | std::ios::ate); file.is_open())
+    {
+        auto fileSize = (UINT64) file.tellg();
+        file.seekg(0);
+
+        CacheFileHeader header {};
+
+        if (fileSize <= CACHE_FILE_LIMIT && file.read((char*) &header, sizeof(header)) &&
+            header.magic == CACHE_MAGIC && header.version == CACHE_VERSION)
+        {
+            rewrite = false;
+            CacheFileRecord record {};
+
+            while (file.read((char*) &record, sizeof(record)))
+            {
+                if (record.matchCount > MAX_CACHED_MATCHES)
+                {
+                    rewrite = true;
+                    break;
+                }
+
+                std::vector<uint32_t> rvas(record.matchCount);
+
+                if (record.matchCount > 0 && !file.read((char*) rvas.data(), rvas.size() * sizeof(uint32_t)))
+                {
+                    rewrite = true;
+                    break;
+                }
+
+                _cache[record.key] = std::move(rvas);
+            }
+
+            // Partial record from an interrupted write
+            if (!file.eof() || file.gcount() != 0)
+                rewrite = true;
+        }
+    }
+
+    if (rewrite)
+    {
+        _cacheFile.open(fileName, std::ios::binary | std::ios::trunc);
+
+        if (_cacheFile.is_open())
+        {
+            CacheFileHeader header {};
+            _cacheFile.write((const char*) &header, sizeof(header));
+
+            for (const auto& [key, rvas] : _cache)
+                WriteRecord(key, rvas);
+
+            _cacheFile.flush();
+        }
+    }
+    else
+    {
+        _cacheFile.open(fileName, std::ios::binary | std::ios::app);
+    }
+
+    if (!_cacheFile.is_open())
+        LOG_WARN("Can't open scan cache file: {}", wstring_to_string(fileName.wstring()));
+
+    LOG_INFO("Loaded {} pattern scan results from cache", _cache.size());
+}
+
+UINT64 ScanCache::GetModuleKey(HMODULE module)
+{
+    if (module == nullptr || !Config::Instance()->PatternCache.value_or_default())
+        return 0;
+
+    auto base = reinterpret_cast<BYTE*>(module);
+    auto dos = reinterpret_cast<IMAGE_DOS_HEADER*>(base);
+
+    if (dos->e_magic != IMAGE_DOS_SIGNATURE)
+        return 0;
+
+    auto nt = reinterpret_cast<IMAGE_NT_HEADERS64*>(base + dos->e_lfanew);
+
+    if (nt->Signature != IMAGE_NT_SIGNATURE || nt->OptionalHeader.Magic != IMAGE_NT_OPTIONAL_HDR64_MAGIC)
+        return 0;
+
+    // Section table covers sizes, addresses and flags of the code that is scanned
+    auto sections = IMAGE_FIRST_SECTION(nt);
+    auto sectionsHash = HashBytes(sections, nt->FileHeader.NumberOfSections * sizeof(IMAGE_SECTION_HEADER));
+
+    auto key = Combine(nt->FileHeader.TimeDateStamp, nt->OptionalHeader.SizeOfImage);
+    key = Combine(key, nt->OptionalHeader.CheckSum);
+    key = Combine(key, sectionsHash);
+
+    // Never return 0, it means no cache
+    return key != 0 ? key : 1;
+}
+
+UINT64 ScanCache::GetKey(UINT64 moduleKey, const std::vector<uint8_t>& bytes, const std::vector<uint8_t>& mask,
+                         uint32_t startRva, size_t maxMatches)
+{
+    auto key = Combine(moduleKey, HashBytes(bytes.data(), bytes.size()));
+    key = Combine(key, HashBytes(mask.data(), mask.size()));
+    key = Combine(key, startRva);
+    return Combine(key, maxMatches);
+}
+
+bool ScanCache::Get(UINT64 key, std::vector<uint32_t>& rvas)
+{
+    std::call_once(_loadOnce, LoadCacheFile);
+
+    std::lock_guard<std::mutex> lock(_cacheMutex);
+
+    if (auto it = _cache.find(key); it != _cache.end())
+    {
+        rvas = it->second;
+        return true;
+    }
+
+    return false;
+}
+
+void ScanCache::Put(UINT64 key, const std::vector<uint32_t>& rvas)
+{
+    if (rvas.size() > MAX_CACHED_MATCHES)
+        return;
+
+    std::call_once(_loadOnce, LoadCacheFile);
+
+    std::lock_guard<std::mutex> lock(_cacheMutex);
+
+    // Replaces results which failed verification
+    _cache.insert_or_assign(key, rvas);
+
+    if (_cacheFile.is_open())
+    {
+        WriteRecord(key, rvas);
+        _cacheFile.flush();
+    }
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <pch.h>
+
+#include <vector>
+
+// Pattern scan results keyed by module build and scan request, kept in OptiScaler_Scan.cache next to OptiScaler.
+// Matches are stored as RVAs, scanner checks them against the pattern again before using them.
+class ScanCache
+{
+  public:
+    // Identity of the loaded module build, 0 when headers can't be used
+    static UINT64 GetModuleKey(HMODULE module);
+
+    static UINT64 GetKey(UINT64 moduleKey, const std::vector<uint8_t>& bytes, const std::vector<uint8_t>& mask,
+                         uint32_t startRva, size_t maxMatches);
+
+    static bool Get(UINT64 key, std::vector<uint32_t>& rvas);
+    static void Put(UINT64 key, const std::vector<uint32_t>& rvas);
+};
@@ -1,12 +1,190 @@
 #include "scanner.h"
+#include "ScanCache.h"
 
 #include <proxies/KernelBase_Proxy.h>
 
+#include <atomic>
+#include <bit>
+#include <condition_variable>
+#include <intrin.h>
+#include <immintrin.h>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#if defined(__clang__) || defined(__GNUC__)
+#define SCANNER_AVX2 __attribute__((target("avx2")))
+#else
+#define SCANNER_AVX2
+#endif
+
 struct SectionRange
 {
     BYTE *start, *end;
 };
 
+// Sections smaller than this in total are scanned on calling thread only
+constexpr size_t PARALLEL_SCAN_MIN_SIZE = 16 * 1024 * 1024;
+constexpr size_t SCAN_CHUNK_SIZE = 4 * 1024 * 1024;
+constexpr unsigned MAX_SCAN_THREADS = 8;
+
+struct ActiveScan
+{
+    const scanner::Pattern* pattern;
+    size_t maxMatches;
+
+    // Candidates outside of this range are skipped, chunks limit it to their own part
+    uintptr_t startAddress;
+    uintptr_t endAddress;
+
+    std::vector<uintptr_t>* matches;
+};
+
+struct ScanChunk
+{
+    // Candidates are taken from start to end, data is read until dataEnd
+    const uint8_t* start;
+    const uint8_t* end;
+    const uint8_t* dataEnd;
+};
+
+struct ParallelScanJob
+{
+    std::vector<ScanChunk> chunks;
+    std::vector<ActiveScan> scans;
+    size_t maxSize = 0;
+    bool avx2 = false;
+
+    // Matches of every scan, per chunk
+    std::vector<std::vector<std::vector<uintptr_t>>> results;
+
+    // Lowest chunk which found all needed matches of the scan, later chunks skip it
+    std::unique_ptr<std::atomic<size_t>[]> completedChunk;
+
+    std::atomic<size_t> nextChunk { 0 };
+
+    std::mutex doneMutex;
+    std::condition_variable doneCondition;
+    size_t doneChunks = 0;
+};
+
+// Most frequent bytes of x64 code, most common first. Bytes not listed are considered rare
+static constexpr uint8_t _commonBytes[] = { 0x00, 0xFF, 0x48, 0x8B, 0x89, 0xCC, 0x24, 0x4C, 0x8D, 0x0F, 0xE8, 0x44,
+                                            0x83, 0x45, 0x85, 0xC0, 0x01, 0x49, 0x33, 0x20, 0x41, 0x74, 0x10, 0x08,
+                                            0xC3, 0x90, 0x75, 0xEB, 0x28, 0x30, 0x40, 0x18, 0xC4, 0x4D, 0x5C, 0xC7,
+                                            0x02, 0x04, 0x38, 0x50, 0x60, 0x80, 0xF8, 0xC8, 0xD8, 0xE0, 0x03, 0x7C };
+
+static size_t ByteRank(uint8_t value)
+{
+    for (size_t i = 0; i < std::size(_commonBytes); i++)
+    {
+        if (_commonBytes[i] == value)
+            return i;
+    }
+
+    return std::size(_commonBytes);
+}
+
+static int HexValue(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+
+    return -1;
+}
+
+scanner::Pattern::Pattern(const std::string_view pattern)
+{
+    size_t i = 0;
+
+    while (i < pattern.size())
+    {
+        if (pattern[i] == ' ')
+        {
+            i++;
+            continue;
+        }
+
+        auto tokenEnd = pattern.find(' ', i);
+        if (tokenEnd == std::string_view::npos)
+            tokenEnd = pattern.size();
+
+        auto token = pattern.substr(i, tokenEnd - i);
+        i = tokenEnd;
+
+        if (token == "?" || token == "??")
+        {
+            bytes.push_back(0);
+            mask.push_back(0);
+            continue;
+        }
+
+        int high = token.size() == 2 ? HexValue(token[0]) : -1;
+        int low = token.size() == 2 ? HexValue(token[1]) : -1;
+
+        if (high < 0 || low < 0)
+        {
+            LOG_ERROR("Invalid token in pattern: {}", pattern);
+            bytes.clear();
+            mask.clear();
+            return;
+        }
+
+        bytes.push_back((uint8_t) ((high << 4) | low));
+        mask.push_back(0xFF);
+    }
+
+    // Pick two least common fixed bytes as anchors
+    size_t bestRank = SIZE_MAX;
+    size_t secondRank = SIZE_MAX;
+    bool hasFixed = false;
+
+    for (size_t j = 0; j < bytes.size(); j++)
+    {
+        if (mask[j] == 0)
+            continue;
+
+        hasFixed = true;
+        auto rank = ByteRank(bytes[j]);
+
+        // Prefer later bytes on ties, they are less likely to share a common prologue
+        if (rank <= bestRank)
+        {
+            secondRank = bestRank;
+            anchor2Offset = anchorOffset;
+
+            bestRank = rank;
+            anchorOffset = j;
+        }
+        else if (rank <= secondRank)
+        {
+            secondRank = rank;
+            anchor2Offset = j;
+        }
+    }
+
+    if (!hasFixed)
+    {
+        LOG_ERROR("Pattern doesn't have any fixed bytes: {}", pattern);
+        bytes.clear();
+        mask.clear();
+        return;
+    }
+
+    // Single fixed byte
+    if (secondRank == SIZE_MAX)
+        anchor2Offset = anchorOffset;
+
+    anchor = bytes[anchorOffset];
+    anchor2 = bytes[anchor2Offset];
+}
+
 std::vector<SectionRange> GetExecSections(HMODULE hMod)
 {
     std::vector<SectionRange> secs;
@@ -35,169 +213,441 @@ std::vector<SectionRange> GetExecSections(HMODULE hMod)
     return secs;
 }
 
-uintptr_t FindPattern(uintptr_t startAddress, uintptr_t maxSize, const char* mask)
+static bool UseAvx2()
 {
-    std::vector<std::pair<uint8_t, bool>> pattern;
+    static const bool supported = []()
+    {
+        int info[4] {};
+        __cpuid(info, 0);
+
+        if (info[0] < 7)
+            return false;
+
+        // OSXSAVE and AVX, then OS support for saving YMM registers
+        __cpuid(info, 1);
+        if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0)
+            return false;
+
+        if ((_xgetbv(0) & 0x6) != 0x6)
+            return false;
+
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+    }();
+
+    return supported;
+}
+
+// Returns true when scan doesn't need more matches
+static inline bool CheckCandidate(const ActiveScan& active, const uint8_t* candidate)
+{
+    auto address = (uintptr_t) candidate;
+
+    if (address < active.startAddress || address >= active.endAddress || !active.pattern->Matches(candidate))
+        return false;
+
+    active.matches->push_back(address);
+    return active.matches->size() >= active.maxMatches;
+}
 
-    for (size_t i = 0; i < strlen(mask);)
+static void ScanRangeScalar(const uint8_t* position, const uint8_t* end, std::vector<ActiveScan>& active)
+{
+    for (; position < end && !active.empty(); position++)
     {
-        if (mask[i] != '?')
+        for (size_t i = 0; i < active.size();)
         {
-            pattern.emplace_back(static_cast<uint8_t>(strtoul(&mask[i], nullptr, 16)), false);
-            i += 3;
+            auto pattern = active[i].pattern;
+
+            if ((size_t) (end - position) >= pattern->Size() && position[pattern->anchorOffset] == pattern->anchor &&
+                CheckCandidate(active[i], position))
+            {
+                active.erase(active.begin() + i);
+                continue;
+            }
+
+            i++;
         }
-        else
+    }
+}
+
+// Every pattern is checked against the same block before moving on, so section is read only once.
+// Blocks are only processed while all of their candidates can be compared without reading past the end.
+static void ScanRangeSse2(const uint8_t* position, const uint8_t* end, std::vector<ActiveScan>& active,
+                          size_t maxSize)
+{
+    constexpr size_t width = 16;
+
+    while (!active.empty() && (size_t) (end - position) >= width + maxSize)
+    {
+        for (size_t i = 0; i < active.size();)
         {
-            pattern.emplace_back(0x00, true);
-            i += 2;
+            auto pattern = active[i].pattern;
+
+            auto first = _mm_loadu_si128((const __m128i*) (position + pattern->anchorOffset));
+            auto second = _mm_loadu_si128((const __m128i*) (position + pattern->anchor2Offset));
+            auto equal = _mm_and_si128(_mm_cmpeq_epi8(first, _mm_set1_epi8((char) pattern->anchor)),
+                                       _mm_cmpeq_epi8(second, _mm_set1_epi8((char) pattern->anchor2)));
+
+            auto bits = (uint32_t) _mm_movemask_epi8(equal);
+            bool done = false;
+
+            while (bits != 0 && !done)
+            {
+                done = CheckCandidate(active[i], position + std::countr_zero(bits));
+                bits &= bits - 1;
+            }
+
+            if (done)
+                active.erase(active.begin() + i);
+            else
+                i++;
         }
+
+        position += width;
     }
 
-    const auto dataStart = reinterpret_cast<const uint8_t*>(startAddress);
-    const auto dataEnd = dataStart + maxSize + 1;
+    ScanRangeScalar(position, end, active);
+}
 
-    auto sig = std::search(dataStart, dataEnd, pattern.begin(), pattern.end(),
-                           [](uint8_t currentByte, std::pair<uint8_t, bool> Pattern)
-                           { return Pattern.second || (currentByte == Pattern.first); });
+SCANNER_AVX2 static void ScanRangeAvx2(const uint8_t* position, const uint8_t* end, std::vector<ActiveScan>& active,
+                                       size_t maxSize)
+{
+    constexpr size_t width = 32;
 
-    if (sig == dataEnd)
-        return NULL;
+    while (!active.empty() && (size_t) (end - position) >= width + maxSize)
+    {
+        for (size_t i = 0; i < active.size();)
+        {
+            auto pattern = active[i].pattern;
+
+            auto first = _mm256_loadu_si256((const __m256i*) (position + pattern->anchorOffset));
+            auto second = _mm256_loadu_si256((const __m256i*) (position + pattern->anchor2Offset));
+            auto equal = _mm256_and_si256(_mm256_cmpeq_epi8(first, _mm256_set1_epi8((char) pattern->anchor)),
+                                          _mm256_cmpeq_epi8(second, _mm256_set1_epi8((char) pattern->anchor2)));
+
+            auto bits = (uint32_t) _mm256_movemask_epi8(equal);
+            bool done = false;
+
+            while (bits != 0 && !done)
+            {
+                done = CheckCandidate(active[i], position + std::countr_zero(bits));
+                bits &= bits - 1;
+            }
+
+            if (done)
+                active.erase(active.begin() + i);
+            else
+                i++;
+        }
 
-    return std::distance(dataStart, sig) + startAddress;
+        position += width;
+    }
+
+    ScanRangeScalar(position, end, active);
 }
 
-uintptr_t scanner::GetAddress(const std::wstring_view moduleName, const std::string_view pattern, ptrdiff_t offset,
-                              uintptr_t startAddress)
+static void ScanRange(const uint8_t* position, const uint8_t* end, std::vector<ActiveScan>& active, size_t maxSize,
+                      bool avx2)
 {
-    uintptr_t address = NULL;
-    auto module = GetModuleHandle(moduleName.data());
-
-    if (module == nullptr)
-        return NULL;
+    if (avx2)
+        ScanRangeAvx2(position, end, active, maxSize);
+    else
+        ScanRangeSse2(position, end, active, maxSize);
+}
 
-    auto sections = GetExecSections(module);
+static void RunScanChunks(ParallelScanJob& job)
+{
+    std::vector<ActiveScan> active;
 
-    if (startAddress != 0)
+    while (true)
     {
-        for (size_t i = 0; i < sections.size(); i++)
+        auto index = job.nextChunk.fetch_add(1);
+
+        if (index >= job.chunks.size())
+            return;
+
+        auto& chunk = job.chunks[index];
+        active.clear();
+
+        for (size_t i = 0; i < job.scans.size(); i++)
         {
-            auto section = &sections[i];
+            // An earlier chunk already has all matches of this scan
+            if (job.completedChunk[i].load() < index)
+                continue;
+
+            auto item = job.scans[i];
+            item.startAddress = std::max(item.startAddress, (uintptr_t) chunk.start);
+            item.endAddress = (uintptr_t) chunk.end;
+            item.matches = &job.results[index][i];
+            active.push_back(item);
+        }
 
-            if (((uintptr_t) section->start < startAddress && (uintptr_t) section->end > startAddress))
-            {
-                address = FindPattern(startAddress, (uintptr_t) section->end - startAddress, pattern.data());
+        if (!active.empty())
+            ScanRange(chunk.start, chunk.dataEnd, active, job.maxSize, job.avx2);
 
-                if (address != NULL)
-                    break;
-            }
-            else if ((uintptr_t) section->start > startAddress)
-            {
-                address = FindPattern((uintptr_t) section->start, (uintptr_t) section->end - (uintptr_t) section->start,
-                                      pattern.data());
+        for (size_t i = 0; i < job.scans.size(); i++)
+        {
+            if (job.results[index][i].size() < job.scans[i].maxMatches)
+                continue;
 
-                if (address != NULL)
+            // Keep the lowest one
+            auto completed = job.completedChunk[i].load();
+            while (index < completed)
+            {
+                if (job.completedChunk[i].compare_exchange_weak(completed, index))
                     break;
             }
         }
+
+        {
+            std::lock_guard<std::mutex> lock(job.doneMutex);
+            job.doneChunks++;
+        }
+
+        job.doneCondition.notify_one();
     }
-    else
+}
+
+// Splits ranges to overlapping chunks and scans them on worker threads. Calling thread processes chunks too and
+// only waits for chunks which are already taken, so scanning completes even when workers can't start yet
+// (e.g. called from DllMain while loader lock is held).
+static void ScanParallel(const std::vector<ScanChunk>& ranges, const std::vector<ActiveScan>& active, size_t maxSize,
+                         bool avx2, unsigned threadCount)
+{
+    auto job = std::make_shared<ParallelScanJob>();
+
+    for (auto& range : ranges)
     {
-        for (size_t i = 0; i < sections.size(); i++)
+        for (auto start = range.start; start < range.end;)
         {
-            auto section = &sections[i];
-            address = FindPattern((uintptr_t) section->start, (uintptr_t) section->end - (uintptr_t) section->start,
-                                  pattern.data());
+            auto end = (size_t) (range.end - start) > SCAN_CHUNK_SIZE ? start + SCAN_CHUNK_SIZE : range.end;
 
-            if (address != NULL)
-                break;
+            // Overlap for patterns crossing chunk border
+            auto dataEnd = (size_t) (range.end - end) > maxSize - 1 ? end + maxSize - 1 : range.end;
+
+            job->chunks.push_back({ start, end, dataEnd });
+            start = end;
         }
     }
 
-    if (address != NULL)
+    job->scans = active;
+    job->maxSize = maxSize;
+    job->avx2 = avx2;
+    job->results.assign(job->chunks.size(), std::vector<std::vector<uintptr_t>>(active.size()));
+    job->completedChunk = std::make_unique<std::atomic<size_t>[]>(active.size());
+
+    for (size_t i = 0; i < active.size(); i++)
+        job->completedChunk[i].store(SIZE_MAX);
+
+    auto helpers = std::min((size_t) threadCount - 1, job->chunks.size() - 1);
+
+    for (size_t i = 0; i < helpers; i++)
     {
-        return (address + offset);
+        try
+        {
+            std::thread([job]() { RunScanChunks(*job); }).detach();
+        }
+        catch (const std::system_error& e)
+        {
+            LOG_WARN("Can't create pattern scan thread: {}", e.what());
+            break;
+        }
     }
-    else
+
+    RunScanChunks(*job);
+
     {
-        return NULL;
+        std::unique_lock<std::mutex> lock(job->doneMutex);
+        job->doneCondition.wait(lock, [&job]() { return job->doneChunks == job->chunks.size(); });
     }
+
+    // Chunks are in address order, later chunks than completed one didn't check the scan
+    for (size_t i = 0; i < active.size(); i++)
+    {
+        auto& matches = *active[i].matches;
+        auto lastChunk = std::min(job->completedChunk[i].load(), job->chunks.size() - 1);
+
+        for (size_t chunk = 0; chunk <= lastChunk; chunk++)
+        {
+            for (auto address : job->results[chunk][i])
+            {
+                if (matches.size() >= active[i].maxMatches)
+                    break;
+
+                matches.push_back(address);
+            }
+        }
+    }
+
+    LOG_DEBUG("Scanned {} chunks with {} threads", job->chunks.size(), helpers + 1);
 }
 
-uintptr_t scanner::GetAddress(HMODULE module, const std::string_view pattern, ptrdiff_t offset, uintptr_t startAddress)
+// Cached results are from the same module build, but pattern is checked again in case memory was patched
+static bool UseCachedMatches(HMODULE module, const std::vector<SectionRange>& sections, scanner::PatternScan& scan,
+                             const std::vector<uint32_t>& rvas)
 {
-    if (module == nullptr)
-        return NULL;
+    auto base = (uintptr_t) module;
 
-    uintptr_t address = NULL;
-    auto sections = GetExecSections(module);
-
-    if (startAddress != 0)
+    for (auto rva : rvas)
     {
-        for (size_t i = 0; i < sections.size(); i++)
-        {
-            auto section = &sections[i];
+        auto address = base + rva;
+        bool valid = false;
 
-            if (((uintptr_t) section->start < startAddress && (uintptr_t) section->end > startAddress))
+        if (address >= scan.startAddress)
+        {
+            for (auto& section : sections)
             {
-                address = FindPattern(startAddress, (uintptr_t) section->end - startAddress, pattern.data());
-
-                if (address != NULL)
+                if (address >= (uintptr_t) section.start &&
+                    address + scan.pattern->Size() <= (uintptr_t) section.end)
+                {
+                    valid = scan.pattern->Matches((const uint8_t*) address);
                     break;
+                }
             }
-            else if ((uintptr_t) section->start > startAddress)
-            {
-                address = FindPattern((uintptr_t) section->start, (uintptr_t) section->end - (uintptr_t) section->start,
-                                      pattern.data());
+        }
 
-                if (address != NULL)
-                    break;
-            }
+        if (!valid)
+        {
+            scan.matches.clear();
+            return false;
         }
+
+        scan.matches.push_back(address);
     }
-    else
+
+    return true;
+}
+
+void scanner::Scan(HMODULE module, std::span<PatternScan> scans)
+{
+    std::vector<ActiveScan> active;
+    std::vector<std::pair<PatternScan*, UINT64>> scanned;
+    std::vector<uint32_t> rvas;
+    size_t maxSize = 0;
+
+    auto sections = GetExecSections(module);
+    auto moduleKey = ScanCache::GetModuleKey(module);
+    auto cacheHits = 0;
+
+    for (auto& scan : scans)
     {
-        for (size_t i = 0; i < sections.size(); i++)
+        scan.matches.clear();
+
+        if (module == nullptr || scan.pattern == nullptr || !scan.pattern->IsValid() || scan.maxMatches == 0)
+            continue;
+
+        UINT64 cacheKey = 0;
+
+        if (moduleKey != 0)
         {
-            auto section = &sections[i];
-            address = FindPattern((uintptr_t) section->start, (uintptr_t) section->end - (uintptr_t) section->start,
-                                  pattern.data());
+            auto startRva = scan.startAddress > (uintptr_t) module ? scan.startAddress - (uintptr_t) module : 0;
+            cacheKey = ScanCache::GetKey(moduleKey, scan.pattern->bytes, scan.pattern->mask, (uint32_t) startRva,
+                                         scan.maxMatches);
 
-            if (address != NULL)
-                break;
+            if (ScanCache::Get(cacheKey, rvas) && UseCachedMatches(module, sections, scan, rvas))
+            {
+                cacheHits++;
+                continue;
+            }
+
+            scanned.push_back({ &scan, cacheKey });
         }
+
+        active.push_back({ scan.pattern, scan.maxMatches, scan.startAddress, UINTPTR_MAX, &scan.matches });
+        maxSize = std::max(maxSize, scan.pattern->Size());
     }
 
-    if (address != NULL)
+    if (cacheHits > 0)
+    {
+        LOG_DEBUG("{} of {} pattern scans found in cache", cacheHits, scans.size());
+    }
+
+    if (active.empty())
+        return;
+
+    // Skip the part before every scan's start address
+    auto lowest = active[0].startAddress;
+    for (auto& item : active)
+        lowest = std::min(lowest, item.startAddress);
+
+    std::vector<ScanChunk> ranges;
+    size_t totalSize = 0;
+
+    for (auto& section : sections)
     {
-        return (address + offset);
+        if ((uintptr_t) section.end <= lowest)
+            continue;
+
+        auto start = (const uint8_t*) std::max((uintptr_t) section.start, lowest);
+        ranges.push_back({ start, section.end, section.end });
+        totalSize += section.end - start;
+    }
+
+    auto avx2 = UseAvx2();
+    auto threadCount = std::min(std::thread::hardware_concurrency(), MAX_SCAN_THREADS);
+
+    if (totalSize >= PARALLEL_SCAN_MIN_SIZE && threadCount > 1)
+    {
+        ScanParallel(ranges, active, maxSize, avx2, threadCount);
     }
     else
     {
-        return NULL;
+        for (auto& range : ranges)
+        {
+            if (active.empty())
+                break;
+
+            ScanRange(range.start, range.end, active, maxSize, avx2);
+        }
+    }
+
+    for (auto& [scan, cacheKey] : scanned)
+    {
+        rvas.clear();
+
+        for (auto address : scan->matches)
+            rvas.push_back((uint32_t) (address - (uintptr_t) module));
+
+        ScanCache::Put(cacheKey, rvas);
     }
 }
 
-uintptr_t scanner::GetOffsetFromInstruction(const std::wstring_view moduleName, const std::string_view pattern,
-                                            ptrdiff_t offset)
+uintptr_t scanner::GetAddress(const std::wstring_view moduleName, const std::string_view pattern, ptrdiff_t offset,
+                              uintptr_t startAddress)
 {
     auto module = GetModuleHandle(moduleName.data());
 
     if (module == nullptr)
         return NULL;
 
-    uintptr_t address = NULL;
+    return GetAddress(module, pattern, offset, startAddress);
+}
 
-    auto sections = GetExecSections(module);
+uintptr_t scanner::GetAddress(HMODULE module, const std::string_view pattern, ptrdiff_t offset, uintptr_t startAddress)
+{
+    if (module == nullptr)
+        return NULL;
 
-    for (size_t i = 0; i < sections.size(); i++)
-    {
-        auto section = &sections[i];
-        address = FindPattern((uintptr_t) section->start, (uintptr_t) section->end - (uintptr_t) section->start,
-                              pattern.data());
+    return GetAddress(module, Pattern(pattern), offset, startAddress);
+}
 
-        if (address != NULL)
-            break;
-    }
+uintptr_t scanner::GetAddress(HMODULE module, const Pattern& pattern, ptrdiff_t offset, uintptr_t startAddress)
+{
+    PatternScan scan { &pattern, startAddress, 1, {} };
+    Scan(module, std::span(&scan, 1));
+
+    return scan.Address(offset);
+}
+
+uintptr_t scanner::GetOffsetFromInstruction(const std::wstring_view moduleName, const std::string_view pattern,
+                                            ptrdiff_t offset)
+{
+    auto module = GetModuleHandle(moduleName.data());
+
+    if (module == nullptr)
+        return NULL;
+
+    uintptr_t address = GetAddress(module, pattern);
 
     if (address != NULL)
     {
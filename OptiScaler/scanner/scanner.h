@@ -2,11 +2,71 @@
 
 #include <pch.h>
 
+#include <span>
+#include <vector>
+
 namespace scanner
 {
+// Byte pattern in "48 8B ? ? 89" form, compiled once and reused for any number of scans
+struct Pattern
+{
+    // Fixed bytes are stored masked, wildcards are 0 in both
+    std::vector<uint8_t> bytes;
+    std::vector<uint8_t> mask;
+
+    // Two least common fixed bytes of the pattern, used for filtering candidates before full compare
+    size_t anchorOffset = 0;
+    uint8_t anchor = 0;
+    size_t anchor2Offset = 0;
+    uint8_t anchor2 = 0;
+
+    Pattern() = default;
+    explicit Pattern(const std::string_view pattern);
+
+    bool IsValid() const { return !bytes.empty(); }
+    size_t Size() const { return bytes.size(); }
+
+    bool Matches(const uint8_t* data) const
+    {
+        for (size_t i = 0; i < bytes.size(); i++)
+        {
+            if ((data[i] & mask[i]) != bytes[i])
+                return false;
+        }
+
+        return true;
+    }
+};
+
+struct PatternScan
+{
+    const Pattern* pattern = nullptr;
+
+    // Matches before this address are skipped
+    uintptr_t startAddress = 0;
+
+    // Scanning stops for this pattern after this many matches
+    size_t maxMatches = 1;
+
+    // Filled by Scan in address order
+    std::vector<uintptr_t> matches;
+
+    uintptr_t Address(ptrdiff_t offset = 0, size_t index = 0) const
+    {
+        if (index >= matches.size())
+            return NULL;
+
+        return matches[index] + offset;
+    }
+};
+
+// Scans executable sections of the module once for all requested patterns
+void Scan(HMODULE module, std::span<PatternScan> scans);
+
 uintptr_t GetAddress(const std::wstring_view moduleName, const std::string_view pattern, ptrdiff_t offset = 0,
                      uintptr_t startAddress = 0);
 uintptr_t GetAddress(HMODULE module, const std::string_view pattern, ptrdiff_t offset = 0, uintptr_t startAddress = 0);
+uintptr_t GetAddress(HMODULE module, const Pattern& pattern, ptrdiff_t offset = 0, uintptr_t startAddress = 0);
 uintptr_t GetOffsetFromInstruction(const std::wstring_view moduleName, const std::string_view pattern,
                                    ptrdiff_t offset = 0);
 
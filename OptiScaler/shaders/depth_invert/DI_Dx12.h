@@ -1,36 +0,0 @@
-#pragma once
-
-#include <pch.h>
-
-#include <d3d12.h>
-#include <d3dx/d3dx12.h>
-#include <shaders/Shader_Dx12Utils.h>
-#include <shaders/Shader_Dx12.h>
-
-#define DI_NUM_OF_HEAPS 2
-
-class DI_Dx12 : public Shader_Dx12
-{
-  private:
-    FrameDescriptorHeap _frameHeaps[DI_NUM_OF_HEAPS];
-
-    ID3D12Resource* _buffer = nullptr;
-    D3D12_RESOURCE_STATES _bufferState = D3D12_RESOURCE_STATE_COMMON;
-
-    uint32_t InNumThreadsX = 16;
-    uint32_t InNumThreadsY = 16;
-
-  public:
-    bool CreateBufferResource(ID3D12Device* InDevice, ID3D12Resource* InSource, uint64_t InWidth, uint32_t InHeight,
-                              D3D12_RESOURCE_STATES InState);
-    void SetBufferState(ID3D12GraphicsCommandList* InCommandList, D3D12_RESOURCE_STATES InState);
-    bool Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdList, ID3D12Resource* InResource,
-                  ID3D12Resource* OutResource);
-
-    ID3D12Resource* Buffer() { return _buffer; }
-    bool CanRender() const { return _init && _buffer != nullptr; }
-
-    DI_Dx12(std::string InName, ID3D12Device* InDevice);
-
-    ~DI_Dx12();
-};
@@ -0,0 +1,100 @@
+#pragma once
+#include <pch.h>
+#include <d3dcompiler.h>
+#include <DirectXMath.h>
+
+using namespace DirectX;
+
+struct alignas(256) FGPConstants
+{
+    UINT width;
+    UINT height;
+    UINT offset;
+    UINT flags;
+    float depthScale;
+};
+
+// Flag values must match FGP_Flags
+inline static std::string fgpCode = R"(
+cbuffer Params : register(b0)
+{
+    uint width;
+    uint height;
+    uint offset;
+    uint flags;
+    float depthScale;
+};
+
+#define FLAG_FLIP 1
+#define FLAG_NEGATE_Y 2
+#define FLAG_DEPTH_SCALE 4
+#define FLAG_DEPTH_INVERT 8
+
+// Input texture
+Texture2D<float4> SourceTexture : register(t0);
+
+// Output texture
+RWTexture2D<float4> DestinationTexture : register(u0);
+
+// Compute shader thread group size
+[numthreads(16, 16, 1)]
+void CSMain(uint3 dispatchThreadID : SV_DispatchThreadID)
+{
+    uint2 pixelCoord = dispatchThreadID.xy;
+
+    if (flags & FLAG_FLIP)
+    {
+        if (dispatchThreadID.y < offset || dispatchThreadID.y > (height + offset))
+            return;
+
+        pixelCoord.y = height - dispatchThreadID.y - offset;
+    }
+    else if (dispatchThreadID.x > width || dispatchThreadID.y > height)
+    {
+        return;
+    }
+
+    float4 srcColor = SourceTexture.Load(int3(dispatchThreadID.xy, 0));
+
+    if (flags & FLAG_NEGATE_Y)
+        srcColor = float4(srcColor.r, -srcColor.g, 0, 0);
+
+    if (flags & FLAG_DEPTH_SCALE)
+        srcColor.r = saturate(srcColor.r / depthScale);
+
+    if (flags & FLAG_DEPTH_INVERT)
+        srcColor.r = 1.0 - srcColor.r;
+
+    DestinationTexture[pixelCoord] = srcColor;
+}
+)";
+
+inline static ID3DBlob* FGP_CompileShader(const char* shaderCode, const char* entryPoint, const char* target)
+{
+    ID3DBlob* shaderBlob = nullptr;
+    ID3DBlob* errorBlob = nullptr;
+
+    HRESULT hr = D3DCompile(shaderCode, strlen(shaderCode), nullptr, nullptr, nullptr, entryPoint, target,
+                            D3DCOMPILE_OPTIMIZATION_LEVEL3, 0, &shaderBlob, &errorBlob);
+
+    if (FAILED(hr))
+    {
+        LOG_ERROR("error while compiling shader");
+
+        if (errorBlob)
+        {
+            LOG_ERROR("error while compiling shader : {0}", (char*) errorBlob->GetBufferPointer());
+            errorBlob->Release();
+        }
+
+        if (shaderBlob)
+            shaderBlob->Release();
+
+        return nullptr;
+    }
+
+    if (errorBlob)
+        errorBlob->Release();
+
+    return shaderBlob;
+}
@@ -1,14 +1,12 @@
-#include "RF_Dx12.h"
+#include "FGP_Dx12.h"
 
-#include "RF_Common.h"
+#include "FGP_Common.h"
 
 #include <Config.h>
 #include <State.h>
 
-#include "precompiled/RF_Shader.h"
-
-bool RF_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdList, ID3D12Resource* InResource,
-                       ID3D12Resource* OutResource, UINT64 width, UINT height, bool velocity)
+bool FGP_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdList, ID3D12Resource* InResource,
+                        ID3D12Resource* OutResource, UINT64 width, UINT height, uint32_t flags, float depthScale)
 {
     if (!_init || InDevice == nullptr || InCmdList == nullptr || InResource == nullptr || OutResource == nullptr)
         return false;
@@ -16,7 +14,7 @@ bool RF_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdL
     LOG_DEBUG("[{0}] Start!", _name);
 
     _counter++;
-    _counter = _counter % RF_NUM_OF_HEAPS;
+    _counter = _counter % FGP_NUM_OF_HEAPS;
     FrameDescriptorHeap& currentHeap = _frameHeaps[_counter];
 
     auto inDesc = InResource->GetDesc();
@@ -37,14 +35,18 @@ bool RF_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdL
     uavDesc.Texture2D.MipSlice = 0;
     InDevice->CreateUnorderedAccessView(OutResource, nullptr, &uavDesc, currentHeap.GetUavCPU(0));
 
-    RFConstants constants {};
+    FGPConstants constants {};
 
     constants.height = height - 1;
     constants.width = static_cast<UINT>(width - 1);
-    constants.offset = Config::Instance()->FGResourceFlipOffset.value_or_default() ? inDesc.Height - height : 0;
-    constants.velocity = velocity ? 1 : 0;
+    constants.offset = ((flags & FGP_Flip) != 0 && Config::Instance()->FGResourceFlipOffset.value_or_default())
+                           ? inDesc.Height - height
+                           : 0;
+    constants.flags = flags;
+    constants.depthScale = depthScale;
 
-    LOG_DEBUG("Width: {}, Height: {}, Offset", constants.width, constants.height, constants.offset);
+    LOG_DEBUG("Width: {}, Height: {}, Offset: {}, Flags: {:X}", constants.width, constants.height, constants.offset,
+              flags);
 
     // Copy the updated constant buffer data to the constant buffer resource
     BYTE* pCBDataBegin;
@@ -80,28 +82,16 @@ bool RF_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdL
 
     InCmdList->SetComputeRootDescriptorTable(0, currentHeap.GetTableGPUStart());
 
-    UINT dispatchWidth = 0;
-    UINT dispatchHeight = 0;
-
-    if ((State::Instance().currentFeature->GetFeatureFlags() & NVSDK_NGX_DLSS_Feature_Flags_MVLowRes) == 0)
-    {
-        dispatchWidth =
-            static_cast<UINT>((State::Instance().currentFeature->DisplayWidth() + InNumThreadsX - 1) / InNumThreadsX);
-        dispatchHeight = (State::Instance().currentFeature->DisplayHeight() + InNumThreadsY - 1) / InNumThreadsY;
-    }
-    else
-    {
-        dispatchWidth =
-            static_cast<UINT>((State::Instance().currentFeature->RenderWidth() + InNumThreadsX - 1) / InNumThreadsX);
-        dispatchHeight = (State::Instance().currentFeature->RenderHeight() + InNumThreadsY - 1) / InNumThreadsY;
-    }
+    // Offset rows are only read when flipping
+    UINT dispatchWidth = static_cast<UINT>((width + InNumThreadsX - 1) / InNumThreadsX);
+    UINT dispatchHeight = (height + constants.offset + InNumThreadsY - 1) / InNumThreadsY;
 
     InCmdList->Dispatch(dispatchWidth, dispatchHeight, 1);
 
     return true;
 }
 
-RF_Dx12::RF_Dx12(std::string InName, ID3D12Device* InDevice) : Shader_Dx12(InName, InDevice)
+FGP_Dx12::FGP_Dx12(std::string InName, ID3D12Device* InDevice) : Shader_Dx12(InName, InDevice)
 {
     if (InDevice == nullptr)
     {
@@ -128,7 +118,7 @@ RF_Dx12::RF_Dx12(std::string InName, ID3D12Device* InDevice) : Shader_Dx12(InNam
     CD3DX12_VERSIONED_ROOT_SIGNATURE_DESC rootSigDesc;
     rootSigDesc.Init_1_1(1, &rootParameter);
 
-    D3D12_RESOURCE_DESC desc = CD3DX12_RESOURCE_DESC::Buffer(sizeof(RFConstants));
+    D3D12_RESOURCE_DESC desc = CD3DX12_RESOURCE_DESC::Buffer(sizeof(FGPConstants));
     auto heapProps = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
 
     auto result =
@@ -183,51 +173,33 @@ RF_Dx12::RF_Dx12(std::string InName, ID3D12Device* InDevice) : Shader_Dx12(InNam
         return;
     }
 
-    if (Config::Instance()->UsePrecompiledShaders.value_or_default())
-    {
-        D3D12_COMPUTE_PIPELINE_STATE_DESC computePsoDesc = {};
-        computePsoDesc.pRootSignature = _rootSignature;
-        computePsoDesc.Flags = D3D12_PIPELINE_STATE_FLAG_NONE;
-        computePsoDesc.CS = CD3DX12_SHADER_BYTECODE(reinterpret_cast<const void*>(RF_cso), sizeof(RF_cso));
-        auto hr = InDevice->CreateComputePipelineState(&computePsoDesc, __uuidof(ID3D12PipelineState*),
-                                                       (void**) &_pipelineState);
+    // There is no precompiled version of this shader, compile it even when UsePrecompiledShaders is set
+    ID3DBlob* _recEncodeShader = nullptr;
 
-        if (FAILED(hr))
-        {
-            LOG_ERROR("[{0}] CreateComputePipelineState error: {1:X}", _name, hr);
-            return;
-        }
-    }
-    else
-    {
-        // Compile shader blobs
-        ID3DBlob* _recEncodeShader = nullptr;
-
-        _recEncodeShader = RF_CompileShader(rfCode.c_str(), "CSMain", "cs_5_0");
+    _recEncodeShader = FGP_CompileShader(fgpCode.c_str(), "CSMain", "cs_5_0");
 
-        if (_recEncodeShader == nullptr)
-        {
-            LOG_ERROR("[{0}] CompileShader error!", _name);
-            return;
-        }
+    if (_recEncodeShader == nullptr)
+    {
+        LOG_ERROR("[{0}] CompileShader error!", _name);
+        return;
+    }
 
-        // create pso objects
-        if (!Shader_Dx12::CreateComputeShader(InDevice, _rootSignature, &_pipelineState, _recEncodeShader))
-        {
-            LOG_ERROR("[{0}] CreateComputeShader error!", _name);
-            return;
-        }
+    // create pso objects
+    if (!Shader_Dx12::CreateComputeShader(InDevice, _rootSignature, &_pipelineState, _recEncodeShader))
+    {
+        LOG_ERROR("[{0}] CreateComputeShader error!", _name);
+        return;
+    }
 
-        if (_recEncodeShader != nullptr)
-        {
-            _recEncodeShader->Release();
-            _recEncodeShader = nullptr;
-        }
+    if (_recEncodeShader != nullptr)
+    {
+        _recEncodeShader->Release();
+        _recEncodeShader = nullptr;
     }
 
     ScopedSkipHeapCapture skipHeapCapture {};
 
-    for (int i = 0; i < RF_NUM_OF_HEAPS; i++)
+    for (int i = 0; i < FGP_NUM_OF_HEAPS; i++)
     {
         if (!_frameHeaps[i].Initialize(InDevice, 1, 1, 1))
         {
@@ -240,7 +212,7 @@ RF_Dx12::RF_Dx12(std::string InName, ID3D12Device* InDevice) : Shader_Dx12(InNam
     _init = true;
 }
 
-RF_Dx12::~RF_Dx12()
+FGP_Dx12::~FGP_Dx12()
 {
     if (!_init || State::Instance().isShuttingDown)
         return;
@@ -257,7 +229,7 @@ RF_Dx12::~RF_Dx12()
         _rootSignature = nullptr;
     }
 
-    for (int i = 0; i < RF_NUM_OF_HEAPS; i++)
+    for (int i = 0; i < FGP_NUM_OF_HEAPS; i++)
     {
         _frameHeaps[i].ReleaseHeaps();
     }
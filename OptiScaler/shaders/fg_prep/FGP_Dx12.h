@@ -0,0 +1,37 @@
+#pragma once
+
+#include <pch.h>
+
+#include <d3d12.h>
+#include <d3dx/d3dx12.h>
+#include <shaders/Shader_Dx12Utils.h>
+#include <shaders/Shader_Dx12.h>
+
+#define FGP_NUM_OF_HEAPS 2
+
+// Steps of FG input preparation, any combination is done in a single pass
+enum FGP_Flags : uint32_t
+{
+    FGP_None = 0,
+    FGP_Flip = 1 << 0,        // Vertical flip, uses FGResourceFlipOffset
+    FGP_NegateY = 1 << 1,     // Velocity of flipped motion vectors
+    FGP_DepthScale = 1 << 2,  // saturate(depth / depthScale)
+    FGP_DepthInvert = 1 << 3, // 1 - depth, after scaling
+};
+
+class FGP_Dx12 : public Shader_Dx12
+{
+  private:
+    FrameDescriptorHeap _frameHeaps[FGP_NUM_OF_HEAPS];
+
+    uint32_t InNumThreadsX = 16;
+    uint32_t InNumThreadsY = 16;
+
+  public:
+    bool Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdList, ID3D12Resource* InResource,
+                  ID3D12Resource* OutResource, UINT64 width, UINT height, uint32_t flags, float depthScale = 1.0f);
+
+    FGP_Dx12(std::string InName, ID3D12Device* InDevice);
+
+    ~FGP_Dx12();
+};
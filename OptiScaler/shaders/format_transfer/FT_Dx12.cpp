@@ -64,7 +64,7 @@ void FT_Dx12::SetBufferState(ID3D12GraphicsCommandList* InCommandList, D3D12_RES
 }
 
 bool FT_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdList, ID3D12Resource* InResource,
-                       ID3D12Resource* OutResource)
+                       ID3D12Resource* OutResource, UINT InWidth, UINT InHeight)
 {
     if (!_init || InDevice == nullptr || InCmdList == nullptr || InResource == nullptr || OutResource == nullptr)
         return false;
@@ -106,8 +106,11 @@ bool FT_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdL
     UINT dispatchWidth = 0;
     UINT dispatchHeight = 0;
 
-    dispatchWidth = static_cast<UINT>((inDesc.Width + InNumThreadsX - 1) / InNumThreadsX);
-    dispatchHeight = (inDesc.Height + InNumThreadsY - 1) / InNumThreadsY;
+    UINT64 width = (InWidth > 0 && InWidth < inDesc.Width) ? InWidth : inDesc.Width;
+    UINT height = (InHeight > 0 && InHeight < inDesc.Height) ? InHeight : inDesc.Height;
+
+    dispatchWidth = static_cast<UINT>((width + InNumThreadsX - 1) / InNumThreadsX);
+    dispatchHeight = (height + InNumThreadsY - 1) / InNumThreadsY;
 
     InCmdList->Dispatch(dispatchWidth, dispatchHeight, 1);
 
@@ -27,8 +27,9 @@ class FT_Dx12 : public Shader_Dx12
   public:
     bool CreateBufferResource(ID3D12Device* InDevice, ID3D12Resource* InSource, D3D12_RESOURCE_STATES InState);
     void SetBufferState(ID3D12GraphicsCommandList* InCommandList, D3D12_RESOURCE_STATES InState);
+    // InWidth & InHeight limit the dispatch to top left part of the input, 0 for full size
     bool Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCmdList, ID3D12Resource* InResource,
-                  ID3D12Resource* OutResource);
+                  ID3D12Resource* OutResource, UINT InWidth = 0, UINT InHeight = 0);
 
     ID3D12Resource* Buffer() { return _buffer; }
     bool CanRender() const { return _init && _buffer != nullptr; }
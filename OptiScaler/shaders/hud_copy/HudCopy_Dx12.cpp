@@ -23,7 +23,7 @@ void HudCopy_Dx12::ResourceBarrier(ID3D12GraphicsCommandList* cmdList, ID3D12Res
 
 bool HudCopy_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* cmdList, ID3D12Resource* hudless,
                             ID3D12Resource* present, D3D12_RESOURCE_STATES hudlessState,
-                            D3D12_RESOURCE_STATES presentState, float hudDetectionThreshold)
+                            D3D12_RESOURCE_STATES presentState, float hudDetectionThreshold, const D3D12_BOX* box)
 {
     if (!_init || InDevice == nullptr || hudless == nullptr || present == nullptr || cmdList == nullptr)
         return false;
@@ -53,7 +53,9 @@ bool HudCopy_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* c
 
     ResourceBarrier(cmdList, present, presentState, D3D12_RESOURCE_STATE_COPY_SOURCE);
 
-    cmdList->CopyResource(_buffer, present);
+    // Shader writes the whole box and only the box is copied back
+    if (box == nullptr)
+        cmdList->CopyResource(_buffer, present);
 
     // Make sure present is in D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE
     ResourceBarrier(cmdList, present, D3D12_RESOURCE_STATE_COPY_SOURCE, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE);
@@ -121,15 +123,37 @@ bool HudCopy_Dx12::Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* c
 
     cmdList->SetComputeRootDescriptorTable(0, currentHeap.GetTableGPUStart());
 
-    UINT dispatchWidth = static_cast<UINT>((presentDesc.Width + InNumThreadsX - 1) / InNumThreadsX);
-    UINT dispatchHeight = (presentDesc.Height + InNumThreadsY - 1) / InNumThreadsY;
+    UINT64 width = (box != nullptr) ? box->right : presentDesc.Width;
+    UINT height = (box != nullptr) ? box->bottom : presentDesc.Height;
+
+    UINT dispatchWidth = static_cast<UINT>((width + InNumThreadsX - 1) / InNumThreadsX);
+    UINT dispatchHeight = (height + InNumThreadsY - 1) / InNumThreadsY;
 
     cmdList->Dispatch(dispatchWidth, dispatchHeight, 1);
 
     ResourceBarrier(cmdList, _buffer, D3D12_RESOURCE_STATE_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_COPY_SOURCE);
     ResourceBarrier(cmdList, present, D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE, D3D12_RESOURCE_STATE_COPY_DEST);
 
-    cmdList->CopyResource(present, _buffer);
+    if (box != nullptr)
+    {
+        D3D12_TEXTURE_COPY_LOCATION srcLocation;
+        ZeroMemory(&srcLocation, sizeof(srcLocation));
+        srcLocation.pResource = _buffer;
+        srcLocation.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+        srcLocation.SubresourceIndex = 0;
+
+        D3D12_TEXTURE_COPY_LOCATION dstLocation;
+        ZeroMemory(&dstLocation, sizeof(dstLocation));
+        dstLocation.pResource = present;
+        dstLocation.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+        dstLocation.SubresourceIndex = 0;
+
+        cmdList->CopyTextureRegion(&dstLocation, box->left, box->top, 0, &srcLocation, box);
+    }
+    else
+    {
+        cmdList->CopyResource(present, _buffer);
+    }
 
     // Restore resource states
     ResourceBarrier(cmdList, present, D3D12_RESOURCE_STATE_COPY_DEST, presentState);
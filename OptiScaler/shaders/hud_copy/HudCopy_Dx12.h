@@ -29,9 +29,10 @@ class HudCopy_Dx12 : public Shader_Dx12
                                 D3D12_RESOURCE_STATES InBeforeState, D3D12_RESOURCE_STATES InAfterState);
 
   public:
+    // When box is set only that part of present is updated
     bool Dispatch(ID3D12Device* InDevice, ID3D12GraphicsCommandList* cmdList, ID3D12Resource* hudless,
                   ID3D12Resource* present, D3D12_RESOURCE_STATES hudlessState, D3D12_RESOURCE_STATES presentState,
-                  float hudDetectionThreshold);
+                  float hudDetectionThreshold, const D3D12_BOX* box = nullptr);
 
     HudCopy_Dx12(std::string InName, ID3D12Device* InDevice);
 
@@ -0,0 +1,76 @@
+#include <pch.h>
+#include "EvaluateParams.h"
+
+// Same typed then untyped lookup the backends used for resources
+static inline ID3D12Resource* GetResource(const NVSDK_NGX_Parameter* InParameters, const char* key)
+{
+    ID3D12Resource* resource = nullptr;
+
+    if (InParameters->Get(key, &resource) != NVSDK_NGX_Result_Success)
+        InParameters->Get(key, (void**) &resource);
+
+    return resource;
+}
+
+uint32_t EvaluateParams::Read(const NVSDK_NGX_Parameter* InParameters)
+{
+    EvaluateParams current {};
+
+    // Backends use whichever of these exists
+    auto jitterXResult = InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_X, &current.jitterX);
+    auto jitterYResult = InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_Y, &current.jitterY);
+    current.hasJitter = jitterXResult == NVSDK_NGX_Result_Success && jitterYResult == NVSDK_NGX_Result_Success;
+
+    current.hasMVScale =
+        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &current.mvScaleX) == NVSDK_NGX_Result_Success &&
+        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &current.mvScaleY) == NVSDK_NGX_Result_Success;
+
+    current.hasSharpness =
+        InParameters->Get(NVSDK_NGX_Parameter_Sharpness, &current.sharpness) == NVSDK_NGX_Result_Success;
+
+    InParameters->Get(NVSDK_NGX_Parameter_Reset, &current.reset);
+
+    current.hasFrameTimeDelta = InParameters->Get(NVSDK_NGX_Parameter_FrameTimeDeltaInMsec,
+                                                  &current.frameTimeDelta) == NVSDK_NGX_Result_Success;
+
+    current.hasPreExposure =
+        InParameters->Get(NVSDK_NGX_Parameter_DLSS_Pre_Exposure, &current.preExposure) == NVSDK_NGX_Result_Success;
+    current.hasExposureScale = InParameters->Get(NVSDK_NGX_Parameter_DLSS_Exposure_Scale, &current.exposureScale) ==
+                               NVSDK_NGX_Result_Success;
+
+    current.hasSubrect = InParameters->Get(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width,
+                                           &current.subrectWidth) == NVSDK_NGX_Result_Success &&
+                         InParameters->Get(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height,
+                                           &current.subrectHeight) == NVSDK_NGX_Result_Success;
+
+    current.hasSize = InParameters->Get(NVSDK_NGX_Parameter_Width, &current.width) == NVSDK_NGX_Result_Success &&
+                      InParameters->Get(NVSDK_NGX_Parameter_Height, &current.height) == NVSDK_NGX_Result_Success;
+
+    current.hasOutSize =
+        InParameters->Get(NVSDK_NGX_Parameter_OutWidth, &current.outWidth) == NVSDK_NGX_Result_Success &&
+        InParameters->Get(NVSDK_NGX_Parameter_OutHeight, &current.outHeight) == NVSDK_NGX_Result_Success;
+
+    current.color = GetResource(InParameters, NVSDK_NGX_Parameter_Color);
+    current.motionVectors = GetResource(InParameters, NVSDK_NGX_Parameter_MotionVectors);
+    current.depth = GetResource(InParameters, NVSDK_NGX_Parameter_Depth);
+    current.output = GetResource(InParameters, NVSDK_NGX_Parameter_Output);
+    current.exposureTexture = GetResource(InParameters, NVSDK_NGX_Parameter_ExposureTexture);
+
+    uint32_t dirty = 0;
+
+    if (current.hasJitter != hasJitter || current.jitterX != jitterX || current.jitterY != jitterY)
+        dirty |= EvaluateDirty::Jitter;
+
+    if (current.hasMVScale != hasMVScale || current.mvScaleX != mvScaleX || current.mvScaleY != mvScaleY)
+        dirty |= EvaluateDirty::MVScale;
+
+    if (current.color != color || current.motionVectors != motionVectors || current.depth != depth ||
+        current.output != output || current.exposureTexture != exposureTexture)
+    {
+        dirty |= EvaluateDirty::Resources;
+    }
+
+    *this = current;
+
+    return dirty;
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <pch.h>
+
+#include <nvsdk_ngx.h>
+#include <nvsdk_ngx_defs.h>
+
+#include <d3d12.h>
+
+// Parameter groups which changed since the previous evaluate of the same feature, only groups with work that can
+// be skipped when they didn't change are tracked
+namespace EvaluateDirty
+{
+constexpr uint32_t Jitter = 1 << 0;
+constexpr uint32_t MVScale = 1 << 1;
+constexpr uint32_t Resources = 1 << 2;
+constexpr uint32_t All = 0xFFFFFFFF;
+} // namespace EvaluateDirty
+
+// Typed copy of the NGX parameters which are read on every Dx12 evaluate, read once per evaluate.
+// has* members are the Get results, values keep their defaults when Get fails.
+struct EvaluateParams
+{
+    float jitterX = 0.0f;
+    float jitterY = 0.0f;
+    bool hasJitter = false;
+
+    float mvScaleX = 1.0f;
+    float mvScaleY = 1.0f;
+    bool hasMVScale = false;
+
+    float sharpness = 0.0f;
+    bool hasSharpness = false;
+
+    unsigned int reset = 0;
+
+    float frameTimeDelta = 0.0f;
+    bool hasFrameTimeDelta = false;
+
+    float preExposure = 1.0f;
+    bool hasPreExposure = false;
+    float exposureScale = 1.0f;
+    bool hasExposureScale = false;
+
+    unsigned int subrectWidth = 0;
+    unsigned int subrectHeight = 0;
+    bool hasSubrect = false;
+
+    unsigned int width = 0;
+    unsigned int height = 0;
+    bool hasSize = false;
+
+    unsigned int outWidth = 0;
+    unsigned int outHeight = 0;
+    bool hasOutSize = false;
+
+    ID3D12Resource* color = nullptr;
+    ID3D12Resource* motionVectors = nullptr;
+    ID3D12Resource* depth = nullptr;
+    ID3D12Resource* output = nullptr;
+    ID3D12Resource* exposureTexture = nullptr;
+
+    // Reads all values, returns EvaluateDirty flags of the groups which differ from the current values
+    uint32_t Read(const NVSDK_NGX_Parameter* InParameters);
+};
@@ -1,6 +1,7 @@
 #include <pch.h>
 #include <Config.h>
 #include "IFeature.h"
+#include "EvaluateParams.h"
 
 void IFeature::SetHandle(unsigned int InHandleId)
 {
@@ -243,6 +244,43 @@ void IFeature::GetRenderResolution(NVSDK_NGX_Parameter* InParameters, unsigned i
     }
 }
 
+void IFeature::GetRenderResolution(const EvaluateParams& InParams, bool InJitterChanged, unsigned int* OutWidth,
+                                   unsigned int* OutHeight)
+{
+    if (InParams.hasSubrect)
+    {
+        *OutWidth = InParams.subrectWidth;
+        *OutHeight = InParams.subrectHeight;
+    }
+    else
+    {
+        LOG_WARN("No subrect dimension info!");
+
+        if (InParams.hasSize && InParams.hasOutSize)
+        {
+            *OutWidth = InParams.width < InParams.outWidth ? InParams.width : InParams.outWidth;
+            *OutHeight = InParams.width < InParams.outWidth ? InParams.height : InParams.outHeight;
+        }
+        else if (InParams.hasSize && InParams.width < RenderWidth())
+        {
+            *OutWidth = InParams.width;
+            *OutHeight = InParams.height;
+        }
+        else
+        {
+            *OutWidth = RenderWidth();
+            *OutHeight = RenderHeight();
+        }
+    }
+
+    _renderWidth = *OutWidth;
+    _renderHeight = *OutHeight;
+
+    // Same pair is already in the set when jitter didn't change
+    if (InJitterChanged && InParams.hasJitter && _jitterInfo.size() < 350)
+        _jitterInfo.insert(std::make_pair(InParams.jitterX, InParams.jitterY));
+}
+
 float IFeature::GetSharpness(const NVSDK_NGX_Parameter* InParameters)
 {
     if (Config::Instance()->OverrideSharpness.value_or_default())
@@ -261,6 +299,23 @@ float IFeature::GetSharpness(const NVSDK_NGX_Parameter* InParameters)
     return sharpness;
 }
 
+float IFeature::GetSharpness(const EvaluateParams& InParams)
+{
+    if (Config::Instance()->OverrideSharpness.value_or_default())
+        return Config::Instance()->Sharpness.value_or_default();
+
+    if (!InParams.hasSharpness)
+        return 0.0f;
+
+    if (InParams.sharpness < 0.0f)
+        return 0.0f;
+
+    if (InParams.sharpness > 1.0f)
+        return 1.0f;
+
+    return InParams.sharpness;
+}
+
 void IFeature::TickFrozenCheck()
 {
     static long updatesWithoutFramecountChange = 0;
@@ -9,6 +9,8 @@
 
 #define DLSS_MOD_ID_OFFSET 1000000
 
+struct EvaluateParams;
+
 inline static unsigned int handleCounter = DLSS_MOD_ID_OFFSET;
 
 struct InitFlags
@@ -75,8 +77,11 @@ class IFeature
     void SetHandle(unsigned int InHandleId);
     bool SetInitParameters(NVSDK_NGX_Parameter* InParameters);
     void GetRenderResolution(NVSDK_NGX_Parameter* InParameters, unsigned int* OutWidth, unsigned int* OutHeight);
+    void GetRenderResolution(const EvaluateParams& InParams, bool InJitterChanged, unsigned int* OutWidth,
+                             unsigned int* OutHeight);
     void GetDynamicOutputResolution(NVSDK_NGX_Parameter* InParameters, unsigned int* width, unsigned int* height);
     float GetSharpness(const NVSDK_NGX_Parameter* InParameters);
+    float GetSharpness(const EvaluateParams& InParams);
 
     virtual void SetInit(bool InValue) { _isInited = InValue; }
 
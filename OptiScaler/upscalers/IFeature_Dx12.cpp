@@ -18,6 +18,13 @@ void IFeature_Dx12::ResourceBarrier(ID3D12GraphicsCommandList* InCommandList, ID
     InCommandList->ResourceBarrier(1, &barrier);
 }
 
+void IFeature_Dx12::UpdateEvaluateParams(const NVSDK_NGX_Parameter* InParameters)
+{
+    auto dirty = _evalParams.Read(InParameters);
+    _evalDirty = _evalParamsRead ? dirty : EvaluateDirty::All;
+    _evalParamsRead = true;
+}
+
 IFeature_Dx12::IFeature_Dx12(unsigned int InHandleId, NVSDK_NGX_Parameter* InParameters) {}
 
 IFeature_Dx12::~IFeature_Dx12()
@@ -1,6 +1,7 @@
 #pragma once
 #include <d3d12.h>
 #include "IFeature.h"
+#include "EvaluateParams.h"
 
 #include <pch.h>
 #include <Util.h>
@@ -18,10 +19,19 @@ class IFeature_Dx12 : public virtual IFeature
     std::unique_ptr<RCAS_Dx12> RCAS = nullptr;
     std::unique_ptr<Bias_Dx12> Bias = nullptr;
 
+    // Parameters of the current evaluate, backends read these instead of querying InParameters again
+    EvaluateParams _evalParams {};
+    uint32_t _evalDirty = EvaluateDirty::All;
+    bool _evalParamsRead = false;
+
     void ResourceBarrier(ID3D12GraphicsCommandList* InCommandList, ID3D12Resource* InResource,
                          D3D12_RESOURCE_STATES InBeforeState, D3D12_RESOURCE_STATES InAfterState) const;
 
   public:
+    // Called once per evaluate before Evaluate, first call after creation reports everything as changed
+    void UpdateEvaluateParams(const NVSDK_NGX_Parameter* InParameters);
+    uint32_t EvaluateDirtyFlags() const { return _evalDirty; }
+
     virtual bool Init(ID3D12Device* InDevice, ID3D12GraphicsCommandList* InCommandList,
                       NVSDK_NGX_Parameter* InParameters) = 0;
     virtual bool Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_NGX_Parameter* InParameters) = 0;
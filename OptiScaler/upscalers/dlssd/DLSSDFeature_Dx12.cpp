@@ -119,17 +119,13 @@ bool DLSSDFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_
     {
         ProcessEvaluateParams(InParameters);
 
-        ID3D12Resource* paramOutput = nullptr;
-        ID3D12Resource* paramDepth = nullptr;
-        ID3D12Resource* paramMotion = nullptr;
+        ID3D12Resource* paramOutput = _evalParams.output;
+        ID3D12Resource* paramDepth = _evalParams.depth;
+        ID3D12Resource* paramMotion = _evalParams.motionVectors;
         ID3D12Resource* setBuffer = nullptr;
 
         bool useSS = Config::Instance()->OutputScalingEnabled.value_or_default() && LowResMV();
 
-        InParameters->Get(NVSDK_NGX_Parameter_Output, &paramOutput);
-        InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, &paramMotion);
-        InParameters->Get(NVSDK_NGX_Parameter_Depth, &paramDepth);
-
         if (paramDepth != nullptr)
             LOG_DEBUG("Depth exist, {:X}", (size_t) paramDepth);
 
@@ -198,8 +194,8 @@ bool DLSSDFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_
             rcasConstants.Sharpness = _sharpness;
             rcasConstants.DisplayWidth = TargetWidth();
             rcasConstants.DisplayHeight = TargetHeight();
-            InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &rcasConstants.MvScaleX);
-            InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &rcasConstants.MvScaleY);
+            rcasConstants.MvScaleX = _evalParams.mvScaleX;
+            rcasConstants.MvScaleY = _evalParams.mvScaleY;
             rcasConstants.DisplaySizeMV = !(GetFeatureFlags() & NVSDK_NGX_DLSS_Feature_Flags_MVLowRes);
             rcasConstants.RenderHeight = RenderHeight();
             rcasConstants.RenderWidth = RenderWidth();
@@ -43,13 +43,13 @@ bool FSR2FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
 
     FfxFsr2DispatchDescription params {};
 
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_X, &params.jitterOffset.x);
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_Y, &params.jitterOffset.y);
+    params.jitterOffset.x = _evalParams.jitterX;
+    params.jitterOffset.y = _evalParams.jitterY;
 
     if (Config::Instance()->OverrideSharpness.value_or_default())
         _sharpness = Config::Instance()->Sharpness.value_or_default();
     else
-        _sharpness = GetSharpness(InParameters);
+        _sharpness = GetSharpness(_evalParams);
 
     if (Config::Instance()->RcasEnabled.value_or_default())
     {
@@ -65,20 +65,17 @@ bool FSR2FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         params.sharpness = _sharpness;
     }
 
-    unsigned int reset;
-    InParameters->Get(NVSDK_NGX_Parameter_Reset, &reset);
-    params.reset = (reset == 1);
+    params.reset = (_evalParams.reset == 1);
 
-    GetRenderResolution(InParameters, &params.renderSize.width, &params.renderSize.height);
+    GetRenderResolution(_evalParams, _evalDirty & EvaluateDirty::Jitter, &params.renderSize.width,
+                        &params.renderSize.height);
     LOG_DEBUG("Input Resolution: {0}x{1}", params.renderSize.width, params.renderSize.height);
 
     bool useSS = Config::Instance()->OutputScalingEnabled.value_or_default() && LowResMV();
 
     params.commandList = ffxGetCommandListDX12(InCommandList);
 
-    ID3D12Resource* paramColor;
-    if (InParameters->Get(NVSDK_NGX_Parameter_Color, &paramColor) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_Color, (void**) &paramColor);
+    ID3D12Resource* paramColor = _evalParams.color;
 
     if (paramColor)
     {
@@ -107,9 +104,7 @@ bool FSR2FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         return false;
     }
 
-    ID3D12Resource* paramVelocity;
-    if (InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, &paramVelocity) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, (void**) &paramVelocity);
+    ID3D12Resource* paramVelocity = _evalParams.motionVectors;
 
     if (paramVelocity)
     {
@@ -138,9 +133,7 @@ bool FSR2FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         return false;
     }
 
-    ID3D12Resource* paramOutput;
-    if (InParameters->Get(NVSDK_NGX_Parameter_Output, &paramOutput) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_Output, (void**) &paramOutput);
+    ID3D12Resource* paramOutput = _evalParams.output;
 
     if (paramOutput)
     {
@@ -186,9 +179,7 @@ bool FSR2FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         return false;
     }
 
-    ID3D12Resource* paramDepth;
-    if (InParameters->Get(NVSDK_NGX_Parameter_Depth, &paramDepth) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_Depth, (void**) &paramDepth);
+    ID3D12Resource* paramDepth = _evalParams.depth;
 
     if (paramDepth)
     {
@@ -215,8 +206,7 @@ bool FSR2FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
     }
     else
     {
-        if (InParameters->Get(NVSDK_NGX_Parameter_ExposureTexture, &paramExp) != NVSDK_NGX_Result_Success)
-            InParameters->Get(NVSDK_NGX_Parameter_ExposureTexture, (void**) &paramExp);
+        paramExp = _evalParams.exposureTexture;
 
         if (paramExp)
         {
@@ -313,11 +303,10 @@ bool FSR2FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
     _accessToReactiveMask = paramReactiveMask != nullptr;
     _hasOutput = params.output.resource != nullptr;
 
-    float MVScaleX = 1.0f;
-    float MVScaleY = 1.0f;
+    float MVScaleX = _evalParams.mvScaleX;
+    float MVScaleY = _evalParams.mvScaleY;
 
-    if (InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &MVScaleX) == NVSDK_NGX_Result_Success &&
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &MVScaleY) == NVSDK_NGX_Result_Success)
+    if (_evalParams.hasMVScale)
     {
         params.motionVectorScale.x = MVScaleX;
         params.motionVectorScale.y = MVScaleY;
@@ -364,14 +353,13 @@ bool FSR2FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
     if (!Config::Instance()->FsrUseFsrInputValues.value_or_default() ||
         InParameters->Get("FSR.frameTimeDelta", &params.frameTimeDelta) != NVSDK_NGX_Result_Success)
     {
-        if (InParameters->Get(NVSDK_NGX_Parameter_FrameTimeDeltaInMsec, &params.frameTimeDelta) !=
-                NVSDK_NGX_Result_Success ||
-            params.frameTimeDelta < 1.0f)
+        params.frameTimeDelta = _evalParams.frameTimeDelta;
+
+        if (!_evalParams.hasFrameTimeDelta || params.frameTimeDelta < 1.0f)
             params.frameTimeDelta = (float) GetDeltaTime();
     }
 
-    if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Pre_Exposure, &params.preExposure) != NVSDK_NGX_Result_Success)
-        params.preExposure = 1.0f;
+    params.preExposure = _evalParams.hasPreExposure ? _evalParams.preExposure : 1.0f;
 
     LOG_DEBUG("Dispatch!!");
     auto result = ffxFsr2ContextDispatch(&_context, &params);
@@ -399,8 +387,8 @@ bool FSR2FeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         rcasConstants.Sharpness = _sharpness;
         rcasConstants.DisplayWidth = TargetWidth();
         rcasConstants.DisplayHeight = TargetHeight();
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &rcasConstants.MvScaleX);
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &rcasConstants.MvScaleY);
+        rcasConstants.MvScaleX = _evalParams.mvScaleX;
+        rcasConstants.MvScaleY = _evalParams.mvScaleY;
         rcasConstants.DisplaySizeMV = !(GetFeatureFlags() & NVSDK_NGX_DLSS_Feature_Flags_MVLowRes);
         rcasConstants.RenderHeight = RenderHeight();
         rcasConstants.RenderWidth = RenderWidth();
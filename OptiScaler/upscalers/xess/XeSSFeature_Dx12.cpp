@@ -67,20 +67,45 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         dumpCount += State::Instance().xessDebugFrames;
     }
 
+    // XeSS context keeps the scale, only set it when it differs from the last applied one.
+    // Not tied to the dirty flag, which is cleared even when this frame returns early or the call fails
+    if (_evalParams.hasMVScale)
+    {
+        if (!_mvScaleApplied || _appliedMVScaleX != _evalParams.mvScaleX || _appliedMVScaleY != _evalParams.mvScaleY)
+        {
+            xessResult = XeSSProxy::SetVelocityScale()(_xessContext, _evalParams.mvScaleX, _evalParams.mvScaleY);
+
+            if (xessResult != XESS_RESULT_SUCCESS)
+            {
+                LOG_ERROR("xessSetVelocityScale: {0}", ResultToString(xessResult));
+                _mvScaleApplied = false;
+                return false;
+            }
+
+            _mvScaleApplied = true;
+            _appliedMVScaleX = _evalParams.mvScaleX;
+            _appliedMVScaleY = _evalParams.mvScaleY;
+        }
+    }
+    else if (_evalDirty & EvaluateDirty::MVScale)
+    {
+        LOG_WARN("Can't get motion vector scales!");
+    }
+
     xess_d3d12_execute_params_t params {};
 
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_X, &params.jitterOffsetX);
-    InParameters->Get(NVSDK_NGX_Parameter_Jitter_Offset_Y, &params.jitterOffsetY);
+    params.jitterOffsetX = _evalParams.jitterX;
+    params.jitterOffsetY = _evalParams.jitterY;
+    params.exposureScale = _evalParams.exposureScale;
 
-    if (InParameters->Get(NVSDK_NGX_Parameter_DLSS_Exposure_Scale, &params.exposureScale) != NVSDK_NGX_Result_Success ||
-        params.exposureScale <= 0.0f)
+    if (!_evalParams.hasExposureScale || params.exposureScale <= 0.0f)
         params.exposureScale = 1.0f;
 
-    InParameters->Get(NVSDK_NGX_Parameter_Reset, &params.resetHistory);
+    params.resetHistory = _evalParams.reset;
 
-    GetRenderResolution(InParameters, &params.inputWidth, &params.inputHeight);
+    GetRenderResolution(_evalParams, _evalDirty & EvaluateDirty::Jitter, &params.inputWidth, &params.inputHeight);
 
-    _sharpness = GetSharpness(InParameters);
+    _sharpness = GetSharpness(_evalParams);
 
     float ssMulti = Config::Instance()->OutputScalingMultiplier.value_or(1.5f);
 
@@ -88,14 +113,14 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
 
     LOG_DEBUG("Input Resolution: {0}x{1}", params.inputWidth, params.inputHeight);
 
-    ID3D12Resource* paramColor;
-    if (InParameters->Get(NVSDK_NGX_Parameter_Color, &paramColor) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_Color, (void**) &paramColor);
+    ID3D12Resource* paramColor = _evalParams.color;
 
     if (paramColor)
     {
         LOG_DEBUG("Color exist..");
-        paramColor->SetName(L"paramColor");
+
+        if (_evalDirty & EvaluateDirty::Resources)
+            paramColor->SetName(L"paramColor");
 
         if (Config::Instance()->ColorResourceBarrier.has_value())
         {
@@ -119,13 +144,14 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         return false;
     }
 
-    if (InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, &params.pVelocityTexture) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_MotionVectors, (void**) &params.pVelocityTexture);
+    params.pVelocityTexture = _evalParams.motionVectors;
 
     if (params.pVelocityTexture)
     {
         LOG_DEBUG("MotionVectors exist..");
-        params.pVelocityTexture->SetName(L"pVelocityTexture");
+
+        if (_evalDirty & EvaluateDirty::Resources)
+            params.pVelocityTexture->SetName(L"pVelocityTexture");
 
         if (Config::Instance()->MVResourceBarrier.has_value())
         {
@@ -147,15 +173,14 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         return false;
     }
 
-    ID3D12Resource* paramOutput;
-
-    if (InParameters->Get(NVSDK_NGX_Parameter_Output, &paramOutput) != NVSDK_NGX_Result_Success)
-        InParameters->Get(NVSDK_NGX_Parameter_Output, (void**) &paramOutput);
+    ID3D12Resource* paramOutput = _evalParams.output;
 
     if (paramOutput)
     {
         LOG_DEBUG("Output exist..");
-        paramOutput->SetName(L"paramOutput");
+
+        if (_evalDirty & EvaluateDirty::Resources)
+            paramOutput->SetName(L"paramOutput");
 
         if (Config::Instance()->OutputResourceBarrier.has_value())
         {
@@ -196,13 +221,14 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
 
     if (LowResMV())
     {
-        if (InParameters->Get(NVSDK_NGX_Parameter_Depth, &params.pDepthTexture) != NVSDK_NGX_Result_Success)
-            InParameters->Get(NVSDK_NGX_Parameter_Depth, (void**) &params.pDepthTexture);
+        params.pDepthTexture = _evalParams.depth;
 
         if (params.pDepthTexture)
         {
             LOG_DEBUG("Depth exist..");
-            params.pDepthTexture->SetName(L"params.pDepthTexture");
+
+            if (_evalDirty & EvaluateDirty::Resources)
+                params.pDepthTexture->SetName(L"params.pDepthTexture");
 
             if (Config::Instance()->DepthResourceBarrier.has_value())
                 ResourceBarrier(InCommandList, params.pDepthTexture,
@@ -218,9 +244,7 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
 
     if (!AutoExposure())
     {
-        if (InParameters->Get(NVSDK_NGX_Parameter_ExposureTexture, &params.pExposureScaleTexture) !=
-            NVSDK_NGX_Result_Success)
-            InParameters->Get(NVSDK_NGX_Parameter_ExposureTexture, (void**) &params.pExposureScaleTexture);
+        params.pExposureScaleTexture = _evalParams.exposureTexture;
 
         if (params.pExposureScaleTexture)
         {
@@ -316,23 +340,6 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
     _hasExposure = params.pExposureScaleTexture != nullptr;
     _accessToReactiveMask = paramReactiveMask != nullptr;
 
-    float MVScaleX = 1.0f;
-    float MVScaleY = 1.0f;
-
-    if (InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &MVScaleX) == NVSDK_NGX_Result_Success &&
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &MVScaleY) == NVSDK_NGX_Result_Success)
-    {
-        xessResult = XeSSProxy::SetVelocityScale()(_xessContext, MVScaleX, MVScaleY);
-
-        if (xessResult != XESS_RESULT_SUCCESS)
-        {
-            LOG_ERROR("xessSetVelocityScale: {0}", ResultToString(xessResult));
-            return false;
-        }
-    }
-    else
-        LOG_WARN("Can't get motion vector scales!");
-
     InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Color_Subrect_Base_X, &params.inputColorBase.x);
     InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Color_Subrect_Base_Y, &params.inputColorBase.y);
     InParameters->Get(NVSDK_NGX_Parameter_DLSS_Input_Depth_Subrect_Base_X, &params.inputDepthBase.x);
@@ -372,8 +379,8 @@ bool XeSSFeatureDx12::Evaluate(ID3D12GraphicsCommandList* InCommandList, NVSDK_N
         rcasConstants.Sharpness = _sharpness;
         rcasConstants.DisplayWidth = TargetWidth();
         rcasConstants.DisplayHeight = TargetHeight();
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_X, &rcasConstants.MvScaleX);
-        InParameters->Get(NVSDK_NGX_Parameter_MV_Scale_Y, &rcasConstants.MvScaleY);
+        rcasConstants.MvScaleX = _evalParams.mvScaleX;
+        rcasConstants.MvScaleY = _evalParams.mvScaleY;
         rcasConstants.DisplaySizeMV = !(GetFeatureFlags() & NVSDK_NGX_DLSS_Feature_Flags_MVLowRes);
         rcasConstants.RenderHeight = RenderHeight();
         rcasConstants.RenderWidth = RenderWidth();
@@ -6,6 +6,11 @@
 class XeSSFeatureDx12 : public XeSSFeature, public IFeature_Dx12
 {
   private:
+    // Last scale set on the XeSS context, it keeps the value between frames
+    bool _mvScaleApplied = false;
+    float _appliedMVScaleX = 0.0f;
+    float _appliedMVScaleY = 0.0f;
+
   protected:
   public:
     std::string Name() const override { return "XeSS"; }
@@ -10,6 +10,8 @@
 #include <menu/menu_overlay_dx.h>
 
 #include <misc/FrameLimit.h>
+#include <misc/HookProfiler.h>
+#include <misc/SamplerOverrides.h>
 #include <upscaler_time/UpscalerTime_Dx11.h>
 #include <upscaler_time/UpscalerTime_Dx12.h>
 
@@ -64,6 +66,9 @@ static HRESULT LocalPresent(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT
         // Update swapchain info evey frame
         if (pSwapChain->GetDesc(&State::Instance().currentSwapchainDesc) != S_OK)
             LOG_WARN("Can't get swapchain desc!");
+
+        HookProfiler::EndFrame();
+        SamplerOverrides::Refresh();
     }
 
     ID3D11Device* device = nullptr;
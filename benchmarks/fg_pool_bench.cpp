@@ -0,0 +1,246 @@
+// FG resource pool benchmark.
+// Measures cached Acquire calls of the FG copy slots against a fake device, then checks that retired resources are
+// released and that an owner slot never keeps a pointer to a resource the pool released.
+
+#include <pch.h>
+
+#include <framegen/FG_ResourcePool_Dx12.h>
+
+#include <chrono>
+#include <cstdio>
+#include <set>
+
+static std::set<void*> _liveResources;
+
+// Never deleted, so a new resource can't get the address of a released one
+struct FakeResource : ID3D12Resource
+{
+    ULONG refCount = 1;
+
+    FakeResource() { _liveResources.insert(this); }
+
+    ULONG AddRef() override { return ++refCount; }
+
+    ULONG Release() override
+    {
+        auto count = --refCount;
+
+        if (count == 0)
+            _liveResources.erase(this);
+
+        return count;
+    }
+};
+
+static std::vector<std::unique_ptr<FakeResource>> _allResources;
+
+static ID3D12Resource* NewResource()
+{
+    _allResources.push_back(std::make_unique<FakeResource>());
+    return _allResources.back().get();
+}
+
+struct FakeHeap : ID3D12Heap
+{
+    ULONG refCount = 1;
+
+    ULONG AddRef() override { return ++refCount; }
+
+    ULONG Release() override
+    {
+        auto count = --refCount;
+
+        if (count == 0)
+            delete this;
+
+        return count;
+    }
+
+    HRESULT SetName(LPCWSTR) override { return S_OK; }
+};
+
+struct FakeCmdList : ID3D12GraphicsCommandList
+{
+    size_t barriers = 0;
+
+    ULONG AddRef() override { return 1; }
+    ULONG Release() override { return 1; }
+    D3D12_COMMAND_LIST_TYPE GetType() override { return D3D12_COMMAND_LIST_TYPE_DIRECT; }
+    void ResourceBarrier(UINT numBarriers, const D3D12_RESOURCE_BARRIER*) override { barriers += numBarriers; }
+    void DiscardResource(ID3D12Resource*, const D3D12_DISCARD_REGION*) override {}
+};
+
+struct FakeDevice : ID3D12Device
+{
+    size_t heaps = 0;
+
+    ULONG AddRef() override { return 1; }
+    ULONG Release() override { return 1; }
+
+    D3D12_RESOURCE_ALLOCATION_INFO GetResourceAllocationInfo(UINT, UINT, const D3D12_RESOURCE_DESC* desc) override
+    {
+        constexpr UINT64 alignment = 64 * 1024;
+        auto size = desc->Width * desc->Height * 4;
+        return { (size + alignment - 1) / alignment * alignment, alignment };
+    }
+
+    HRESULT CreateHeap(const D3D12_HEAP_DESC*, const GUID*, void** heap) override
+    {
+        heaps++;
+        *heap = new FakeHeap();
+        return S_OK;
+    }
+
+    HRESULT CreatePlacedResource(ID3D12Heap*, UINT64, const D3D12_RESOURCE_DESC*, D3D12_RESOURCE_STATES,
+                                 const D3D12_CLEAR_VALUE*, const GUID*, void** resource) override
+    {
+        *resource = NewResource();
+        return S_OK;
+    }
+
+    HRESULT CreateCommittedResource(const D3D12_HEAP_PROPERTIES*, D3D12_HEAP_FLAGS, const D3D12_RESOURCE_DESC*,
+                                    D3D12_RESOURCE_STATES, const D3D12_CLEAR_VALUE*, const GUID*,
+                                    void** resource) override
+    {
+        *resource = NewResource();
+        return S_OK;
+    }
+};
+
+static D3D12_RESOURCE_DESC TextureDesc(UINT64 width, UINT height)
+{
+    D3D12_RESOURCE_DESC desc {};
+    desc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+    desc.Width = width;
+    desc.Height = height;
+    desc.DepthOrArraySize = 1;
+    desc.MipLevels = 1;
+    desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    desc.SampleDesc.Count = 1;
+    desc.Flags = D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
+    return desc;
+}
+
+static bool Check(bool condition, const char* message)
+{
+    if (!condition)
+        printf("Failed: %s\n", message);
+
+    return condition;
+}
+
+static bool IsLive(ID3D12Resource* resource) { return _liveResources.contains(resource); }
+
+// Slots that are not requested anymore lose their resource, slots in use keep it
+static bool CheckEviction()
+{
+    FakeDevice device;
+    FakeCmdList cmdList;
+    FG_ResourcePool_Dx12 pool;
+
+    D3D12_HEAP_PROPERTIES heapProperties {};
+    heapProperties.Type = D3D12_HEAP_TYPE_DEFAULT;
+
+    auto ok = true;
+    UINT64 frame = 1;
+
+    // A placed slot filling a whole heap, a committed slot and a slot which changes its size
+    ID3D12Resource* placedSlot = nullptr;
+    ID3D12Resource* committedSlot = nullptr;
+    ID3D12Resource* resizedSlot = nullptr;
+    auto fullHeapDesc = TextureDesc(4096, 4096);
+
+    pool.Acquire(&device, heapProperties, fullHeapDesc, D3D12_RESOURCE_STATE_COPY_DEST, &placedSlot, frame, &cmdList,
+                 &placedSlot);
+    pool.Acquire(&device, heapProperties, TextureDesc(1920, 1080), D3D12_RESOURCE_STATE_COPY_DEST, &committedSlot,
+                 frame, nullptr, &committedSlot);
+    pool.Acquire(&device, heapProperties, TextureDesc(1280, 720), D3D12_RESOURCE_STATE_COPY_DEST, &resizedSlot,
+                 frame, nullptr, &resizedSlot);
+
+    auto placed = placedSlot;
+    auto committed = committedSlot;
+    auto resizedOld = resizedSlot;
+
+    ok &= Check(placed != nullptr && committed != nullptr && resizedOld != nullptr, "acquire");
+
+    ID3D12Resource* cached = nullptr;
+    pool.Acquire(&device, heapProperties, fullHeapDesc, D3D12_RESOURCE_STATE_COPY_DEST, &placedSlot, frame, &cmdList,
+                 &cached);
+    ok &= Check(cached == placed, "cached acquire returns the same resource");
+
+    frame++;
+    pool.Acquire(&device, heapProperties, TextureDesc(2560, 1440), D3D12_RESOURCE_STATE_COPY_DEST, &resizedSlot,
+                 frame, nullptr, &resizedSlot);
+    auto resizedNew = resizedSlot;
+
+    // Keep the new size in use until the old one and the committed slot retire
+    for (UINT64 i = 0; i <= FG_ResourcePool_Dx12::RetireFrames; i++)
+    {
+        frame++;
+        pool.Acquire(&device, heapProperties, TextureDesc(2560, 1440), D3D12_RESOURCE_STATE_COPY_DEST, &resizedSlot,
+                     frame, nullptr, &resizedSlot);
+    }
+
+    ok &= Check(committedSlot == nullptr, "retired committed slot is cleared");
+    ok &= Check(!IsLive(committed), "retired committed resource is released");
+    ok &= Check(!IsLive(resizedOld), "retired size of a slot is released");
+    ok &= Check(resizedSlot == resizedNew && IsLive(resizedNew), "slot in use keeps its resource");
+
+    // Placed memory is only evicted when it is needed, the new slot aliases it
+    ok &= Check(placedSlot == placed && IsLive(placed), "retired placed slot is kept until memory is needed");
+
+    ID3D12Resource* aliasSlot = nullptr;
+    pool.Acquire(&device, heapProperties, fullHeapDesc, D3D12_RESOURCE_STATE_COPY_DEST, &aliasSlot, frame, &cmdList,
+                 &aliasSlot);
+
+    ok &= Check(placedSlot == nullptr, "evicted placed slot is cleared");
+    ok &= Check(!IsLive(placed), "evicted placed resource is released");
+    ok &= Check(aliasSlot != nullptr && device.heaps == 1, "new slot reuses the evicted memory");
+
+    pool.Release();
+
+    ok &= Check(aliasSlot == nullptr && resizedSlot == nullptr, "release clears all slots");
+    ok &= Check(_liveResources.empty(), "release frees all resources");
+
+    return ok;
+}
+
+// Cached Acquire calls, as done for every FG input each frame
+static double MeasureAcquire(size_t frames)
+{
+    FakeDevice device;
+    FakeCmdList cmdList;
+    FG_ResourcePool_Dx12 pool;
+
+    D3D12_HEAP_PROPERTIES heapProperties {};
+    heapProperties.Type = D3D12_HEAP_TYPE_DEFAULT;
+
+    ID3D12Resource* slots[BUFFER_COUNT][5] {};
+    auto desc = TextureDesc(1920, 1080);
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t frame = 1; frame <= frames; frame++)
+    {
+        for (auto& slot : slots[frame % BUFFER_COUNT])
+        {
+            pool.Acquire(&device, heapProperties, desc, D3D12_RESOURCE_STATE_COPY_DEST, &slot, frame, &cmdList,
+                         &slot);
+        }
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (frames * 5);
+}
+
+int main(int argc, char** argv)
+{
+    bool quick = argc > 1 && strcmp(argv[1], "--quick") == 0;
+
+    printf("Cached acquire: %.1f ns\n", MeasureAcquire(quick ? 10000 : 1000000));
+
+    auto ok = CheckEviction();
+
+    printf(ok ? "Results match\n" : "Results differ\n");
+    return ok ? 0 : 1;
+}
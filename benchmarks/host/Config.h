@@ -0,0 +1,71 @@
+#pragma once
+
+// Host stand-in for OptiScaler/Config.h with the options NVNGX_Parameter.h reads, defaults match Config.h.
+// Replayers set the fields directly instead of loading an ini.
+
+#include <pch.h>
+
+#include <State.h>
+
+#include <optional>
+
+enum HasDefaultValue
+{
+    WithDefault,
+    NoDefault,
+};
+
+template <class T, HasDefaultValue defaultState = WithDefault> class CustomOptional : public std::optional<T>
+{
+    T _defaultValue {};
+
+  public:
+    CustomOptional(T defaultValue)
+        requires(defaultState != NoDefault)
+        : _defaultValue(std::move(defaultValue))
+    {
+    }
+
+    CustomOptional()
+        requires(defaultState == NoDefault)
+    = default;
+
+    CustomOptional& operator=(const T& value)
+    {
+        std::optional<T>::operator=(value);
+        return *this;
+    }
+
+    T value_or_default() const
+        requires(defaultState != NoDefault)
+    {
+        return this->has_value() ? this->value() : _defaultValue;
+    }
+};
+
+class Config
+{
+  public:
+    CustomOptional<bool> NGXParameterCapture { false };
+
+    CustomOptional<bool> ExtendedLimits { false };
+    CustomOptional<bool> UpscaleRatioOverrideEnabled { false };
+    CustomOptional<float> UpscaleRatioOverrideValue { 1.3f };
+    CustomOptional<bool> DrsMinOverrideEnabled { false };
+    CustomOptional<bool> DrsMaxOverrideEnabled { false };
+    CustomOptional<int, NoDefault> RoundInternalResolution;
+
+    CustomOptional<bool> QualityRatioOverrideEnabled { false };
+    CustomOptional<float> QualityRatio_DLAA { 1.0f };
+    CustomOptional<float> QualityRatio_UltraQuality { 1.3f };
+    CustomOptional<float> QualityRatio_Quality { 1.5f };
+    CustomOptional<float> QualityRatio_Balanced { 1.7f };
+    CustomOptional<float> QualityRatio_Performance { 2.0f };
+    CustomOptional<float> QualityRatio_UltraPerformance { 3.0f };
+
+    static Config* Instance()
+    {
+        static Config instance;
+        return &instance;
+    }
+};
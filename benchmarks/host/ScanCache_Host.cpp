@@ -0,0 +1,14 @@
+#include <scanner/ScanCache.h>
+
+// Benchmarks measure uncached scans, module key 0 turns the cache off
+
+UINT64 ScanCache::GetModuleKey(HMODULE) { return 0; }
+
+UINT64 ScanCache::GetKey(UINT64, const std::vector<uint8_t>&, const std::vector<uint8_t>&, uint32_t, size_t)
+{
+    return 0;
+}
+
+bool ScanCache::Get(UINT64, std::vector<uint32_t>&) { return false; }
+
+void ScanCache::Put(UINT64, const std::vector<uint32_t>&) {}
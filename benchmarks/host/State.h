@@ -0,0 +1,45 @@
+#pragma once
+
+// Host stand-in for OptiScaler/State.h with the fields NVNGX parameter handling reads
+
+#include <pch.h>
+
+enum class FGInput : uint32_t
+{
+    NoFG,
+    Nukems,
+    FSRFG,
+    DLSSG, // technically Streamline inputs
+    XeFG,
+    Upscaler, // OptiFG
+    FSRFG30,
+};
+
+enum class GameQuirk : uint64_t
+{
+    ForceUnrealEngine,
+};
+
+// Only the quirk checked by NVNGX_Parameter.h
+struct GameQuirks
+{
+    bool forceUnrealEngine = false;
+
+    bool operator&(GameQuirk quirk) const { return quirk == GameQuirk::ForceUnrealEngine && forceUnrealEngine; }
+};
+
+class State
+{
+  public:
+    GameQuirks gameQuirks;
+    FGInput activeFgInput = FGInput::NoFG;
+    NVSDK_NGX_EngineType NVNGX_Engine = NVSDK_NGX_ENGINE_TYPE_CUSTOM;
+    UINT64 frameCount = 0;
+    bool isRunningOnNvidia = false;
+
+    static State& Instance()
+    {
+        static State instance;
+        return instance;
+    }
+};
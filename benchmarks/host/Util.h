@@ -0,0 +1,12 @@
+#pragma once
+
+// Host stand-in for OptiScaler/Util.h, captures go to the temp directory
+
+#include <pch.h>
+
+#include <filesystem>
+
+namespace Util
+{
+inline std::filesystem::path DllPath() { return std::filesystem::temp_directory_path() / "OptiScaler.dll"; }
+} // namespace Util
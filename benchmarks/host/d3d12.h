@@ -0,0 +1,166 @@
+#pragma once
+
+// Host stand-in for d3d12.h with the device, heap and cmdList calls FG_ResourcePool_Dx12 makes.
+// Interfaces are abstract so benchmarks can implement them, values match d3d12.h.
+
+#include <pch.h>
+
+typedef const wchar_t* LPCWSTR;
+
+#define S_OK ((HRESULT) 0)
+#define E_OUTOFMEMORY ((HRESULT) 0x8007000E)
+
+#define IID_PPV_ARGS(ppType) nullptr, reinterpret_cast<void**>(ppType)
+
+#define D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES 0xffffffff
+#define D3D12_DEFAULT_MSAA_RESOURCE_PLACEMENT_ALIGNMENT 4194304
+
+enum D3D12_HEAP_TYPE : uint32_t
+{
+    D3D12_HEAP_TYPE_DEFAULT = 1,
+    D3D12_HEAP_TYPE_UPLOAD = 2,
+    D3D12_HEAP_TYPE_READBACK = 3,
+};
+
+enum D3D12_HEAP_FLAGS : uint32_t
+{
+    D3D12_HEAP_FLAG_NONE = 0,
+    D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS = 0xc0,
+    D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES = 0x44,
+    D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES = 0x84,
+};
+
+enum D3D12_RESOURCE_DIMENSION : uint32_t
+{
+    D3D12_RESOURCE_DIMENSION_UNKNOWN = 0,
+    D3D12_RESOURCE_DIMENSION_BUFFER = 1,
+    D3D12_RESOURCE_DIMENSION_TEXTURE2D = 3,
+};
+
+enum D3D12_TEXTURE_LAYOUT : uint32_t
+{
+    D3D12_TEXTURE_LAYOUT_UNKNOWN = 0,
+    D3D12_TEXTURE_LAYOUT_ROW_MAJOR = 1,
+};
+
+enum D3D12_COMMAND_LIST_TYPE : uint32_t
+{
+    D3D12_COMMAND_LIST_TYPE_DIRECT = 0,
+    D3D12_COMMAND_LIST_TYPE_COMPUTE = 2,
+    D3D12_COMMAND_LIST_TYPE_COPY = 3,
+};
+
+enum D3D12_RESOURCE_BARRIER_TYPE : uint32_t
+{
+    D3D12_RESOURCE_BARRIER_TYPE_TRANSITION = 0,
+    D3D12_RESOURCE_BARRIER_TYPE_ALIASING = 1,
+    D3D12_RESOURCE_BARRIER_TYPE_UAV = 2,
+};
+
+struct DXGI_SAMPLE_DESC
+{
+    UINT Count;
+    UINT Quality;
+};
+
+struct D3D12_RESOURCE_DESC
+{
+    D3D12_RESOURCE_DIMENSION Dimension;
+    UINT64 Alignment;
+    UINT64 Width;
+    UINT Height;
+    WORD DepthOrArraySize;
+    WORD MipLevels;
+    DXGI_FORMAT Format;
+    DXGI_SAMPLE_DESC SampleDesc;
+    D3D12_TEXTURE_LAYOUT Layout;
+    D3D12_RESOURCE_FLAGS Flags;
+};
+
+struct D3D12_HEAP_PROPERTIES
+{
+    D3D12_HEAP_TYPE Type;
+    UINT CPUPageProperty;
+    UINT MemoryPoolPreference;
+    UINT CreationNodeMask;
+    UINT VisibleNodeMask;
+};
+
+struct D3D12_HEAP_DESC
+{
+    UINT64 SizeInBytes;
+    D3D12_HEAP_PROPERTIES Properties;
+    UINT64 Alignment;
+    D3D12_HEAP_FLAGS Flags;
+};
+
+struct D3D12_RESOURCE_ALLOCATION_INFO
+{
+    UINT64 SizeInBytes;
+    UINT64 Alignment;
+};
+
+struct D3D12_RESOURCE_TRANSITION_BARRIER
+{
+    ID3D12Resource* pResource;
+    UINT Subresource;
+    D3D12_RESOURCE_STATES StateBefore;
+    D3D12_RESOURCE_STATES StateAfter;
+};
+
+struct D3D12_RESOURCE_ALIASING_BARRIER
+{
+    ID3D12Resource* pResourceBefore;
+    ID3D12Resource* pResourceAfter;
+};
+
+struct D3D12_RESOURCE_BARRIER
+{
+    D3D12_RESOURCE_BARRIER_TYPE Type;
+    UINT Flags;
+    union
+    {
+        D3D12_RESOURCE_TRANSITION_BARRIER Transition;
+        D3D12_RESOURCE_ALIASING_BARRIER Aliasing;
+    };
+};
+
+struct D3D12_DISCARD_REGION;
+struct D3D12_CLEAR_VALUE;
+
+struct IUnknown
+{
+    virtual ULONG AddRef() = 0;
+    virtual ULONG Release() = 0;
+    virtual ~IUnknown() = default;
+};
+
+struct ID3D12Heap : IUnknown
+{
+    virtual HRESULT SetName(LPCWSTR name) = 0;
+};
+
+struct ID3D12Resource : IUnknown
+{
+};
+
+struct ID3D12GraphicsCommandList : IUnknown
+{
+    virtual D3D12_COMMAND_LIST_TYPE GetType() = 0;
+    virtual void ResourceBarrier(UINT numBarriers, const D3D12_RESOURCE_BARRIER* barriers) = 0;
+    virtual void DiscardResource(ID3D12Resource* resource, const D3D12_DISCARD_REGION* region) = 0;
+};
+
+struct ID3D12Device : IUnknown
+{
+    virtual D3D12_RESOURCE_ALLOCATION_INFO GetResourceAllocationInfo(UINT visibleMask, UINT numResourceDescs,
+                                                                     const D3D12_RESOURCE_DESC* resourceDescs) = 0;
+    virtual HRESULT CreateHeap(const D3D12_HEAP_DESC* desc, const GUID* riid, void** heap) = 0;
+    virtual HRESULT CreatePlacedResource(ID3D12Heap* heap, UINT64 heapOffset, const D3D12_RESOURCE_DESC* desc,
+                                         D3D12_RESOURCE_STATES initialState, const D3D12_CLEAR_VALUE* clearValue,
+                                         const GUID* riid, void** resource) = 0;
+    virtual HRESULT CreateCommittedResource(const D3D12_HEAP_PROPERTIES* heapProperties, D3D12_HEAP_FLAGS heapFlags,
+                                            const D3D12_RESOURCE_DESC* desc, D3D12_RESOURCE_STATES initialState,
+                                            const D3D12_CLEAR_VALUE* clearValue, const GUID* riid,
+                                            void** resource) = 0;
+};
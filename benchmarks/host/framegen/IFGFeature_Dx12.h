@@ -0,0 +1,16 @@
+#pragma once
+
+// Host stand-in, resource tracking only needs the FG resource types
+
+#include <pch.h>
+
+enum FG_ResourceType : uint32_t
+{
+    Depth = 0,
+    Velocity,
+    HudlessColor,
+    UIColor,
+    Distortion,
+
+    ResourceTypeCOUNT
+};
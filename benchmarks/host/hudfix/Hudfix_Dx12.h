@@ -0,0 +1,26 @@
+#pragma once
+
+// Host stand-in, same descriptor slot types as OptiScaler/hudfix/Hudfix_Dx12.h
+
+#include <pch.h>
+
+enum ResourceType
+{
+    SRV,
+    RTV,
+    UAV
+};
+
+typedef struct ResourceInfo
+{
+    ID3D12Resource* buffer = nullptr;
+    UINT64 width = 0;
+    UINT height = 0;
+    DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
+    D3D12_RESOURCE_STATES state = D3D12_RESOURCE_STATE_COMMON;
+    D3D12_RESOURCE_FLAGS flags = D3D12_RESOURCE_FLAG_NONE;
+    ResourceType type = SRV;
+    double lastUsedFrame = 0;
+    bool extended = false;
+    UINT captureInfo = 0;
+} resource_info;
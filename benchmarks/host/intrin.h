@@ -0,0 +1,10 @@
+#pragma once
+
+// Host stand-in for MSVC's intrin.h, only the cpuid helpers used by the scanner.
+// cpuid.h already provides __cpuidex, its __cpuid is a macro with a different signature.
+
+#include <cpuid.h>
+
+#undef __cpuid
+
+inline void __cpuid(int info[4], int leaf) { __cpuidex(info, leaf, 0); }
@@ -0,0 +1,207 @@
+#pragma once
+
+// Host stand-in for OptiScaler/pch.h. Declares only what the benchmarked headers and sources use,
+// Windows and D3D12 interfaces stay opaque since benchmarks never call into them.
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+#include <immintrin.h>
+
+// MSVC converts the NGX callbacks to void* when they are Set, GCC needs the conversion spelled out
+#define NVSDK_NGX_Parameter NVSDK_NGX_ParameterBase
+#include <nvsdk_ngx_params.h>
+#undef NVSDK_NGX_Parameter
+
+struct NVSDK_NGX_Parameter : NVSDK_NGX_ParameterBase
+{
+    using NVSDK_NGX_ParameterBase::Set;
+
+    template <typename R, typename... Args> void Set(const char* InName, R (*InValue)(Args...))
+    {
+        Set(InName, (void*) InValue);
+    }
+};
+
+#include <nvsdk_ngx.h>
+#include <nvsdk_ngx_defs.h>
+
+#define NOMINMAX
+
+#define BUFFER_COUNT 4
+
+#define __forceinline inline __attribute__((always_inline))
+
+typedef uint8_t BYTE;
+typedef uint8_t UINT8;
+typedef uint16_t WORD;
+typedef uint32_t DWORD;
+typedef int32_t LONG;
+typedef uint32_t ULONG;
+typedef uint64_t ULONG64;
+typedef int32_t INT;
+typedef uint32_t UINT;
+typedef uint64_t UINT64;
+typedef size_t SIZE_T;
+typedef int BOOL;
+typedef int32_t HRESULT;
+
+struct HINSTANCE__;
+typedef HINSTANCE__* HMODULE;
+
+#define YieldProcessor _mm_pause
+
+// Only used for log messages, which benchmarks drop
+inline std::string wstring_to_string(const std::wstring& string) { return std::string(string.begin(), string.end()); }
+
+// Benchmarks pass their synthetic images directly, named modules are never loaded
+inline HMODULE GetModuleHandle(const wchar_t*) { return nullptr; }
+
+// PE headers, same layout as winnt.h
+struct IMAGE_DOS_HEADER
+{
+    WORD e_magic;
+    WORD e_unused[29];
+    LONG e_lfanew;
+};
+
+struct IMAGE_FILE_HEADER
+{
+    WORD Machine;
+    WORD NumberOfSections;
+    DWORD TimeDateStamp;
+    DWORD PointerToSymbolTable;
+    DWORD NumberOfSymbols;
+    WORD SizeOfOptionalHeader;
+    WORD Characteristics;
+};
+
+struct IMAGE_OPTIONAL_HEADER64
+{
+    WORD Magic;
+    BYTE unused[238];
+};
+
+struct IMAGE_NT_HEADERS64
+{
+    DWORD Signature;
+    IMAGE_FILE_HEADER FileHeader;
+    IMAGE_OPTIONAL_HEADER64 OptionalHeader;
+};
+
+struct IMAGE_SECTION_HEADER
+{
+    BYTE Name[8];
+    union
+    {
+        DWORD PhysicalAddress;
+        DWORD VirtualSize;
+    } Misc;
+    DWORD VirtualAddress;
+    DWORD SizeOfRawData;
+    DWORD PointerToRawData;
+    DWORD PointerToRelocations;
+    DWORD PointerToLinenumbers;
+    WORD NumberOfRelocations;
+    WORD NumberOfLinenumbers;
+    DWORD Characteristics;
+};
+
+static_assert(sizeof(IMAGE_DOS_HEADER) == 64 && sizeof(IMAGE_NT_HEADERS64) == 264 &&
+              sizeof(IMAGE_SECTION_HEADER) == 40);
+
+#define IMAGE_DOS_SIGNATURE 0x5A4D
+#define IMAGE_NT_SIGNATURE 0x00004550
+#define IMAGE_NT_OPTIONAL_HDR64_MAGIC 0x20b
+#define IMAGE_SCN_CNT_CODE 0x00000020
+#define IMAGE_SCN_MEM_EXECUTE 0x20000000
+#define IMAGE_SCN_MEM_READ 0x40000000
+
+#define IMAGE_FIRST_SECTION(nt)                                                                                        \
+    ((IMAGE_SECTION_HEADER*) ((BYTE*) (nt) + offsetof(IMAGE_NT_HEADERS64, OptionalHeader) +                           \
+                              (nt)->FileHeader.SizeOfOptionalHeader))
+
+// D3D12
+struct GUID;
+typedef const GUID& REFIID;
+
+struct IUnknown;
+struct ID3D12Device;
+struct ID3D12Resource;
+struct ID3D12DescriptorHeap;
+struct ID3D12CommandList;
+struct ID3D12GraphicsCommandList;
+struct ID3D12CommandQueue;
+
+struct D3D12_RENDER_TARGET_VIEW_DESC;
+struct D3D12_SHADER_RESOURCE_VIEW_DESC;
+struct D3D12_UNORDERED_ACCESS_VIEW_DESC;
+struct D3D12_DESCRIPTOR_HEAP_DESC;
+struct D3D12_RESOURCE_DESC;
+struct CD3DX12_HEAP_PROPERTIES;
+
+struct ID3D11Resource;
+struct D3D11_BUFFER_DESC;
+struct D3D11_TEXTURE2D_DESC;
+
+struct D3D12_CPU_DESCRIPTOR_HANDLE
+{
+    SIZE_T ptr;
+};
+
+struct D3D12_GPU_DESCRIPTOR_HANDLE
+{
+    UINT64 ptr;
+};
+
+enum DXGI_FORMAT : uint32_t
+{
+    DXGI_FORMAT_UNKNOWN = 0,
+    DXGI_FORMAT_R16G16B16A16_FLOAT = 10,
+    DXGI_FORMAT_R16G16_FLOAT = 34,
+    DXGI_FORMAT_R8G8B8A8_UNORM = 28,
+    DXGI_FORMAT_R32_FLOAT = 41,
+};
+
+enum D3D12_RESOURCE_FLAGS : uint32_t
+{
+    D3D12_RESOURCE_FLAG_NONE = 0,
+    D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET = 0x1,
+    D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL = 0x2,
+    D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS = 0x4,
+};
+
+enum D3D12_RESOURCE_STATES : uint32_t
+{
+    D3D12_RESOURCE_STATE_COMMON = 0,
+    D3D12_RESOURCE_STATE_RENDER_TARGET = 0x4,
+    D3D12_RESOURCE_STATE_UNORDERED_ACCESS = 0x8,
+    D3D12_RESOURCE_STATE_DEPTH_WRITE = 0x10,
+    D3D12_RESOURCE_STATE_COPY_DEST = 0x400,
+    D3D12_RESOURCE_STATE_COPY_SOURCE = 0x800,
+};
+
+enum D3D12_DESCRIPTOR_HEAP_TYPE : uint32_t
+{
+    D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV = 0,
+    D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER,
+    D3D12_DESCRIPTOR_HEAP_TYPE_RTV,
+    D3D12_DESCRIPTOR_HEAP_TYPE_DSV,
+};
+
+// Benchmarks don't log
+#define LOG_TRACE(msg, ...)
+#define LOG_DEBUG(msg, ...)
+#define LOG_INFO(msg, ...)
+#define LOG_WARN(msg, ...)
+#define LOG_ERROR(msg, ...)
+#define LOG_TRACK(msg, ...)
@@ -0,0 +1,3 @@
+#pragma once
+
+// Host stand-in, GetModuleHandle is declared in pch.h
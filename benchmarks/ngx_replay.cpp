@@ -0,0 +1,657 @@
+// NGX parameter capture replayer.
+// Loads a capture written by NGXParameterCapture (OptiScaler_NGX.capture) and replays the game side of it through
+// NVNGX_Parameters: parameter objects come from GetNGXParameters, so feature selection runs again, game Sets are
+// applied and optimal settings callbacks are called when the game fetched them. Every captured Get is repeated and
+// compared, options change the config and state the replay runs with to see what the game would get then.
+// Without a capture file one is recorded with NGXParameterCapture, replayed as is and with a quality override.
+
+#include <pch.h>
+
+#include <NVNGX_Parameter.h>
+#include <Util.h>
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+
+static const char* OpNames[] = { "None",   "KeyName",       "Frame",           "Set",
+                                 "Get",    "CreateFeature", "EvaluateFeature", "ReleaseFeature" };
+
+static_assert(std::size(OpNames) == (size_t) NGXCaptureOp::Count, "Name every capture op");
+
+// Written by the optimal settings and stats callbacks, the replay gets them by calling the callbacks
+static const std::set<std::string> CallbackOutputKeys = {
+    NVSDK_NGX_Parameter_Scale,
+    NVSDK_NGX_Parameter_SuperSampling_ScaleFactor,
+    NVSDK_NGX_Parameter_OutWidth,
+    NVSDK_NGX_Parameter_OutHeight,
+    NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Width,
+    NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Height,
+    NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Width,
+    NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Height,
+    NVSDK_NGX_Parameter_SizeInBytes,
+    NVSDK_NGX_Parameter_DLSSMode,
+    NVSDK_NGX_EParameter_Scale,
+    NVSDK_NGX_EParameter_OutWidth,
+    NVSDK_NGX_EParameter_OutHeight,
+    NVSDK_NGX_EParameter_SizeInBytes,
+    NVSDK_NGX_EParameter_DLSSMode,
+};
+
+static const std::set<std::string> CallbackKeys = {
+    NVSDK_NGX_Parameter_DLSSOptimalSettingsCallback,
+    NVSDK_NGX_EParameter_DLSSOptimalSettingsCallback,
+    "DLSSDOptimalSettingsCallback",
+    NVSDK_NGX_Parameter_DLSSGetStatsCallback,
+};
+
+typedef NVSDK_NGX_Result(NVSDK_CONV* PFN_ParameterCallback)(NVSDK_NGX_Parameter* InParams);
+
+// EParameter keys are "#" and a number
+static std::string PrintableKey(const std::string& key)
+{
+    if (key.size() == 2 && key[0] == '#')
+        return "#" + std::to_string((uint8_t) key[1]);
+
+    return key;
+}
+
+static std::string PrintableValue(NGXCaptureValueType type, uint64_t bits)
+{
+    char text[32];
+
+    switch (type)
+    {
+    case NGXCaptureValueType::Float:
+    {
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        snprintf(text, sizeof(text), "%g", value);
+        break;
+    }
+
+    case NGXCaptureValueType::Double:
+    {
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        snprintf(text, sizeof(text), "%g", value);
+        break;
+    }
+
+    case NGXCaptureValueType::Int:
+        snprintf(text, sizeof(text), "%d", (int) bits);
+        break;
+
+    case NGXCaptureValueType::UInt:
+    case NGXCaptureValueType::ULongLong:
+        snprintf(text, sizeof(text), "%llu", (unsigned long long) bits);
+        break;
+
+    default:
+        snprintf(text, sizeof(text), "0x%llx", (unsigned long long) bits);
+        break;
+    }
+
+    return text;
+}
+
+struct NGXCapture
+{
+    std::vector<std::string> keys;
+    std::vector<NGXCaptureRecord> records;
+};
+
+static bool LoadCapture(const std::filesystem::path& path, NGXCapture& capture)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    if (!file.is_open())
+    {
+        printf("Can't open capture: %s\n", path.string().c_str());
+        return false;
+    }
+
+    NGXCaptureHeader header {};
+    file.read((char*) &header, sizeof(header));
+
+    if (!file || header.magic != NGXCaptureHeader::Magic || header.version != NGXCaptureHeader::CurrentVersion ||
+        header.recordSize != sizeof(NGXCaptureRecord))
+    {
+        printf("Not a version %u NGX parameter capture: %s\n", NGXCaptureHeader::CurrentVersion,
+               path.string().c_str());
+        return false;
+    }
+
+    NGXCaptureRecord record {};
+
+    while (file.read((char*) &record, sizeof(record)))
+    {
+        if (record.op != NGXCaptureOp::KeyName)
+        {
+            capture.records.push_back(record);
+            continue;
+        }
+
+        if (capture.keys.size() <= record.keyId)
+            capture.keys.resize(record.keyId + 1);
+
+        auto& key = capture.keys[record.keyId];
+        key.resize((size_t) record.value);
+        file.read(key.data(), key.size());
+    }
+
+    for (const auto& captured : capture.records)
+    {
+        if ((captured.op == NGXCaptureOp::Set || captured.op == NGXCaptureOp::Get) &&
+            (captured.keyId >= capture.keys.size() || capture.keys[captured.keyId].empty()))
+        {
+            printf("Capture uses key %u before naming it\n", captured.keyId);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Every key InitNGXParameters and GetNGXParameters can set, with any engine, vendor and FG input
+static std::set<std::string> CollectInitKeys()
+{
+    auto saved = State::Instance();
+    std::set<std::string> keys = { "OptiScaler" };
+
+    for (auto engine : { NVSDK_NGX_ENGINE_TYPE_CUSTOM, NVSDK_NGX_ENGINE_TYPE_UNREAL })
+    {
+        for (auto nvidia : { false, true })
+        {
+            for (auto fgInput : { FGInput::NoFG, FGInput::Nukems })
+            {
+                State::Instance().NVNGX_Engine = engine;
+                State::Instance().isRunningOnNvidia = nvidia;
+                State::Instance().activeFgInput = fgInput;
+
+                NVNGX_Parameters params;
+                InitNGXParameters(&params);
+
+                for (auto& key : params.enumerate())
+                    keys.insert(key);
+            }
+        }
+    }
+
+    State::Instance() = saved;
+    return keys;
+}
+
+template <typename T> static void SetBits(NVNGX_Parameters* params, const char* key, uint64_t bits)
+{
+    T value;
+    memcpy(&value, &bits, sizeof(T));
+    params->Set(key, value);
+}
+
+template <typename T> static NVSDK_NGX_Result GetBits(NVNGX_Parameters* params, const char* key, uint64_t& bits)
+{
+    T value {};
+    auto result = params->Get(key, &value);
+    bits = result == NVSDK_NGX_Result_Success ? CaptureValueBits(value) : 0;
+    return result;
+}
+
+// Parameter objects of the capture and the game side calls on them
+class Replayer
+{
+    struct ReplayParameters
+    {
+        std::unique_ptr<NVNGX_Parameters> params;
+
+        // Sets of InitNGXParameters are in the capture too, they are skipped since the replay makes its own
+        bool initializing = false;
+        std::set<std::string> initKeysSeen;
+    };
+
+    const NGXCapture& _capture;
+    const std::set<std::string> _initKeys = CollectInitKeys();
+    std::unordered_map<uint64_t, ReplayParameters> _parameters;
+
+    // Objects created before the capture started show up without their initialization
+    ReplayParameters& Find(uint64_t parameters)
+    {
+        auto& entry = _parameters[parameters];
+
+        if (entry.params == nullptr)
+            entry.params.reset(GetNGXParameters("Replay"));
+
+        return entry;
+    }
+
+    // Initialization starts with SuperSampling.Available, which games never set, and ends after the OptiScaler
+    // key or, after Reset, at the first key initialization doesn't set or already did
+    bool SkipInitSet(ReplayParameters& entry, const std::string& key)
+    {
+        if (key == NVSDK_NGX_Parameter_SuperSampling_Available)
+        {
+            entry.params.reset(GetNGXParameters("Replay"));
+            entry.initializing = true;
+            entry.initKeysSeen.clear();
+        }
+
+        if (!entry.initializing)
+            return false;
+
+        if (_initKeys.contains(key) && entry.initKeysSeen.insert(key).second)
+        {
+            entry.initializing = key != "OptiScaler";
+            return true;
+        }
+
+        entry.initializing = false;
+        return false;
+    }
+
+    void Set(const NGXCaptureRecord& record)
+    {
+        auto& key = _capture.keys[record.keyId];
+        auto& entry = _parameters[record.parameters];
+
+        if (SkipInitSet(entry, key) || CallbackOutputKeys.contains(key))
+        {
+            skipped++;
+            return;
+        }
+
+        auto params = Find(record.parameters).params.get();
+
+        switch ((NGXCaptureValueType) record.type)
+        {
+        case NGXCaptureValueType::Float:
+            SetBits<float>(params, key.c_str(), record.value);
+            break;
+        case NGXCaptureValueType::Double:
+            SetBits<double>(params, key.c_str(), record.value);
+            break;
+        case NGXCaptureValueType::Int:
+            SetBits<int>(params, key.c_str(), record.value);
+            break;
+        case NGXCaptureValueType::UInt:
+            SetBits<unsigned int>(params, key.c_str(), record.value);
+            break;
+        case NGXCaptureValueType::ULongLong:
+            SetBits<unsigned long long>(params, key.c_str(), record.value);
+            break;
+        case NGXCaptureValueType::VoidPtr:
+            SetBits<void*>(params, key.c_str(), record.value);
+            break;
+        case NGXCaptureValueType::D3D11Resource:
+            SetBits<ID3D11Resource*>(params, key.c_str(), record.value);
+            break;
+        case NGXCaptureValueType::D3D12Resource:
+            SetBits<ID3D12Resource*>(params, key.c_str(), record.value);
+            break;
+        default:
+            break;
+        }
+    }
+
+    void Get(const NGXCaptureRecord& record)
+    {
+        auto& key = _capture.keys[record.keyId];
+        auto& entry = Find(record.parameters);
+        auto params = entry.params.get();
+        entry.initializing = false;
+
+        uint64_t bits = 0;
+        auto result = NVSDK_NGX_Result_Fail;
+
+        switch ((NGXCaptureValueType) record.type)
+        {
+        case NGXCaptureValueType::Float:
+            result = GetBits<float>(params, key.c_str(), bits);
+            break;
+        case NGXCaptureValueType::Double:
+            result = GetBits<double>(params, key.c_str(), bits);
+            break;
+        case NGXCaptureValueType::Int:
+            result = GetBits<int>(params, key.c_str(), bits);
+            break;
+        case NGXCaptureValueType::UInt:
+            result = GetBits<unsigned int>(params, key.c_str(), bits);
+            break;
+        case NGXCaptureValueType::ULongLong:
+            result = GetBits<unsigned long long>(params, key.c_str(), bits);
+            break;
+        case NGXCaptureValueType::VoidPtr:
+            result = GetBits<void*>(params, key.c_str(), bits);
+            break;
+        case NGXCaptureValueType::D3D11Resource:
+            result = GetBits<ID3D11Resource*>(params, key.c_str(), bits);
+            break;
+        case NGXCaptureValueType::D3D12Resource:
+            result = GetBits<ID3D12Resource*>(params, key.c_str(), bits);
+            break;
+        default:
+            break;
+        }
+
+        auto success = result == NVSDK_NGX_Result_Success;
+        auto callback = CallbackKeys.contains(key);
+
+        // Games call the callback right after fetching it, its address is of another build so only presence counts
+        if (callback && success && bits != 0)
+        {
+            ((PFN_ParameterCallback) bits)(params);
+            callbacks++;
+        }
+
+        if (success == (record.result == 0) && (!success || callback || bits == record.value))
+            return;
+
+        if (mismatches++ < 20)
+        {
+            printf("Get %s: captured %s, replay %s\n", PrintableKey(key).c_str(),
+                   record.result == 0 ? PrintableValue((NGXCaptureValueType) record.type, record.value).c_str()
+                                      : "fail",
+                   success ? PrintableValue((NGXCaptureValueType) record.type, bits).c_str() : "fail");
+        }
+    }
+
+  public:
+    size_t skipped = 0;
+    size_t callbacks = 0;
+    size_t mismatches = 0;
+    std::map<uint32_t, size_t> createdFeatures;
+
+    explicit Replayer(const NGXCapture& capture) : _capture(capture) {}
+
+    void Replay(const NGXCaptureRecord& record)
+    {
+        switch (record.op)
+        {
+        case NGXCaptureOp::Set:
+            Set(record);
+            break;
+
+        case NGXCaptureOp::Get:
+            Get(record);
+            break;
+
+        case NGXCaptureOp::CreateFeature:
+            createdFeatures[record.keyId]++;
+            [[fallthrough]];
+
+        case NGXCaptureOp::EvaluateFeature:
+            if (record.parameters != 0)
+                Find(record.parameters).initializing = false;
+            break;
+
+        default:
+            break;
+        }
+    }
+};
+
+struct ReplayResult
+{
+    size_t records = 0;
+    size_t mismatches = 0;
+};
+
+static ReplayResult Replay(const NGXCapture& capture)
+{
+    Replayer replayer(capture);
+    double opTime[(size_t) NGXCaptureOp::Count] = {};
+    size_t opCount[(size_t) NGXCaptureOp::Count] = {};
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (const auto& record : capture.records)
+    {
+        if (record.op >= NGXCaptureOp::Count)
+            continue;
+
+        auto opStart = std::chrono::steady_clock::now();
+        replayer.Replay(record);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - opStart;
+
+        opTime[(size_t) record.op] += elapsed.count();
+        opCount[(size_t) record.op]++;
+    }
+
+    std::chrono::duration<double> total = std::chrono::steady_clock::now() - start;
+
+    printf("%-16s %10s %12s %10s\n", "Op", "Count", "Total (ms)", "ns/op");
+
+    for (size_t i = 1; i < (size_t) NGXCaptureOp::Count; i++)
+    {
+        if (opCount[i] == 0)
+            continue;
+
+        printf("%-16s %10zu %12.2f %10.1f\n", OpNames[i], opCount[i], opTime[i] * 1000.0,
+               opTime[i] * 1e9 / opCount[i]);
+    }
+
+    for (auto [featureId, count] : replayer.createdFeatures)
+        printf("Feature %u created %zu times\n", featureId, count);
+
+    printf("%zu records replayed in %.2f ms, %zu initialization and callback Sets skipped, %zu callbacks called\n",
+           capture.records.size(), total.count() * 1000.0, replayer.skipped, replayer.callbacks);
+    printf("%zu Gets differ from the capture\n", replayer.mismatches);
+
+    return { capture.records.size(), replayer.mismatches };
+}
+
+// Game side of a DLSS integration, recorded by NGXParameterCapture like it does in the game
+static bool RecordCapture(size_t frames, std::filesystem::path& path)
+{
+    Config::Instance()->NGXParameterCapture = true;
+    path = Util::DllPath().parent_path() / L"OptiScaler_NGX.capture";
+    std::filesystem::remove(path);
+
+    if (!NGXParameterCapture::Start(path))
+        return false;
+
+    std::unique_ptr<NVNGX_Parameters> params(GetNGXParameters("Capture"));
+
+    int available = 0;
+    params->Get(NVSDK_NGX_Parameter_SuperSampling_Available, &available);
+    params->Get(NVSDK_NGX_Parameter_SuperSampling_FeatureInitResult, &available);
+
+    // Settings menu goes through every quality mode and resolution
+    auto querySettings = [](NVNGX_Parameters* params, unsigned int width, unsigned int height, int quality)
+    {
+        params->Set(NVSDK_NGX_Parameter_Width, width);
+        params->Set(NVSDK_NGX_Parameter_Height, height);
+        params->Set(NVSDK_NGX_Parameter_PerfQualityValue, quality);
+
+        void* callback = nullptr;
+        params->Get(NVSDK_NGX_Parameter_DLSSOptimalSettingsCallback, &callback);
+
+        if (callback != nullptr)
+            ((PFN_ParameterCallback) callback)(params);
+
+        unsigned int value = 0;
+        params->Get(NVSDK_NGX_Parameter_OutWidth, &value);
+        params->Get(NVSDK_NGX_Parameter_OutHeight, &value);
+        params->Get(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Min_Render_Width, &value);
+        params->Get(NVSDK_NGX_Parameter_DLSS_Get_Dynamic_Max_Render_Width, &value);
+
+        float sharpness = 0.0f;
+        params->Get(NVSDK_NGX_Parameter_Sharpness, &sharpness);
+    };
+
+    for (auto [width, height] : { std::pair(1920u, 1080u), std::pair(2560u, 1440u), std::pair(3840u, 2160u) })
+    {
+        for (int quality = NVSDK_NGX_PerfQuality_Value_MaxPerf; quality <= NVSDK_NGX_PerfQuality_Value_DLAA;
+             quality++)
+        {
+            querySettings(params.get(), width, height, quality);
+        }
+    }
+
+    querySettings(params.get(), 2560, 1440, NVSDK_NGX_PerfQuality_Value_Balanced);
+    params->Set(NVSDK_NGX_Parameter_CreationNodeMask, 1);
+    params->Set(NVSDK_NGX_Parameter_DLSS_Feature_Create_Flags, 0x23);
+    NGXParameterCapture::RecordFeature(NGXCaptureOp::CreateFeature, NGXCaptureApi::Dx12, params.get(), 1,
+                                       NVSDK_NGX_Feature_SuperSampling);
+
+    for (size_t frame = 0; frame < frames; frame++)
+    {
+        State::Instance().frameCount++;
+
+        params->Set(NVSDK_NGX_Parameter_Color, (ID3D12Resource*) (0x7F0000001000 + (frame % 3) * 0x100));
+        params->Set(NVSDK_NGX_Parameter_Output, (ID3D12Resource*) 0x7F0000002000);
+        params->Set(NVSDK_NGX_Parameter_Depth, (ID3D12Resource*) 0x7F0000003000);
+        params->Set(NVSDK_NGX_Parameter_MotionVectors, (ID3D12Resource*) 0x7F0000004000);
+        params->Set(NVSDK_NGX_Parameter_Jitter_Offset_X, (float) (frame % 8) / 8.0f - 0.5f);
+        params->Set(NVSDK_NGX_Parameter_Jitter_Offset_Y, (float) (frame % 3) / 3.0f - 0.5f);
+        params->Set(NVSDK_NGX_Parameter_MV_Scale_X, -1707.0f);
+        params->Set(NVSDK_NGX_Parameter_MV_Scale_Y, -960.0f);
+        params->Set(NVSDK_NGX_Parameter_Reset, frame == 0 ? 1 : 0);
+        params->Set(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Width, 1707u);
+        params->Set(NVSDK_NGX_Parameter_DLSS_Render_Subrect_Dimensions_Height, 960u);
+        params->Set("FrameTimeDeltaInMsec", 16.6);
+        NGXParameterCapture::RecordFeature(NGXCaptureOp::EvaluateFeature, NGXCaptureApi::Dx12, params.get(), 1);
+
+        // Resolution change in the middle, releases the feature and asks again
+        if (frame == frames / 2)
+        {
+            NGXParameterCapture::RecordFeature(NGXCaptureOp::ReleaseFeature, NGXCaptureApi::Dx12, nullptr, 1);
+            params->Reset();
+            querySettings(params.get(), 3840, 2160, NVSDK_NGX_PerfQuality_Value_MaxQuality);
+            NGXParameterCapture::RecordFeature(NGXCaptureOp::CreateFeature, NGXCaptureApi::Dx12, params.get(), 2,
+                                               NVSDK_NGX_Feature_SuperSampling);
+        }
+    }
+
+    NGXParameterCapture::Stop();
+
+    // Like NGX init after a shutdown, capture continues in the same file
+    std::unique_ptr<NVNGX_Parameters> restarted(GetNGXParameters("Capture"));
+    querySettings(restarted.get(), 1920, 1080, NVSDK_NGX_PerfQuality_Value_MaxPerf);
+    NGXParameterCapture::Stop();
+
+    Config::Instance()->NGXParameterCapture = false;
+    return true;
+}
+
+static void PrintUsage()
+{
+    printf("ngx_replay [capture] [--quick] [--upscale-ratio r] [--quality-ratios dlaa,uq,q,b,p,up] [--round n]\n"
+           "           [--extended-limits] [--unreal] [--nvidia] [--fg nukems|dlssg]\n");
+}
+
+int main(int argc, char** argv)
+{
+    std::filesystem::path path;
+    bool quick = false;
+
+    auto config = Config::Instance();
+    auto& state = State::Instance();
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string_view arg(argv[i]);
+        auto next = i + 1 < argc ? argv[i + 1] : nullptr;
+
+        if (arg == "--quick")
+        {
+            quick = true;
+        }
+        else if (arg == "--upscale-ratio" && next != nullptr)
+        {
+            config->UpscaleRatioOverrideEnabled = true;
+            config->UpscaleRatioOverrideValue = std::stof(next);
+            i++;
+        }
+        else if (arg == "--quality-ratios" && next != nullptr)
+        {
+            float ratios[6];
+
+            if (sscanf(next, "%f,%f,%f,%f,%f,%f", &ratios[0], &ratios[1], &ratios[2], &ratios[3], &ratios[4],
+                       &ratios[5]) != 6)
+            {
+                PrintUsage();
+                return 1;
+            }
+
+            config->QualityRatioOverrideEnabled = true;
+            config->QualityRatio_DLAA = ratios[0];
+            config->QualityRatio_UltraQuality = ratios[1];
+            config->QualityRatio_Quality = ratios[2];
+            config->QualityRatio_Balanced = ratios[3];
+            config->QualityRatio_Performance = ratios[4];
+            config->QualityRatio_UltraPerformance = ratios[5];
+            i++;
+        }
+        else if (arg == "--round" && next != nullptr)
+        {
+            config->RoundInternalResolution = std::stoi(next);
+            i++;
+        }
+        else if (arg == "--extended-limits")
+        {
+            config->ExtendedLimits = true;
+        }
+        else if (arg == "--unreal")
+        {
+            state.gameQuirks.forceUnrealEngine = true;
+        }
+        else if (arg == "--nvidia")
+        {
+            state.isRunningOnNvidia = true;
+        }
+        else if (arg == "--fg" && next != nullptr)
+        {
+            state.activeFgInput = std::string_view(next) == "nukems" ? FGInput::Nukems : FGInput::DLSSG;
+            i++;
+        }
+        else if (arg.starts_with("--"))
+        {
+            PrintUsage();
+            return 1;
+        }
+        else
+        {
+            path = argv[i];
+        }
+    }
+
+    if (!path.empty())
+    {
+        NGXCapture capture;
+        if (!LoadCapture(path, capture))
+            return 1;
+
+        Replay(capture);
+        return 0;
+    }
+
+    // Replaying with the config of the recording has to give back every captured value, an override must not
+    if (!RecordCapture(quick ? 16 : 4096, path))
+    {
+        printf("Can't record capture: %s\n", path.string().c_str());
+        return 1;
+    }
+
+    NGXCapture capture;
+    if (!LoadCapture(path, capture))
+        return 1;
+
+    printf("Recorded config:\n");
+    auto same = Replay(capture);
+
+    config->UpscaleRatioOverrideEnabled = true;
+    config->UpscaleRatioOverrideValue = 2.5f;
+
+    printf("\nUpscale ratio override 2.5:\n");
+    auto overridden = Replay(capture);
+
+    auto ok = same.mismatches == 0 && overridden.mismatches != 0;
+    printf(ok ? "\nReplay matches the recording and follows the override\n"
+              : "\nReplay doesn't match the recording or ignores the override\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,265 @@
+// Descriptor copy benchmark for resource tracking.
+// Copies runs of descriptors between synthetic heaps with the per descriptor Get/Set/Clear path
+// CopyDescriptors hooks used before and with HeapInfo::CopyRange, then checks both end up identical.
+
+#include <pch.h>
+
+#include <resource_tracking/ResTrack_dx12.h>
+
+#include <chrono>
+#include <cstdio>
+#include <algorithm>
+#include <random>
+#include <set>
+#include <map>
+
+constexpr UINT HEAP_SIZE = 1 << 16;
+constexpr UINT INCREMENT = 32;
+constexpr size_t RESOURCE_COUNT = 4096;
+
+struct FakeResource
+{
+    alignas(16) BYTE data[96];
+};
+
+static std::unique_ptr<HeapInfo> CreateHeap(SIZE_T cpuStart)
+{
+    auto cpuEnd = cpuStart + (SIZE_T) HEAP_SIZE * INCREMENT;
+    return std::make_unique<HeapInfo>(nullptr, cpuStart, cpuEnd, 0, 0, HEAP_SIZE, INCREMENT,
+                                      D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+}
+
+// Same steps the hooks did per descriptor before range copies
+static void CopyPerDescriptor(const HeapInfo* src, const HeapInfo* dest, SIZE_T srcIndex, SIZE_T destIndex,
+                              SIZE_T count)
+{
+    ResourceInfo info {};
+
+    for (SIZE_T i = 0; i < count; i++)
+    {
+        auto srcHandle = src->cpuStart + (srcIndex + i) * INCREMENT;
+        auto destHandle = dest->cpuStart + (destIndex + i) * INCREMENT;
+
+        if (src->GetByCpuHandle(srcHandle, &info))
+            dest->SetByCpuHandle(destHandle, info);
+        else
+            dest->ClearByCpuHandle(destHandle);
+    }
+}
+
+struct CopyOp
+{
+    SIZE_T srcIndex;
+    SIZE_T destIndex;
+};
+
+static double Measure(const std::vector<CopyOp>& ops, SIZE_T run, bool bulk, const HeapInfo* src,
+                      const HeapInfo* dest)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    for (const auto& op : ops)
+    {
+        if (bulk)
+            dest->CopyRange(src, op.srcIndex, op.destIndex, run);
+        else
+            CopyPerDescriptor(src, dest, op.srcIndex, op.destIndex, run);
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+static bool HeapsMatch(const HeapInfo* a, const HeapInfo* b)
+{
+    for (UINT i = 0; i < HEAP_SIZE; i++)
+    {
+        if (a->buffers[i] != b->buffers[i])
+        {
+            printf("Slot %u buffer mismatch\n", i);
+            return false;
+        }
+
+        if (a->buffers[i] != nullptr && a->meta[i].descId != b->meta[i].descId)
+        {
+            printf("Slot %u description mismatch\n", i);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Every non empty slot must be listed under its resource in the reverse index and nothing else
+static bool ReverseIndexMatches(const std::vector<const HeapInfo*>& heaps,
+                                const std::vector<std::unique_ptr<FakeResource>>& resources)
+{
+    std::map<ID3D12Resource*, std::set<ID3D12Resource**>> expected;
+
+    for (auto heap : heaps)
+    {
+        for (UINT i = 0; i < HEAP_SIZE; i++)
+        {
+            if (heap->buffers[i] != nullptr)
+                expected[heap->buffers[i]].insert(&heap->buffers[i]);
+        }
+    }
+
+    for (const auto& fake : resources)
+    {
+        auto resource = (ID3D12Resource*) fake.get();
+        auto& shard = _trackedResources.GetShard(resource);
+        auto it = shard.map.find(resource);
+
+        std::set<ID3D12Resource**> actual;
+        if (it != shard.map.end())
+            actual.insert(it->second.begin(), it->second.end());
+
+        if (actual != expected[resource])
+        {
+            printf("Reverse index mismatch for resource %p\n", (void*) resource);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// True when the reverse index lists slot under resource
+static bool IsListed(ID3D12Resource* resource, ID3D12Resource** slot)
+{
+    auto& shard = _trackedResources.GetShard(resource);
+    auto it = shard.map.find(resource);
+    auto listed = it != shard.map.end() && std::find(it->second.begin(), it->second.end(), slot) != it->second.end();
+    auto pos = shard.positions.find(slot);
+
+    return listed && pos != shard.positions.end() && pos->second.resource == resource;
+}
+
+// A descriptor re-bound without a detach of its old resource (e.g. racing writes to the same descriptor) must leave
+// the shard of the old resource, also when the new resource is in another shard
+static bool RebindAcrossShards(const std::vector<std::unique_ptr<FakeResource>>& resources)
+{
+    auto heap = CreateHeap(0x40000000);
+    auto source = CreateHeap(0x50000000);
+
+    auto oldResource = (ID3D12Resource*) resources[0].get();
+    ID3D12Resource* newResource = nullptr;
+
+    for (const auto& fake : resources)
+    {
+        if (&_trackedResources.GetShard((ID3D12Resource*) fake.get()) != &_trackedResources.GetShard(oldResource))
+        {
+            newResource = (ID3D12Resource*) fake.get();
+            break;
+        }
+    }
+
+    // Single descriptor path
+    heap->buffers[0] = oldResource;
+    heap->AttachToNewResource(0);
+
+    heap->buffers[0] = newResource;
+    heap->AttachToNewResource(0);
+
+    auto ok = !IsListed(oldResource, &heap->buffers[0]) && IsListed(newResource, &heap->buffers[0]);
+
+    heap->DetachFromOldResource(0);
+    heap->buffers[0] = nullptr;
+
+    ok = ok && !IsListed(newResource, &heap->buffers[0]) && heap->owners[0] == nullptr;
+
+    // Range copy path, slots lose their old resource without a detach before the copy
+    constexpr UINT count = 8;
+
+    for (UINT i = 0; i < count; i++)
+    {
+        heap->buffers[i] = oldResource;
+        heap->AttachToNewResource(i);
+        heap->buffers[i] = nullptr;
+
+        ResourceInfo info {};
+        info.buffer = newResource;
+        source->SetByCpuHandle(source->cpuStart + (SIZE_T) i * INCREMENT, info);
+    }
+
+    heap->CopyRange(source.get(), 0, 0, count);
+
+    for (UINT i = 0; i < count; i++)
+        ok = ok && !IsListed(oldResource, &heap->buffers[i]) && IsListed(newResource, &heap->buffers[i]);
+
+    for (UINT i = 0; i < count; i++)
+    {
+        heap->ClearByCpuHandle(heap->cpuStart + (SIZE_T) i * INCREMENT);
+        source->ClearByCpuHandle(source->cpuStart + (SIZE_T) i * INCREMENT);
+        ok = ok && !IsListed(newResource, &heap->buffers[i]);
+    }
+
+    if (!ok)
+        printf("Re-bound descriptor is still listed under its old resource\n");
+
+    return ok;
+}
+
+int main(int argc, char** argv)
+{
+    bool quick = argc > 1 && std::string_view(argv[1]) == "--quick";
+    size_t descriptorsPerRun = quick ? (1 << 16) : (1 << 22);
+
+    std::mt19937_64 rng(0x0571);
+
+    std::vector<std::unique_ptr<FakeResource>> resources;
+    for (size_t i = 0; i < RESOURCE_COUNT; i++)
+        resources.push_back(std::make_unique<FakeResource>());
+
+    auto src = CreateHeap(0x10000000);
+    auto destSingle = CreateHeap(0x20000000);
+    auto destBulk = CreateHeap(0x30000000);
+
+    // Staging heaps are mostly filled, a few empty slots exercise the clear path
+    for (UINT i = 0; i < HEAP_SIZE; i++)
+    {
+        if (rng() % 10 == 0)
+            continue;
+
+        ResourceInfo info {};
+        info.buffer = (ID3D12Resource*) resources[rng() % RESOURCE_COUNT].get();
+        info.width = 256 << (rng() % 4);
+        info.height = 256 << (rng() % 4);
+        info.format = (rng() & 1) ? DXGI_FORMAT_R16G16B16A16_FLOAT : DXGI_FORMAT_R8G8B8A8_UNORM;
+        info.type = (ResourceType) (rng() % 3);
+        src->SetByCpuHandle(src->cpuStart + (SIZE_T) i * INCREMENT, info);
+    }
+
+    printf("%-8s %16s %16s %8s\n", "Run", "Single (M/s)", "Range (M/s)", "Speedup");
+
+    bool ok = true;
+
+    for (SIZE_T run : { 1, 8, 64, 256, 1024 })
+    {
+        std::vector<CopyOp> ops(std::max<size_t>(descriptorsPerRun / run, 1));
+        for (auto& op : ops)
+        {
+            op.srcIndex = rng() % (HEAP_SIZE - run);
+            op.destIndex = rng() % (HEAP_SIZE - run);
+        }
+
+        auto single = Measure(ops, run, false, src.get(), destSingle.get());
+        auto bulk = Measure(ops, run, true, src.get(), destBulk.get());
+
+        auto count = (double) ops.size() * run / 1e6;
+        printf("%-8zu %16.1f %16.1f %7.2fx\n", run, count / single, count / bulk, single / bulk);
+
+        if (!HeapsMatch(destSingle.get(), destBulk.get()))
+            ok = false;
+    }
+
+    if (!ReverseIndexMatches({ src.get(), destSingle.get(), destBulk.get() }, resources))
+        ok = false;
+
+    if (!RebindAcrossShards(resources))
+        ok = false;
+
+    printf(ok ? "Results match\n" : "Results differ\n");
+    return ok ? 0 : 1;
+}
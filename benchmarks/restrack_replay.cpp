@@ -0,0 +1,505 @@
+// Resource tracking capture replayer.
+// Loads a capture written by ResTrack_Capture (OptiScaler_ResTrack.capture) and replays it through HeapInfo and
+// the tracked resource index the same way the hooks do, then prints the time spent per op.
+// Without a capture file a synthetic one is generated, written and replayed, --quick keeps it small.
+
+#include <pch.h>
+
+#include <resource_tracking/ResTrack_dx12.h>
+#include <resource_tracking/ResTrack_Capture.h>
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <random>
+#include <set>
+
+static const char* OpNames[] = { "None",
+                                 "HeapCreate",
+                                 "HeapRelease",
+                                 "CreateRTV",
+                                 "CreateSRV",
+                                 "CreateUAV",
+                                 "CopyDescriptors",
+                                 "SetGraphicsRootTable",
+                                 "SetComputeRootTable",
+                                 "OMSetRenderTarget",
+                                 "DrawInstanced",
+                                 "DrawIndexedInstanced",
+                                 "Dispatch",
+                                 "ExecuteCommandLists",
+                                 "Release" };
+
+static_assert(std::size(OpNames) == (size_t) ResTrackOp::Count, "Name every capture op");
+
+static bool LoadCapture(const std::filesystem::path& path, std::vector<ResTrackRecord>& records)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    if (!file.is_open())
+    {
+        printf("Can't open capture: %s\n", path.string().c_str());
+        return false;
+    }
+
+    ResTrackCaptureHeader header {};
+    file.read((char*) &header, sizeof(header));
+
+    if (!file || header.magic != ResTrackCaptureHeader::Magic ||
+        header.version != ResTrackCaptureHeader::CurrentVersion || header.recordSize != sizeof(ResTrackRecord))
+    {
+        printf("Not a version %u resource tracking capture: %s\n", ResTrackCaptureHeader::CurrentVersion,
+               path.string().c_str());
+        return false;
+    }
+
+    auto start = file.tellg();
+    file.seekg(0, std::ios::end);
+    auto count = (size_t) (file.tellg() - start) / sizeof(ResTrackRecord);
+    file.seekg(start);
+
+    records.resize(count);
+    file.read((char*) records.data(), count * sizeof(ResTrackRecord));
+
+    // Threads write their records in blocks, replay in timestamp order
+    std::stable_sort(records.begin(), records.end(),
+                     [](const ResTrackRecord& a, const ResTrackRecord& b) { return a.timestamp < b.timestamp; });
+
+    return true;
+}
+
+// Heap list and lookups of ResTrack_Dx12, without the thread local caches and reclamation
+class Replayer
+{
+    std::vector<std::unique_ptr<HeapInfo>> _heaps;
+    HeapRangeIndex _index;
+
+    static size_t HeapIndexSlot(UINT type) { return type == D3D12_DESCRIPTOR_HEAP_TYPE_RTV ? 1 : 0; }
+
+    void RebuildHeapIndex()
+    {
+        _index = {};
+
+        for (const auto& heap : _heaps)
+        {
+            _index.cpu[HeapIndexSlot(heap->type)].push_back({ heap->cpuStart, heap->cpuEnd, heap.get() });
+
+            if (heap->gpuStart != NULL)
+                _index.gpu.push_back({ heap->gpuStart, heap->gpuEnd, heap.get() });
+
+            _index.byHeap[heap->heap] = heap.get();
+        }
+
+        auto byStart = [](const HeapRange& a, const HeapRange& b) { return a.start < b.start; };
+        std::sort(_index.cpu[0].begin(), _index.cpu[0].end(), byStart);
+        std::sort(_index.cpu[1].begin(), _index.cpu[1].end(), byStart);
+        std::sort(_index.gpu.begin(), _index.gpu.end(), byStart);
+    }
+
+    void HeapCreate(const ResTrackRecord& record)
+    {
+        auto numDescriptors = (UINT) record.args[3];
+        auto increment = (UINT) (record.args[3] >> 32);
+        auto cpuStart = (SIZE_T) record.args[1];
+        auto gpuStart = (SIZE_T) record.args[2];
+
+        _heaps.push_back(std::make_unique<HeapInfo>((ID3D12DescriptorHeap*) record.args[0], cpuStart,
+                                                    cpuStart + (SIZE_T) increment * numDescriptors, gpuStart,
+                                                    gpuStart + (SIZE_T) increment * numDescriptors, numDescriptors,
+                                                    increment, record.heapType));
+        RebuildHeapIndex();
+    }
+
+    void HeapRelease(const ResTrackRecord& record)
+    {
+        auto found = _index.byHeap.find((ID3D12DescriptorHeap*) record.args[0]);
+        if (found == _index.byHeap.end())
+            return;
+
+        auto heap = found->second;
+
+        for (UINT i = 0; i < heap->numDescriptors; i++)
+        {
+            auto& slot = heap->buffers[i];
+
+            if (slot == nullptr)
+                continue;
+
+            _trackedResources.Detach(slot, &slot, &heap->owners[i]);
+            slot = nullptr;
+        }
+
+        std::erase_if(_heaps, [heap](const std::unique_ptr<HeapInfo>& item) { return item.get() == heap; });
+        RebuildHeapIndex();
+    }
+
+    void CreateView(const ResTrackRecord& record)
+    {
+        auto cpuHandle = (SIZE_T) record.args[1];
+        auto rtv = record.op == ResTrackOp::CreateRTV;
+        auto heap = HeapRangeIndex::Find(_index.cpu[rtv ? 1 : 0], cpuHandle);
+
+        if (heap == nullptr)
+            return;
+
+        if (record.args[0] == 0)
+        {
+            heap->ClearByCpuHandle(cpuHandle);
+            return;
+        }
+
+        ResourceInfo info {};
+        info.buffer = (ID3D12Resource*) record.args[0];
+        info.width = record.args[2];
+        info.height = (UINT) record.args[3];
+        info.format = (DXGI_FORMAT) ((record.args[3] >> 32) & 0xFFFF);
+        info.flags = (D3D12_RESOURCE_FLAGS) (record.args[3] >> 48);
+        info.type = rtv ? RTV : (record.op == ResTrackOp::CreateSRV ? SRV : UAV);
+        heap->SetByCpuHandle(cpuHandle, info);
+    }
+
+    void CopyDescriptors(const ResTrackRecord& record)
+    {
+        auto destHandle = (SIZE_T) record.args[0];
+        auto srcHandle = (SIZE_T) record.args[1];
+
+        auto destHeap = _index.FindByCpuHandle(destHandle);
+        if (destHeap == nullptr)
+            return;
+
+        auto srcHeap = srcHandle != 0 ? _index.FindByCpuHandle(srcHandle) : nullptr;
+        destHeap->CopyRange(srcHeap, srcHeap != nullptr ? srcHeap->GetIndexByCpuHandle(srcHandle) : 0,
+                            destHeap->GetIndexByCpuHandle(destHandle), (SIZE_T) record.args[2]);
+    }
+
+    bool SetRootTable(const ResTrackRecord& record)
+    {
+        auto heap = HeapRangeIndex::Find(_index.gpu, (SIZE_T) record.args[1]);
+        ResourceInfo info {};
+
+        return heap != nullptr && heap->GetByGpuHandle((SIZE_T) record.args[1], &info);
+    }
+
+    bool SetRenderTarget(const ResTrackRecord& record)
+    {
+        auto heap = HeapRangeIndex::Find(_index.cpu[1], (SIZE_T) record.args[1]);
+        ResourceInfo info {};
+
+        return heap != nullptr && heap->GetByCpuHandle((SIZE_T) record.args[1], &info);
+    }
+
+    void Release(const ResTrackRecord& record)
+    {
+        auto resource = (ID3D12Resource*) record.args[0];
+
+        if (!TrackedResourceFilter::MayContain(resource))
+            return;
+
+        std::vector<ID3D12Resource**> toClean;
+        {
+            auto& shard = _trackedResources.GetShard(resource);
+            std::scoped_lock lock(shard.mutex);
+            TrackedResourceIndex::TakeLocked(shard, resource, toClean);
+        }
+
+        for (auto slot : toClean)
+        {
+            if (*slot == resource)
+                *slot = nullptr;
+        }
+    }
+
+  public:
+    // Lookups that found a resource, keeps them from being optimized out
+    size_t hits = 0;
+
+    void Replay(const ResTrackRecord& record)
+    {
+        switch (record.op)
+        {
+        case ResTrackOp::HeapCreate:
+            HeapCreate(record);
+            break;
+
+        case ResTrackOp::HeapRelease:
+            HeapRelease(record);
+            break;
+
+        case ResTrackOp::CreateRTV:
+        case ResTrackOp::CreateSRV:
+        case ResTrackOp::CreateUAV:
+            CreateView(record);
+            break;
+
+        case ResTrackOp::CopyDescriptors:
+            CopyDescriptors(record);
+            break;
+
+        case ResTrackOp::SetGraphicsRootTable:
+        case ResTrackOp::SetComputeRootTable:
+            hits += SetRootTable(record);
+            break;
+
+        case ResTrackOp::OMSetRenderTarget:
+            hits += SetRenderTarget(record);
+            break;
+
+        case ResTrackOp::Release:
+            Release(record);
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    // Every non empty slot must be listed under its resource in the reverse index and nothing else
+    bool ReverseIndexMatches(const std::vector<ResTrackRecord>& records) const
+    {
+        std::map<ID3D12Resource*, std::set<ID3D12Resource**>> expected;
+
+        for (const auto& heap : _heaps)
+        {
+            for (UINT i = 0; i < heap->numDescriptors; i++)
+            {
+                if (heap->buffers[i] != nullptr)
+                    expected[heap->buffers[i]].insert(&heap->buffers[i]);
+            }
+        }
+
+        std::set<ID3D12Resource*> resources;
+        for (const auto& record : records)
+        {
+            if (record.op >= ResTrackOp::CreateRTV && record.op <= ResTrackOp::CreateUAV && record.args[0] != 0)
+                resources.insert((ID3D12Resource*) record.args[0]);
+        }
+
+        for (auto resource : resources)
+        {
+            auto& shard = _trackedResources.GetShard(resource);
+            auto it = shard.map.find(resource);
+
+            std::set<ID3D12Resource**> actual;
+            if (it != shard.map.end())
+                actual.insert(it->second.begin(), it->second.end());
+
+            if (actual != expected[resource])
+            {
+                printf("Reverse index mismatch for resource %p\n", (void*) resource);
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+
+// Frame loop of a game streaming views into staging heaps and copying them to one shader visible heap
+static std::vector<ResTrackRecord> GenerateCapture(size_t frames)
+{
+    constexpr UINT INCREMENT = 32;
+    constexpr UINT STAGING_SIZE = 4096;
+    constexpr UINT VISIBLE_SIZE = 1 << 16;
+    constexpr UINT RTV_SIZE = 1024;
+    constexpr size_t RESOURCE_COUNT = 2048;
+    constexpr uint64_t COMMAND_LIST = 0xC0DE0000;
+
+    std::mt19937_64 rng(0x0CA9);
+    std::vector<ResTrackRecord> records;
+    uint64_t timestamp = 0;
+
+    auto add = [&](ResTrackOp op, uint64_t arg0, uint64_t arg1 = 0, uint64_t arg2 = 0, uint64_t arg3 = 0,
+                   uint8_t heapType = 0)
+    {
+        auto& record = records.emplace_back();
+        record.op = op;
+        record.heapType = heapType;
+        record.threadId = 1 + (uint32_t) (rng() % 4);
+        record.timestamp = ++timestamp;
+        record.args[0] = arg0;
+        record.args[1] = arg1;
+        record.args[2] = arg2;
+        record.args[3] = arg3;
+    };
+
+    uint64_t nextResource = 0x7F0000000000;
+    std::vector<uint64_t> resources(RESOURCE_COUNT);
+    for (auto& resource : resources)
+        resource = nextResource += 0x1000;
+
+    auto addHeap = [&](uint64_t heap, uint64_t cpuStart, uint64_t gpuStart, UINT size, uint8_t type)
+    { add(ResTrackOp::HeapCreate, heap, cpuStart, gpuStart, size | ((uint64_t) INCREMENT << 32), type); };
+
+    const uint64_t visibleCpu = 0x10000000;
+    const uint64_t visibleGpu = 0x900000000;
+    const uint64_t rtvCpu = 0x20000000;
+    uint64_t stagingCpu = 0x30000000;
+    uint64_t stagingHeap = 0xBEEF0000;
+
+    addHeap(0xABC00000, visibleCpu, visibleGpu, VISIBLE_SIZE, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+    addHeap(0xABC10000, rtvCpu, 0, RTV_SIZE, D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
+    addHeap(stagingHeap, stagingCpu, 0, STAGING_SIZE, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
+    auto view = [&](ResTrackOp op, uint64_t cpuHandle)
+    {
+        // Some views are of untracked resources, hooks record those as cleared slots
+        if (rng() % 16 == 0)
+        {
+            add(op, 0, cpuHandle);
+            return;
+        }
+
+        auto packed = (uint64_t) (1080 >> (rng() % 3)) | ((uint64_t) DXGI_FORMAT_R16G16B16A16_FLOAT << 32);
+        add(op, resources[rng() % RESOURCE_COUNT], cpuHandle, 1920 >> (rng() % 3), packed);
+    };
+
+    UINT visibleOffset = 0;
+
+    for (size_t frame = 0; frame < frames; frame++)
+    {
+        for (UINT i = 0; i < 64; i++)
+        {
+            auto op = (i % 4 == 0) ? ResTrackOp::CreateUAV : ResTrackOp::CreateSRV;
+            view(op, stagingCpu + (rng() % STAGING_SIZE) * INCREMENT);
+        }
+
+        for (UINT i = 0; i < 8; i++)
+            view(ResTrackOp::CreateRTV, rtvCpu + (rng() % RTV_SIZE) * INCREMENT);
+
+        for (UINT pass = 0; pass < 256; pass++)
+        {
+            UINT run = 1 + (UINT) (rng() % 16);
+            if (visibleOffset + run > VISIBLE_SIZE)
+                visibleOffset = 0;
+
+            auto table = visibleCpu + (uint64_t) visibleOffset * INCREMENT;
+            auto source = stagingCpu + (rng() % (STAGING_SIZE - run)) * INCREMENT;
+            add(ResTrackOp::CopyDescriptors, table, source, run, 0, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+
+            if (pass % 8 == 0)
+                add(ResTrackOp::OMSetRenderTarget, COMMAND_LIST, rtvCpu + (rng() % RTV_SIZE) * INCREMENT, 0);
+
+            auto compute = pass % 4 == 0;
+            add(compute ? ResTrackOp::SetComputeRootTable : ResTrackOp::SetGraphicsRootTable, COMMAND_LIST,
+                visibleGpu + (uint64_t) visibleOffset * INCREMENT, pass % 3);
+            add(compute ? ResTrackOp::Dispatch : ResTrackOp::DrawIndexedInstanced, COMMAND_LIST);
+
+            visibleOffset += run;
+        }
+
+        add(ResTrackOp::ExecuteCommandLists, 0xC0E0000, 1);
+
+        // A few transient resources die every frame and are replaced with new ones
+        for (UINT i = 0; i < 4; i++)
+        {
+            auto& resource = resources[rng() % RESOURCE_COUNT];
+            add(ResTrackOp::Release, resource);
+            resource = nextResource += 0x1000;
+        }
+
+        // Staging heap is recreated from time to time
+        if (frame % 64 == 63)
+        {
+            add(ResTrackOp::HeapRelease, stagingHeap);
+            stagingHeap += 0x100;
+            stagingCpu += 0x1000000;
+            addHeap(stagingHeap, stagingCpu, 0, STAGING_SIZE, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+        }
+    }
+
+    return records;
+}
+
+// Same layout ResTrack_Capture writes, records in per thread blocks
+static bool WriteCapture(const std::filesystem::path& path, const std::vector<ResTrackRecord>& records)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+    if (!file.is_open())
+        return false;
+
+    ResTrackCaptureHeader header {};
+    header.timerFrequency = 1000000;
+    file.write((const char*) &header, sizeof(header));
+
+    for (uint32_t threadId = 1; threadId <= 4; threadId++)
+    {
+        for (const auto& record : records)
+        {
+            if (record.threadId == threadId)
+                file.write((const char*) &record, sizeof(record));
+        }
+    }
+
+    return file.good();
+}
+
+int main(int argc, char** argv)
+{
+    std::filesystem::path path;
+    bool quick = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::string_view(argv[i]) == "--quick")
+            quick = true;
+        else
+            path = argv[i];
+    }
+
+    if (path.empty())
+    {
+        path = std::filesystem::temp_directory_path() / "restrack_replay.capture";
+
+        if (!WriteCapture(path, GenerateCapture(quick ? 64 : 2048)))
+        {
+            printf("Can't write synthetic capture: %s\n", path.string().c_str());
+            return 1;
+        }
+    }
+
+    std::vector<ResTrackRecord> records;
+    if (!LoadCapture(path, records))
+        return 1;
+
+    Replayer replayer;
+    double opTime[(size_t) ResTrackOp::Count] = {};
+    size_t opCount[(size_t) ResTrackOp::Count] = {};
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (const auto& record : records)
+    {
+        if (record.op >= ResTrackOp::Count)
+            continue;
+
+        auto opStart = std::chrono::steady_clock::now();
+        replayer.Replay(record);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - opStart;
+
+        opTime[(size_t) record.op] += elapsed.count();
+        opCount[(size_t) record.op]++;
+    }
+
+    std::chrono::duration<double> total = std::chrono::steady_clock::now() - start;
+
+    printf("%-22s %10s %12s %10s\n", "Op", "Count", "Total (ms)", "ns/op");
+
+    for (size_t i = 1; i < (size_t) ResTrackOp::Count; i++)
+    {
+        if (opCount[i] == 0)
+            continue;
+
+        printf("%-22s %10zu %12.2f %10.1f\n", OpNames[i], opCount[i], opTime[i] * 1000.0,
+               opTime[i] * 1e9 / opCount[i]);
+    }
+
+    printf("%zu records replayed in %.2f ms, %zu lookups hit a resource\n", records.size(), total.count() * 1000.0,
+           replayer.hits);
+
+    auto ok = replayer.ReverseIndexMatches(records);
+    printf(ok ? "Reverse index matches heaps\n" : "Reverse index differs from heaps\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,225 @@
+// Pattern scan benchmark.
+// Builds synthetic modules with x64 like code sections, plants the FSR2/FSR3 inputs patterns in them and compares
+// the std::search scanner OptiScaler used before compiled patterns, one scanner::GetAddress call per pattern and a
+// single scanner::Scan pass for all of them. Speedup is the single pass against the std::search scanner.
+
+#include <pch.h>
+
+#include <scanner/scanner.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+// Patterns from inputs/FSR2_Dx12.cpp and inputs/FSR3_Dx12.cpp
+static const char* Patterns[] = {
+    "40 55 57 41 54 41 56 48 8D AC 24 ? ? ? ? 48 81 EC ? ? ? ? 48 8B 05 ? ? ? ? 48 33 C4 48 89 85 ? ? ? ? "
+    "4C 8B F2 41 B8 ? ? ? ? 33 D2 48 8B F9 E8",
+    "40 53 48 83 EC 20 48 8B D9 48 85 C9 75 ? B8 00 00 00 80 48 83 C4 20 5B C3",
+    "40 55 56 41 57 48 8D AC 24 ? ? ? ? B8 ? ? ? ? E8 ? ? ? ? 48 2B E0 80 B9 ? ? ? ? 00 4C 8B FA 48 8B 02 "
+    "48 8B F1",
+    "40 55 53 57 48 8D AC 24 ? ? ? ? B8 ? ? ? ? E8 ? ? ? ? 48 2B E0 80 B9 ? ? ? ? 00 48 8B DA 48 8B 02 "
+    "48 8B F9",
+    "40 55 57 41 56 48 8D AC 24 ? ? ? ? B8 ? ? ? ? E8 ? ? ? ? 48 2B E0 80 B9 ? ? ? ? ? 4C 8B F2 48 8B 02 "
+    "48 8B F9",
+    "40 55 56 57 48 8D AC 24 ? ? ? ? B8 ? ? ? ? E8 ? ? ? ? 48 2B E0 48 8B 05 ? ? ? ? 48 33 C4 48 89 85 ? ? ? ? "
+    "F7 01 ? ? ? ? 48 8B F2 48 8B F9",
+    "48 ? ? ? ? 57 48 83 EC 20 48 8B DA 41 B8 ? ? ? ? 33 D2 48 8B F9 E8 ? ? ? ? 48 85 FF 74 ? 48 85 DB",
+    "40 ? ? ? ? 20 48 8B D9 48 85 C9 75 ? B8 ? ? ? ? 48 83 C4 20 5B C3 44 8B 81 ? ? ? ? 48 8D 91 ? ? ? ? 48 ? "
+    "? ? ? 48 83 C1 18 48 ? ? ? ? 48 ? ? ? ? E8 ? ? ? ? 44 8B 83",
+    "48 85 C9 74 36 48 85 D2 74 31 8B 41 04 39 82 ? ? ? ? 77 20 8B 41 08 39 82 ? ? ? ? 77 15 48 83 B9 ? ? ? ? "
+    "? 75 06 B8 ? ? ? ? C3",
+    "85 C9 74 3C 83 E9 01 74 2E 83 E9 01 74 20 83 E9 01 74 12 83 F9 01 74 04 0F 57 C0 C3",
+};
+
+constexpr size_t PATTERN_COUNT = std::size(Patterns);
+constexpr DWORD HEADER_SIZE = 0x1000;
+
+struct SyntheticModule
+{
+    std::vector<uint8_t> image;
+
+    HMODULE Handle() const { return (HMODULE) image.data(); }
+};
+
+// Most common bytes of x64 code first, rest of the values fill the remaining share evenly
+static uint8_t RandomCodeByte(std::mt19937_64& rng)
+{
+    static const uint8_t common[] = { 0x00, 0x48, 0x8B, 0x89, 0xFF, 0x0F, 0x24, 0x44, 0x4C, 0x85, 0xE8, 0x8D,
+                                      0x01, 0xC0, 0x74, 0x83, 0x45, 0xCC, 0x20, 0x10, 0x08, 0x75, 0xC3, 0x33 };
+
+    auto roll = rng() % 100;
+
+    if (roll < 20)
+        return 0x00;
+
+    if (roll < 60)
+        return common[rng() % std::size(common)];
+
+    return (uint8_t) rng();
+}
+
+static SyntheticModule CreateModule(size_t textSize, std::mt19937_64& rng)
+{
+    SyntheticModule module;
+    module.image.resize(HEADER_SIZE + textSize);
+
+    auto base = module.image.data();
+    auto dos = (IMAGE_DOS_HEADER*) base;
+    dos->e_magic = IMAGE_DOS_SIGNATURE;
+    dos->e_lfanew = 0x80;
+
+    auto nt = (IMAGE_NT_HEADERS64*) (base + dos->e_lfanew);
+    nt->Signature = IMAGE_NT_SIGNATURE;
+    nt->FileHeader.NumberOfSections = 1;
+    nt->FileHeader.SizeOfOptionalHeader = sizeof(IMAGE_OPTIONAL_HEADER64);
+    nt->OptionalHeader.Magic = IMAGE_NT_OPTIONAL_HDR64_MAGIC;
+
+    auto text = IMAGE_FIRST_SECTION(nt);
+    memcpy(text->Name, ".text", 5);
+    text->Misc.VirtualSize = (DWORD) textSize;
+    text->VirtualAddress = HEADER_SIZE;
+    text->SizeOfRawData = (DWORD) textSize;
+    text->Characteristics = IMAGE_SCN_CNT_CODE | IMAGE_SCN_MEM_EXECUTE | IMAGE_SCN_MEM_READ;
+
+    for (size_t i = HEADER_SIZE; i < module.image.size(); i++)
+        module.image[i] = RandomCodeByte(rng);
+
+    return module;
+}
+
+// Every other pattern is planted in the later half of the section, the rest are missing like in unrelated games
+static void PlantPatterns(SyntheticModule& module, const std::vector<scanner::Pattern>& patterns,
+                          std::mt19937_64& rng)
+{
+    auto textSize = module.image.size() - HEADER_SIZE;
+
+    for (size_t i = 0; i < patterns.size(); i += 2)
+    {
+        auto& pattern = patterns[i];
+        auto position = HEADER_SIZE + textSize / 2 + rng() % (textSize / 2 - pattern.Size());
+
+        for (size_t j = 0; j < pattern.Size(); j++)
+        {
+            if (pattern.mask[j] != 0)
+                module.image[position + j] = pattern.bytes[j];
+        }
+    }
+}
+
+// FindPattern from the std::search scanner, the mask is parsed again for every call.
+// The section end is exclusive here, the old scanner read one byte past it.
+static uintptr_t BaselineFindPattern(uintptr_t startAddress, uintptr_t maxSize, const char* mask)
+{
+    std::vector<std::pair<uint8_t, bool>> pattern;
+
+    for (size_t i = 0; i < strlen(mask);)
+    {
+        if (mask[i] != '?')
+        {
+            pattern.emplace_back(static_cast<uint8_t>(strtoul(&mask[i], nullptr, 16)), false);
+            i += 3;
+        }
+        else
+        {
+            pattern.emplace_back(0x00, true);
+            i += 2;
+        }
+    }
+
+    const auto dataStart = reinterpret_cast<const uint8_t*>(startAddress);
+    const auto dataEnd = dataStart + maxSize;
+
+    auto sig = std::search(dataStart, dataEnd, pattern.begin(), pattern.end(),
+                           [](uint8_t currentByte, std::pair<uint8_t, bool> Pattern)
+                           { return Pattern.second || (currentByte == Pattern.first); });
+
+    if (sig == dataEnd)
+        return NULL;
+
+    return std::distance(dataStart, sig) + startAddress;
+}
+
+// Synthetic modules have a single executable section
+static uintptr_t BaselineGetAddress(const SyntheticModule& module, const char* pattern)
+{
+    auto start = (uintptr_t) module.image.data() + HEADER_SIZE;
+    return BaselineFindPattern(start, module.image.size() - HEADER_SIZE, pattern);
+}
+
+template <typename F> static double Measure(size_t iterations, F&& func)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < iterations; i++)
+        func();
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() * 1000.0 / iterations;
+}
+
+int main(int argc, char** argv)
+{
+    bool quick = argc > 1 && std::string_view(argv[1]) == "--quick";
+    size_t iterations = quick ? 1 : 5;
+
+    std::mt19937_64 rng(0x5CA7);
+
+    std::vector<scanner::Pattern> patterns;
+    for (auto pattern : Patterns)
+        patterns.emplace_back(pattern);
+
+    printf("%-10s %18s %18s %18s %8s\n", "Text (MB)", "std::search (ms)", "GetAddress (ms)", "Single pass (ms)",
+           "Speedup");
+
+    bool ok = true;
+
+    // Below and above the parallel scan threshold
+    for (size_t megabytes : { 8, 64 })
+    {
+        auto module = CreateModule(megabytes << 20, rng);
+        PlantPatterns(module, patterns, rng);
+
+        uintptr_t expected[PATTERN_COUNT] = {};
+        auto baselineTime = Measure(iterations,
+                                    [&]()
+                                    {
+                                        for (size_t i = 0; i < PATTERN_COUNT; i++)
+                                            expected[i] = BaselineGetAddress(module, Patterns[i]);
+                                    });
+
+        uintptr_t separate[PATTERN_COUNT] = {};
+        auto separateTime = Measure(iterations,
+                                    [&]()
+                                    {
+                                        for (size_t i = 0; i < PATTERN_COUNT; i++)
+                                            separate[i] = scanner::GetAddress(module.Handle(), Patterns[i]);
+                                    });
+
+        std::vector<scanner::PatternScan> scans(PATTERN_COUNT);
+        auto singleTime = Measure(iterations,
+                                  [&]()
+                                  {
+                                      for (size_t i = 0; i < PATTERN_COUNT; i++)
+                                          scans[i].pattern = &patterns[i];
+
+                                      scanner::Scan(module.Handle(), scans);
+                                  });
+
+        printf("%-10zu %18.2f %18.2f %18.2f %7.2fx\n", megabytes, baselineTime, separateTime, singleTime,
+               baselineTime / singleTime);
+
+        for (size_t i = 0; i < PATTERN_COUNT; i++)
+        {
+            if (separate[i] != expected[i] || scans[i].Address() != expected[i])
+            {
+                printf("Pattern %zu mismatch in %zu MB module\n", i, megabytes);
+                ok = false;
+            }
+        }
+    }
+
+    printf(ok ? "Results match\n" : "Results differ\n");
+    return ok ? 0 : 1;
+}